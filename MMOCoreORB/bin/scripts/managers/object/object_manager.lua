@@ -8,239 +8,68 @@ function Object:new (o)
     return o
 end
 
-_localLuaAiAgent = LuaAiAgent(nil)
-_localLuaAiAgent1 = LuaAiAgent(nil)
-_localLuaAiAgent2 = LuaAiAgent(nil)
-_localLuaAiAgent3 = LuaAiAgent(nil)
-
-_localLuaSceneObject = LuaSceneObject(nil)
-_localLuaSceneObject1 = LuaSceneObject(nil)
-_localLuaSceneObject2 = LuaSceneObject(nil)
-_localLuaSceneObject3 = LuaSceneObject(nil)
-
-_localLuaTangibleObject = LuaTangibleObject(nil)
-_localLuaTangibleObject1 = LuaTangibleObject(nil)
-_localLuaTangibleObject2 = LuaTangibleObject(nil)
-_localLuaTangibleObject3 = LuaTangibleObject(nil)
-
-_localLuaCreatureObject = LuaCreatureObject(nil)
-_localLuaCreatureObject1 = LuaCreatureObject(nil)
-_localLuaCreatureObject2 = LuaCreatureObject(nil)
-_localLuaCreatureObject3 = LuaCreatureObject(nil)
-
-_localLuaPlayerObject = LuaPlayerObject(nil)
-_localLuaBuildingObject = LuaBuildingObject(nil)
-_localLuaCityRegion = LuaCityRegion(nil)
-_localLuaActiveArea = LuaActiveArea(nil)
-_localLuaWaypointObject = LuaWaypointObject(nil)
-
-AiAgent = function(pAiAgent)
-  if (pAiAgent == nil) then
-    return nil
-  end
-
-  _localLuaAiAgent:_setObject(pAiAgent)
-
-  return _localLuaAiAgent
-end
-
-AiAgent1 = function(pAiAgent)
-  if (pAiAgent == nil) then
-    return nil
-  end
-
-  _localLuaAiAgent1:_setObject(pAiAgent)
-
-  return _localLuaAiAgent1
-end
-
-AiAgent2 = function(pAiAgent)
-  if (pAiAgent == nil) then
-    return nil
-  end
-
-  _localLuaAiAgent2:_setObject(pAiAgent)
-
-  return _localLuaAiAgent2
-end
-
-AiAgent3 = function(pAiAgent)
-  if (pAiAgent == nil) then
-    return nil
-  end
-
-  _localLuaAiAgent3:_setObject(pAiAgent)
-
-  return _localLuaAiAgent3
-end
-
-
-SceneObject = function(pSceneObject)
-  if (pSceneObject == nil) then
-    return nil
-  end
+-- Wrappers are cached per object pointer so every object keeps its own wrapper while a call
+-- runs, the numbered variants below are plain aliases kept for older screenplays. A wrapper
+-- holds a reference to its object, so releaseObjectWrappers() empties the caches and clears
+-- the wrappers once the call is over; keeping a wrapper past that is an error.
+local wrapperCaches = {}
 
-  _localLuaSceneObject:_setObject(pSceneObject)
+local function cachedWrapper(constructor)
+  local wrappers = {}
 
-  return _localLuaSceneObject
-end
-
-SceneObject1 = function(pSceneObject)
-  if (pSceneObject == nil) then
-    return nil
-  end
+  table.insert(wrapperCaches, wrappers)
 
-  _localLuaSceneObject1:_setObject(pSceneObject)
+  return function(pObject)
+    if (pObject == nil) then
+      return nil
+    end
 
-  return _localLuaSceneObject1
-end
+    local wrapper = wrappers[pObject]
 
-SceneObject2 = function(pSceneObject)
-  if (pSceneObject == nil) then
-    return nil
-  end
+    if (wrapper == nil) then
+      wrapper = constructor(nil)
+      wrapper:_setObject(pObject)
 
-  _localLuaSceneObject2:_setObject(pSceneObject)
+      wrappers[pObject] = wrapper
+    end
 
-  return _localLuaSceneObject2
-end
-
-SceneObject3 = function(pSceneObject)
-  if (pSceneObject == nil) then
-    return nil
+    return wrapper
   end
-
-  _localLuaSceneObject3:_setObject(pSceneObject)
-
-  return _localLuaSceneObject3
 end
 
-TangibleObject = function(pTangibleObject)
-  if (pTangibleObject == nil) then
-    return nil
-  end
-
-  _localLuaTangibleObject:_setObject(pTangibleObject)
+function releaseObjectWrappers()
+  for i = 1, #wrapperCaches do
+    local wrappers = wrapperCaches[i]
 
-  return _localLuaTangibleObject
-end
-
-TangibleObject1 = function(pTangibleObject)
-  if (pTangibleObject == nil) then
-    return nil
+    for pObject, wrapper in pairs(wrappers) do
+      wrapper:_setObject(nil)
+      wrappers[pObject] = nil
+    end
   end
-
-  _localLuaTangibleObject1:_setObject(pTangibleObject)
-
-  return _localLuaTangibleObject1
 end
 
-TangibleObject2 = function(pTangibleObject)
-  if (pTangibleObject == nil) then
-    return nil
-  end
+AiAgent = cachedWrapper(LuaAiAgent)
+AiAgent1 = AiAgent
+AiAgent2 = AiAgent
+AiAgent3 = AiAgent
 
-  _localLuaTangibleObject2:_setObject(pTangibleObject)
+SceneObject = cachedWrapper(LuaSceneObject)
+SceneObject1 = SceneObject
+SceneObject2 = SceneObject
+SceneObject3 = SceneObject
 
-  return _localLuaTangibleObject2
-end
+TangibleObject = cachedWrapper(LuaTangibleObject)
+TangibleObject1 = TangibleObject
+TangibleObject2 = TangibleObject
+TangibleObject3 = TangibleObject
 
-TangibleObject3 = function(pTangibleObject)
-  if (pTangibleObject == nil) then
-    return nil
-  end
-
-  _localLuaTangibleObject3:_setObject(pTangibleObject)
+CreatureObject = cachedWrapper(LuaCreatureObject)
+CreatureObject1 = CreatureObject
+CreatureObject2 = CreatureObject
+CreatureObject3 = CreatureObject
 
-  return _localLuaTangibleObject3
-end
-
-CreatureObject = function(pCreatureObject)
-  if (pCreatureObject == nil) then
-    return nil
-  end
-
-  _localLuaCreatureObject:_setObject(pCreatureObject)
-
-  return _localLuaCreatureObject
-end
-
-CreatureObject1 = function(pCreatureObject)
-  if (pCreatureObject == nil) then
-    return nil
-  end
-
-  _localLuaCreatureObject1:_setObject(pCreatureObject)
-
-  return _localLuaCreatureObject1
-end
-
-CreatureObject2 = function(pCreatureObject)
-  if (pCreatureObject == nil) then
-    return nil
-  end
-
-  _localLuaCreatureObject2:_setObject(pCreatureObject)
-
-  return _localLuaCreatureObject2
-end
-
-CreatureObject3 = function(pCreatureObject)
-  if (pCreatureObject == nil) then
-    return nil
-  end
-
-  _localLuaCreatureObject3:_setObject(pCreatureObject)
-
-  return _localLuaCreatureObject3
-end
-
-PlayerObject = function(pPlayerObject)
-  if (pPlayerObject == nil) then
-    return nil
-  end
-
-  _localLuaPlayerObject:_setObject(pPlayerObject)
-
-  return _localLuaPlayerObject
-end
-
-BuildingObject = function(pBuildingObject)
-  if (pBuildingObject == nil) then
-    return nil
-  end
-
-  _localLuaBuildingObject:_setObject(pBuildingObject)
-
-  return _localLuaBuildingObject
-end
-
-CityRegion = function(pCityRegion)
-  if (pCityRegion == nil) then
-    return nil
-  end
-
-  _localLuaCityRegion:_setObject(pCityRegion)
-
-  return _localLuaCityRegion
-end
-
-ActiveArea = function(pActiveArea)
-  if (pActiveArea == nil) then
-    return nil
-  end
-
-  _localLuaActiveArea:_setObject(pActiveArea)
-
-  return _localLuaActiveArea
-end
-
-WaypointObject = function(pWaypoint)
-  if (pWaypoint == nil) then
-    return nil
-  end
-
-  _localLuaWaypointObject:_setObject(pWaypoint)
-
-  return _localLuaWaypointObject
-end
+PlayerObject = cachedWrapper(LuaPlayerObject)
+BuildingObject = cachedWrapper(LuaBuildingObject)
+CityRegion = cachedWrapper(LuaCityRegion)
+ActiveArea = cachedWrapper(LuaActiveArea)
+WaypointObject = cachedWrapper(LuaWaypointObject)
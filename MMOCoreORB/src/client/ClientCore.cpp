@@ -8,9 +8,19 @@
 #include "ClientCore.h"
 
 #include "client/login/LoginSession.h"
+#include "client/swarm/BotSwarm.h"
 
 ClientCore::ClientCore(int instances) : Core("log/core3client.log", "client3"), Logger("CoreClient") {
 	ClientCore::instances = instances;
+	swarmMode = false;
+
+	setInfoLogLevel();
+}
+
+ClientCore::ClientCore(const Vector<String>& swarmArgs) : Core("log/core3client.log", "client3"), Logger("CoreClient") {
+	instances = 0;
+	swarmArguments = swarmArgs;
+	swarmMode = true;
 
 	setInfoLogLevel();
 }
@@ -22,6 +32,15 @@ void ClientCore::initialize() {
 int connectCount = 0, disconnectCount = 0;
 
 void ClientCore::run() {
+	if (swarmMode) {
+		BotSwarm swarm(swarmArguments);
+		swarm.run();
+
+		Thread::sleep(5000);
+
+		return;
+	}
+
 	for (int i = 0; i < instances; ++i) {
 		zones.add(nullptr);
 	}
@@ -175,6 +194,16 @@ int main(int argc, char* argv[]) {
 
 		StackTrace::setBinaryName("core3client");
 
+		if (arguments.size() > 0 && arguments.get(0) == "swarm") {
+			arguments.remove(0);
+
+			ClientCore core(arguments);
+
+			core.start();
+
+			return 0;
+		}
+
 		int instances = 1;
 
 		if (argc > 1)
@@ -12,10 +12,14 @@ class Zone;
 class ClientCore : public Core, public Logger {
 	int instances;
 
+	Vector<String> swarmArguments;
+	bool swarmMode;
+
 	Vector<Zone*> zones;
 
 public:
 	ClientCore(int instances);
+	ClientCore(const Vector<String>& swarmArgs);
 
 	void initialize();
 
@@ -103,6 +103,11 @@ void LoginPacketHandler::handleEnumerateCharacterId(Message* pack) {
 		loginSession->addCharacter(oid);
 	}
 
+	if (loginSession->isUnattended()) {
+		loginSession->setSelectedCharacter(0);
+		return;
+	}
+
 	client->info("please enter character to login... -1 to create a new one", true);
 
 	char characterID[32];
@@ -23,6 +23,13 @@ LoginSession::LoginSession(int instance) : Logger("LoginSession" + String::value
 	setLogging(true);
 }
 
+LoginSession::LoginSession(int instance, const String& user, const String& pass) : LoginSession(instance) {
+	username = user;
+	password = pass;
+
+	setLogging(false);
+}
+
 LoginSession::~LoginSession() {
 	if (loginThread != nullptr)
 		loginThread->stop();
@@ -49,39 +56,48 @@ void LoginSession::run() {
 	//TransactionalMemoryManager::commitPureTransaction();
 #endif
 
-	char userinput[32];
-	char passwordinput[32];
+	String user = username, pass = password;
 
-	info("insert user");
-	auto res = fgets(userinput, sizeof(userinput), stdin);
+	if (!isUnattended()) {
+		char userinput[32];
+		char passwordinput[32];
 
-	if (!res)
-		return;
+		info("insert user");
+		auto res = fgets(userinput, sizeof(userinput), stdin);
 
-	info("insert password", true);
-	res = fgets(passwordinput, sizeof(passwordinput), stdin);
+		if (!res)
+			return;
 
-	if (!res)
-		return;
+		info("insert password", true);
+		res = fgets(passwordinput, sizeof(passwordinput), stdin);
+
+		if (!res)
+			return;
 
-	String user, password;
-	user = userinput;
-	user = user.replaceFirst("\n", "");
+		user = userinput;
+		user = user.replaceFirst("\n", "");
 
-	password = passwordinput;
-	password = password.replaceFirst("\n", "");
+		pass = passwordinput;
+		pass = pass.replaceFirst("\n", "");
+	}
 
-	BaseMessage* acc = new AccountVersionMessage(user, password, "20050408-18:00");
+	BaseMessage* acc = new AccountVersionMessage(user, pass, "20050408-18:00");
 	login->sendMessage(acc);
 
 	info("sent account version message");
 
 	lock();
 
-	Time timeout;
-	timeout.addMiliTime(2000);
+	if (isUnattended()) {
+		// don't hang a swarm login slot on a lost packet
+		Time timeout;
+		timeout.addMiliTime(30000);
 
-	sessionFinalized.wait(this); //timedWait(this, &timeout);
+		if (sessionFinalized.timedWait(this, &timeout) != 0)
+			error("timed out waiting for character list");
+	} else {
+		sessionFinalized.wait(this);
+	}
 
 	unlock();
 
@@ -24,12 +24,17 @@ class LoginSession : public Mutex, public Runnable, public Logger, public Object
 
 	int instance;
 
+	// set for unattended logins (swarm bots), otherwise credentials are read from stdin
+	String username;
+	String password;
+
 	class LoginClientThread* loginThread;
 
 	Reference<LoginClient*> login;
 
 public:
 	LoginSession(int instance);
+	LoginSession(int instance, const String& user, const String& pass);
 
 	~LoginSession();
 
@@ -72,6 +77,10 @@ public:
 	uint64 getCharacterObjectID(uint32 id) {
 		return characterObjectIds.get(id);
 	}
+
+	bool isUnattended() const {
+		return !username.isEmpty();
+	}
 };
 
 
@@ -0,0 +1,331 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "BotController.h"
+#include "BotSwarm.h"
+#include "SwarmStats.h"
+
+#include "client/zone/Zone.h"
+#include "client/zone/managers/objectcontroller/ObjectController.h"
+
+class BotTickTask : public Task {
+	Reference<BotController*> bot;
+	int interval;
+
+	// held for the whole tick so stop() returns only once no tick runs anymore
+	Mutex tickMutex;
+	bool stopped;
+
+public:
+	BotTickTask(BotController* controller, int tickInterval) : bot(controller), interval(tickInterval), stopped(false) {
+		setCustomTaskQueue("SwarmBots");
+	}
+
+	void run() {
+		Locker locker(&tickMutex);
+
+		if (stopped)
+			return;
+
+		try {
+			bot->tick();
+		} catch (Exception& e) {
+			bot->error(e.getMessage());
+		}
+
+		reschedule(interval);
+	}
+
+	void stop() {
+		Locker locker(&tickMutex);
+
+		stopped = true;
+
+		if (isScheduled())
+			cancel();
+	}
+};
+
+BotController::BotController(BotSwarm* swarm, int index, int behavior, uint64 seed) :
+		Logger("Bot" + String::valueOf(index)), zone(nullptr), swarm(swarm), index(index), behavior(behavior),
+		inScene(false), anchorX(0), anchorY(0), targetX(0), targetY(0), sequence(0) {
+
+	// splitmix64 of the swarm seed and bot index, xorshift state must be non zero
+	uint64 z = seed + 0x9E3779B97F4A7C15ULL * (index + 1);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	randomState = (z ^ (z >> 31)) | 1;
+
+	pendingCommands.setNoDuplicateInsertPlan();
+	pendingChats.setNoDuplicateInsertPlan();
+	pendingSearches.setNoDuplicateInsertPlan();
+
+	setLogging(false);
+}
+
+BotController::~BotController() {
+	stop();
+}
+
+int BotController::getBehaviorType(const String& name) {
+	for (int i = 0; i < BEHAVIOR_TYPES; ++i) {
+		if (name == getBehaviorName(i))
+			return i;
+	}
+
+	return -1;
+}
+
+const char* BotController::getBehaviorName(int type) {
+	switch (type) {
+	case WANDER:
+		return "wander";
+	case FOLLOW:
+		return "follow";
+	case CHAT:
+		return "chat";
+	case COMBAT:
+		return "combat";
+	case BAZAAR:
+		return "bazaar";
+	default:
+		return "unknown";
+	}
+}
+
+uint32 BotController::nextRandom(uint32 max) {
+	randomState ^= randomState >> 12;
+	randomState ^= randomState << 25;
+	randomState ^= randomState >> 27;
+
+	uint64 value = randomState * 0x2545F4914F6CDD1DULL;
+
+	return max == 0 ? 0 : (uint32) ((value >> 32) % max);
+}
+
+float BotController::nextRandomFloat() {
+	return nextRandom(0x1000000) / (float) 0x1000000;
+}
+
+void BotController::addPending(VectorMap<uint32, uint64>& pending, uint32 key) {
+	Locker locker(&pendingMutex);
+
+	// drop stale requests the server never answered so the maps stay small
+	while (pending.size() > 64)
+		pending.remove(0);
+
+	pending.put(key, System::getMikroTime());
+}
+
+int64 BotController::removePending(VectorMap<uint32, uint64>& pending, uint32 key) {
+	Locker locker(&pendingMutex);
+
+	int idx = pending.find(key);
+
+	if (idx == -1)
+		return -1;
+
+	uint64 sent = pending.elementAt(idx).getValue();
+	pending.remove(idx);
+
+	return (System::getMikroTime() - sent) / 1000;
+}
+
+void BotController::onSceneStarted() {
+	PlayerCreature* player = zone->getSelfPlayer();
+
+	if (player != nullptr) {
+		anchorX = targetX = player->getPositionX();
+		anchorY = targetY = player->getPositionY();
+	}
+
+	SwarmStats::instance()->addLatency(SwarmStats::LOGIN, loginStartTime.miliDifference());
+	SwarmStats::instance()->onBotOnline();
+
+	inScene = true;
+
+	int interval = swarm->getTickInterval();
+
+	tickTask = new BotTickTask(this, interval);
+	tickTask->schedule(nextRandom(interval) + 1);
+}
+
+void BotController::stop() {
+	if (tickTask != nullptr) {
+		tickTask->stop();
+		tickTask = nullptr;
+	}
+
+	if (inScene) {
+		inScene = false;
+
+		SwarmStats::instance()->botsOnline.decrement();
+	}
+}
+
+void BotController::tick() {
+	if (!inScene || zone == nullptr || zone->getSelfPlayer() == nullptr)
+		return;
+
+	switch (behavior) {
+	case WANDER:
+		doWander();
+		break;
+	case FOLLOW:
+		doFollow();
+		break;
+	case CHAT:
+		doChat();
+		break;
+	case COMBAT:
+		doCombat();
+		break;
+	case BAZAAR:
+		doBazaar();
+		break;
+	}
+}
+
+void BotController::doWander() {
+	PlayerCreature* player = zone->getSelfPlayer();
+
+	Locker locker(player);
+
+	float x = player->getPositionX();
+	float z = player->getPositionZ();
+	float y = player->getPositionY();
+
+	float dx = targetX - x;
+	float dy = targetY - y;
+	float distance = Math::sqrt(dx * dx + dy * dy);
+
+	if (distance < 1.f) {
+		float radius = swarm->getWanderRadius();
+
+		targetX = anchorX + (nextRandomFloat() * 2.f - 1.f) * radius;
+		targetY = anchorY + (nextRandomFloat() * 2.f - 1.f) * radius;
+
+		return;
+	}
+
+	// run speed is 5.376 m/s, stay under it so the server does not bounce us back
+	float step = Math::min(distance, 5.f * swarm->getTickInterval() / 1000.f);
+
+	player->updatePosition(x + dx / distance * step, z, y + dy / distance * step);
+
+	SwarmStats::instance()->messagesSent.increment();
+}
+
+void BotController::doFollow() {
+	PlayerCreature* player = zone->getSelfPlayer();
+
+	const String& leader = swarm->getLeaderName();
+
+	if (leader.isEmpty() || player->getFollowObject() != nullptr) {
+		doWander();
+		return;
+	}
+
+	zone->follow(leader);
+}
+
+void BotController::doChat() {
+	uint32 seq = ++sequence;
+
+	addPending(pendingChats, seq);
+
+	StringBuffer msg;
+	msg << "swarm " << index << " " << seq;
+
+	zone->getObjectController()->doSayCommand(msg.toString());
+
+	SwarmStats::instance()->messagesSent.increment();
+}
+
+void BotController::doCombat() {
+	const Vector<String>& commands = swarm->getCombatCommands();
+
+	if (commands.size() == 0)
+		return;
+
+	const String& command = commands.get(nextRandom(commands.size()));
+
+	uint32 actionCount = zone->getObjectController()->doEnqueueCommand(command.hashCode(), "");
+
+	addPending(pendingCommands, actionCount);
+
+	SwarmStats::instance()->messagesSent.increment();
+}
+
+void BotController::doBazaar() {
+	uint64 terminal = swarm->getBazaarTerminal();
+
+	if (terminal == 0) {
+		doCombat();
+		return;
+	}
+
+	static const char* filters[] = { "", "rifle", "armor", "food", "crate" };
+
+	uint32 counter = ++sequence;
+
+	addPending(pendingSearches, counter);
+
+	// AuctionQueryHeadersMessage, see AuctionQueryHeadersMessageCallback::parse
+	BaseMessage* message = new BaseMessage();
+	message->insertShort(0x0E);
+	message->insertInt(0x679E0D00);
+	message->insertInt(nextRandom(3)); // galaxy, planet or region
+	message->insertInt(counter);
+	message->insertInt(2); // category search
+	message->insertInt(0); // all categories
+	message->insertInt(0);
+	message->insertUnicode(UnicodeString(filters[nextRandom(5)]));
+	message->insertInt(0);
+	message->insertInt(0);
+	message->insertInt(0);
+	message->insertByte(0);
+	message->insertLong(terminal);
+	message->insertByte(0);
+	message->insertShort(0);
+
+	zone->getZoneClient()->sendMessage(message);
+
+	SwarmStats::instance()->messagesSent.increment();
+}
+
+void BotController::onCommandQueueRemove(uint32 actionCount) {
+	int64 latency = removePending(pendingCommands, actionCount);
+
+	if (latency >= 0)
+		SwarmStats::instance()->addLatency(SwarmStats::COMMAND, latency);
+}
+
+void BotController::onSpatialChat(const UnicodeString& message) {
+	StringTokenizer tokenizer(message.toString());
+	tokenizer.setDelimeter(" ");
+
+	String marker;
+	tokenizer.getStringToken(marker);
+
+	if (marker != "swarm" || !tokenizer.hasMoreTokens())
+		return;
+
+	int sender = tokenizer.getIntToken();
+
+	if (sender != index || !tokenizer.hasMoreTokens())
+		return;
+
+	int64 latency = removePending(pendingChats, tokenizer.getIntToken());
+
+	if (latency >= 0)
+		SwarmStats::instance()->addLatency(SwarmStats::CHAT, latency);
+}
+
+void BotController::onAuctionQueryHeadersResponse(uint32 counter) {
+	int64 latency = removePending(pendingSearches, counter);
+
+	if (latency >= 0)
+		SwarmStats::instance()->addLatency(SwarmStats::BAZAAR, latency);
+}
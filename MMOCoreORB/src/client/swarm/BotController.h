@@ -0,0 +1,107 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef BOTCONTROLLER_H_
+#define BOTCONTROLLER_H_
+
+#include "engine/engine.h"
+
+class Zone;
+class BotSwarm;
+class BotTickTask;
+
+/**
+ * Drives one logged in swarm character. All random decisions come from a
+ * per bot generator seeded from the swarm seed, so two runs with the same
+ * seed issue the same sequence of actions.
+ */
+class BotController : public Object, public Logger {
+public:
+	enum {
+		WANDER,
+		FOLLOW,
+		CHAT,
+		COMBAT,
+		BAZAAR,
+		BEHAVIOR_TYPES
+	};
+
+protected:
+	Zone* zone;
+	BotSwarm* swarm;
+
+	int index;
+	int behavior;
+	uint64 randomState;
+
+	Time loginStartTime;
+	bool inScene;
+
+	float anchorX, anchorY;
+	float targetX, targetY;
+
+	uint32 sequence;
+
+	Mutex pendingMutex;
+	VectorMap<uint32, uint64> pendingCommands;
+	VectorMap<uint32, uint64> pendingChats;
+	VectorMap<uint32, uint64> pendingSearches;
+
+	Reference<BotTickTask*> tickTask;
+
+	uint32 nextRandom(uint32 max);
+	float nextRandomFloat();
+
+	void addPending(VectorMap<uint32, uint64>& pending, uint32 key);
+	int64 removePending(VectorMap<uint32, uint64>& pending, uint32 key);
+
+	void doWander();
+	void doFollow();
+	void doChat();
+	void doCombat();
+	void doBazaar();
+
+public:
+	BotController(BotSwarm* swarm, int index, int behavior, uint64 seed);
+	~BotController();
+
+	static int getBehaviorType(const String& name);
+	static const char* getBehaviorName(int type);
+
+	void setZone(Zone* zn) {
+		zone = zn;
+	}
+
+	Zone* getZone() const {
+		return zone;
+	}
+
+	int getIndex() const {
+		return index;
+	}
+
+	int getBehavior() const {
+		return behavior;
+	}
+
+	bool isInScene() const {
+		return inScene;
+	}
+
+	void tick();
+
+	void onLoginStarted() {
+		loginStartTime.updateToCurrentTime();
+	}
+
+	void stop();
+
+	// callbacks from the zone packet handlers
+	void onSceneStarted();
+	void onCommandQueueRemove(uint32 actionCount);
+	void onSpatialChat(const UnicodeString& message);
+	void onAuctionQueryHeadersResponse(uint32 counter);
+};
+
+#endif /* BOTCONTROLLER_H_ */
@@ -0,0 +1,232 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "BotSwarm.h"
+#include "BotController.h"
+#include "SwarmStats.h"
+
+#include "client/zone/Zone.h"
+#include "client/login/LoginSession.h"
+
+BotSwarm::BotSwarm(const Vector<String>& arguments) : Logger("BotSwarm") {
+	count = 10;
+	seed = 1;
+	accountPrefix = "swarm";
+	password = "swarm";
+	loginsPerSecond = 10;
+	storm = false;
+	playablePercent = 95;
+	duration = 300;
+	tickInterval = 1000;
+	reportInterval = 10;
+	wanderRadius = 32.f;
+	bazaarTerminal = 0;
+	reportFile = "log/swarm_report.txt";
+
+	for (int i = 0; i < arguments.size(); ++i) {
+		const String& argument = arguments.get(i);
+		int separator = argument.indexOf('=');
+
+		if (separator == -1) {
+			warning() << "ignoring argument " << argument << ", expected key=value";
+			continue;
+		}
+
+		parseOption(argument.subString(0, separator), argument.subString(separator + 1));
+	}
+
+	if (behaviors.size() == 0) {
+		behaviors.add(BotController::WANDER);
+		behaviors.add(BotController::CHAT);
+		behaviors.add(BotController::COMBAT);
+	}
+
+	if (combatCommands.size() == 0) {
+		combatCommands.add("attack");
+		combatCommands.add("peace");
+		combatCommands.add("stand");
+	}
+
+	setInfoLogLevel();
+}
+
+BotSwarm::~BotSwarm() {
+	for (int i = 0; i < bots.size(); ++i) {
+		BotController* bot = bots.get(i);
+
+		bot->stop();
+		bot->setZone(nullptr);
+	}
+
+	for (int i = 0; i < zones.size(); ++i) {
+		Zone* zone = zones.get(i);
+
+		if (zone != nullptr) {
+			zone->disconnect();
+
+			delete zone;
+		}
+	}
+}
+
+void BotSwarm::parseOption(const String& key, const String& value) {
+	if (key == "count") {
+		count = Integer::valueOf(value);
+	} else if (key == "seed") {
+		seed = UnsignedLong::valueOf(value);
+	} else if (key == "prefix") {
+		accountPrefix = value;
+	} else if (key == "password") {
+		password = value;
+	} else if (key == "rate") {
+		loginsPerSecond = Math::max(1, Integer::valueOf(value));
+	} else if (key == "storm") {
+		storm = Integer::valueOf(value) != 0;
+	} else if (key == "playable") {
+		playablePercent = Math::min(100, Math::max(1, Integer::valueOf(value)));
+	} else if (key == "duration") {
+		duration = Integer::valueOf(value);
+	} else if (key == "tick") {
+		tickInterval = Math::max(100, Integer::valueOf(value));
+	} else if (key == "report") {
+		reportInterval = Math::max(1, Integer::valueOf(value));
+	} else if (key == "radius") {
+		wanderRadius = Float::valueOf(value);
+	} else if (key == "leader") {
+		leaderName = value;
+	} else if (key == "bazaar") {
+		bazaarTerminal = UnsignedLong::valueOf(value);
+	} else if (key == "output") {
+		reportFile = value;
+	} else if (key == "behaviors" || key == "commands") {
+		StringTokenizer tokenizer(value);
+		tokenizer.setDelimeter(",");
+
+		while (tokenizer.hasMoreTokens()) {
+			String token;
+			tokenizer.getStringToken(token);
+
+			if (key == "commands") {
+				combatCommands.add(token);
+				continue;
+			}
+
+			int type = BotController::getBehaviorType(token);
+
+			if (type == -1)
+				warning() << "unknown behavior " << token;
+			else
+				behaviors.add(type);
+		}
+	} else {
+		warning() << "unknown option " << key;
+	}
+}
+
+void BotSwarm::loginBot(int index) {
+	Reference<BotController*> bot = bots.get(index);
+
+	String account = accountPrefix + String::valueOf(index);
+
+	bot->onLoginStarted();
+
+	Reference<LoginSession*> loginSession = new LoginSession(index, account, password);
+	loginSession->run();
+
+	if (loginSession->getAccountID() == 0) {
+		SwarmStats::instance()->loginFailures.increment();
+		error() << "login failed for " << account;
+		return;
+	}
+
+	uint64 objid = 0;
+	int selectedCharacter = loginSession->getSelectedCharacter();
+
+	if (selectedCharacter != -1)
+		objid = loginSession->getCharacterObjectID(selectedCharacter);
+
+	Zone* zone = new Zone(index, objid, loginSession->getAccountID(), loginSession->getSessionID());
+
+	// first names only take letters, encode the index in base 26
+	String name = "Swarm";
+	int remaining = index;
+
+	do {
+		name += (char) ('a' + remaining % 26);
+		remaining /= 26;
+	} while (remaining > 0);
+
+	zone->setCharacterName(name);
+	zone->setBotController(bot);
+
+	bot->setZone(zone);
+
+	zone->start();
+
+	zones.set(index, zone);
+}
+
+void BotSwarm::run() {
+	const static bool initialized = Core::getTaskManager()->initializeCustomQueue("SwarmLogin", 8)
+		&& Core::getTaskManager()->initializeCustomQueue("SwarmBots", 4);
+
+	StringBuffer behaviorNames;
+
+	for (int i = 0; i < behaviors.size(); ++i)
+		behaviorNames << (i == 0 ? "" : ",") << BotController::getBehaviorName(behaviors.get(i));
+
+	info(true) << "starting " << count << " bots, seed " << seed << ", behaviors " << behaviorNames
+		<< ", " << (storm ? String("login storm") : String::valueOf(loginsPerSecond) + " logins/s") << ", duration " << duration << "s";
+
+	// behaviors are assigned round robin so the mix only depends on count
+	for (int i = 0; i < count; ++i) {
+		bots.add(new BotController(this, i, behaviors.get(i % behaviors.size()), seed));
+		zones.add(nullptr);
+	}
+
+	SwarmStats* stats = SwarmStats::instance();
+	stats->playableTarget = Math::max(1, count * playablePercent / 100);
+	stats->startTime.updateToCurrentTime();
+
+	for (int i = 0; i < count; ++i) {
+		Core::getTaskManager()->executeTask([this, i] {
+			try {
+				loginBot(i);
+			} catch (Exception& e) {
+				SwarmStats::instance()->loginFailures.increment();
+				error() << "bot " << i << ": " << e.getMessage();
+			}
+		}, "SwarmLoginTask", "SwarmLogin");
+
+		if (!storm && (i + 1) % loginsPerSecond == 0)
+			Thread::sleep(1000);
+	}
+
+	Time lastReport;
+
+	while (stats->startTime.miliDifference() < (int64) duration * 1000) {
+		Thread::sleep(500);
+
+		if (lastReport.miliDifference() >= reportInterval * 1000) {
+			info(true) << stats->getReport();
+
+			lastReport.updateToCurrentTime();
+		}
+	}
+
+	for (int i = 0; i < bots.size(); ++i)
+		bots.get(i)->stop();
+
+	info(true) << "final: " << stats->getReport();
+
+	if (stats->playableTime.get() > 0)
+		info(true) << stats->playableTarget << " of " << count << " bots playable after " << stats->playableTime.get() << "ms";
+	else
+		info(true) << "only " << stats->botsOnline.get() << " of " << stats->playableTarget << " bots needed for playable got in";
+
+	if (stats->writeReport(reportFile))
+		info(true) << "report written to " << reportFile;
+	else
+		error() << "could not write report to " << reportFile;
+}
@@ -0,0 +1,76 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef BOTSWARM_H_
+#define BOTSWARM_H_
+
+#include "engine/engine.h"
+
+class Zone;
+class BotController;
+
+/**
+ * Headless load generator, logs in count accounts named <prefix><index>
+ * (AutoReg creates them) and drives each character with a behavior.
+ *
+ * core3client swarm count=500 seed=42 behaviors=wander,chat,combat duration=600
+ *
+ * storm=1 starts every login at once, like clients reconnecting after a
+ * restart, and the report shows how long it took until playable=<percent>
+ * of the bots were in their scene.
+ */
+class BotSwarm : public Logger {
+	int count;
+	uint64 seed;
+	String accountPrefix;
+	String password;
+	int loginsPerSecond;
+	bool storm;
+	int playablePercent;
+	int duration;
+	int tickInterval;
+	int reportInterval;
+	float wanderRadius;
+	String leaderName;
+	uint64 bazaarTerminal;
+	String reportFile;
+
+	Vector<int> behaviors;
+	Vector<String> combatCommands;
+
+	Vector<Reference<BotController*> > bots;
+	Vector<Zone*> zones;
+
+	void parseOption(const String& key, const String& value);
+
+	void loginBot(int index);
+
+public:
+	BotSwarm(const Vector<String>& arguments);
+	~BotSwarm();
+
+	void run();
+
+	inline int getTickInterval() const {
+		return tickInterval;
+	}
+
+	inline float getWanderRadius() const {
+		return wanderRadius;
+	}
+
+	inline const String& getLeaderName() const {
+		return leaderName;
+	}
+
+	inline uint64 getBazaarTerminal() const {
+		return bazaarTerminal;
+	}
+
+	inline const Vector<String>& getCombatCommands() const {
+		return combatCommands;
+	}
+};
+
+#endif /* BOTSWARM_H_ */
@@ -0,0 +1,86 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "SwarmStats.h"
+
+const char* SwarmStats::getLatencyName(int type) {
+	switch (type) {
+	case LOGIN:
+		return "login";
+	case COMMAND:
+		return "command";
+	case CHAT:
+		return "chat";
+	case BAZAAR:
+		return "bazaar";
+	default:
+		return "unknown";
+	}
+}
+
+String SwarmStats::getReport() const {
+	uint64 elapsed = Math::max((uint64) 1, (uint64) startTime.miliDifference() / 1000);
+
+	StringBuffer buf;
+	buf << "elapsed=" << elapsed << "s"
+		<< " online=" << botsOnline.get()
+		<< " loginFailures=" << loginFailures.get()
+		<< " queueNotices=" << loginQueueNotices.get()
+		<< " playable=" << (playableTime.get() > 0 ? String::valueOf(playableTime.get()) + "ms" : String("no"))
+		<< " sent=" << messagesSent.get()
+		<< " received=" << messagesReceived.get()
+		<< " bytes=" << bytesReceived.get()
+		<< " bytesPerSecond=" << bytesReceived.get() / elapsed
+		<< " bytesPerBotSecond=" << bytesReceived.get() / elapsed / Math::max(1, botsOnline.get());
+
+	for (int i = 0; i < LATENCY_TYPES; ++i) {
+		const SwarmLatency& latency = latencies[i];
+
+		if (latency.count.get() == 0)
+			continue;
+
+		buf << " " << getLatencyName(i) << "[n=" << latency.count.get()
+			<< " avg=" << latency.getAverage()
+			<< " p50=" << latency.getPercentile(0.5f)
+			<< " p99=" << latency.getPercentile(0.99f)
+			<< " max=" << latency.max.get() << "ms]";
+	}
+
+	return buf.toString();
+}
+
+bool SwarmStats::writeReport(const String& fileName) const {
+	File* file = new File(fileName);
+	FileWriter* writer = nullptr;
+
+	try {
+		writer = new FileWriter(file);
+
+		writer->writeLine(getReport());
+
+		for (int i = 0; i < LATENCY_TYPES; ++i) {
+			const SwarmLatency& latency = latencies[i];
+
+			StringBuffer line;
+			line << getLatencyName(i) << ".histogram_ms";
+
+			for (int j = 0; j < SwarmLatency::BUCKETS; ++j)
+				line << " " << (1 << j) << ":" << latency.histogram[j].get();
+
+			writer->writeLine(line.toString());
+		}
+
+		writer->close();
+	} catch (Exception& e) {
+		delete writer;
+		delete file;
+
+		return false;
+	}
+
+	delete writer;
+	delete file;
+
+	return true;
+}
@@ -0,0 +1,118 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SWARMSTATS_H_
+#define SWARMSTATS_H_
+
+#include "engine/engine.h"
+
+/**
+ * Round trip latency of one kind of request, log2 millisecond buckets.
+ */
+class SwarmLatency {
+public:
+	static const int BUCKETS = 16;
+
+	AtomicLong count;
+	AtomicLong total;
+	AtomicLong max;
+	AtomicLong histogram[BUCKETS];
+
+	void add(uint64 ms) {
+		count.increment();
+		total.add(ms);
+
+		if (ms > (uint64) max.get())
+			max.set(ms);
+
+		int bucket = 0;
+
+		while (ms > 1 && bucket < BUCKETS - 1) {
+			ms >>= 1;
+			++bucket;
+		}
+
+		histogram[bucket].increment();
+	}
+
+	uint64 getPercentile(float percentile) const {
+		uint64 samples = count.get();
+
+		if (samples == 0)
+			return 0;
+
+		uint64 target = (uint64) (samples * percentile);
+		uint64 accumulated = 0;
+
+		for (int i = 0; i < BUCKETS; ++i) {
+			accumulated += histogram[i].get();
+
+			if (accumulated > target)
+				return 1ULL << (i + 1);
+		}
+
+		return 1ULL << BUCKETS;
+	}
+
+	uint64 getAverage() const {
+		uint64 samples = count.get();
+
+		return samples == 0 ? 0 : total.get() / samples;
+	}
+};
+
+class SwarmStats : public Singleton<SwarmStats>, public Logger, public Object {
+public:
+	enum {
+		LOGIN,
+		COMMAND,
+		CHAT,
+		BAZAAR,
+		LATENCY_TYPES
+	};
+
+	SwarmLatency latencies[LATENCY_TYPES];
+
+	AtomicLong bytesReceived;
+	AtomicLong packetsReceived;
+	AtomicLong messagesReceived;
+	AtomicLong messagesSent;
+
+	AtomicInteger botsOnline;
+	AtomicInteger loginFailures;
+	AtomicInteger loginQueueNotices;
+
+	// ms from start until playableTarget bots were in their scene, 0 until then
+	AtomicLong playableTime;
+	int playableTarget;
+
+	Time startTime;
+
+	SwarmStats() : Logger("SwarmStats"), playableTarget(0) {
+	}
+
+	void onBotOnline() {
+		int online = botsOnline.increment();
+
+		if (playableTarget > 0 && online >= playableTarget && playableTime.get() == 0)
+			playableTime.set(Math::max((uint64) 1, (uint64) startTime.miliDifference()));
+	}
+
+	static const char* getLatencyName(int type);
+
+	void addLatency(int type, uint64 ms) {
+		latencies[type].add(ms);
+	}
+
+	void addReceived(uint32 bytes) {
+		bytesReceived.add(bytes);
+		packetsReceived.increment();
+	}
+
+	String getReport() const;
+
+	bool writeReport(const String& fileName) const;
+};
+
+#endif /* SWARMSTATS_H_ */
@@ -5,6 +5,7 @@
 #include "server/zone/packets/zone/ClientIDMessage.h"
 #include "client/zone/managers/objectcontroller/ObjectController.h"
 #include "client/zone/managers/object/ObjectManager.h"
+#include "client/swarm/BotController.h"
 
 int Zone::createdChar = 0;
 
@@ -116,7 +117,13 @@ void Zone::disconnect() {
 }
 
 void Zone::sceneStarted() {
-	client->getClient()->info("zone started in " + String::valueOf(startTime.miliDifference()) + "ms", true);
+	if (botController != nullptr) {
+		client->getClient()->info("zone started in " + String::valueOf(startTime.miliDifference()) + "ms");
+
+		botController->onSceneStarted();
+	} else {
+		client->getClient()->info("zone started in " + String::valueOf(startTime.miliDifference()) + "ms", true);
+	}
 }
 
 void Zone::follow(const String& name) {
@@ -11,6 +11,7 @@
 class ZoneClientThread;
 class ObjectController;
 class ObjectManager;
+class BotController;
 
 class Zone : public Thread, public Mutex, public Logger {
 	//LoginSession* loginSession;
@@ -39,6 +40,9 @@ class Zone : public Thread, public Mutex, public Logger {
 	Time startTime;
 	bool started;
 
+	String characterName;
+	Reference<BotController*> botController;
+
 public:
 	Zone(int instance, uint64 characterObjectID, uint32 account, uint32 session);
 	~Zone();
@@ -117,6 +121,22 @@ public:
 	bool isStarted() {
 		return started;
 	}
+
+	void setCharacterName(const String& name) {
+		characterName = name;
+	}
+
+	const String& getCharacterName() const {
+		return characterName;
+	}
+
+	void setBotController(BotController* bot) {
+		botController = bot;
+	}
+
+	BotController* getBotController() {
+		return botController;
+	}
 };
 
 #endif /* ZONE_H_ */
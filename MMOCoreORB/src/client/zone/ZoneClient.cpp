@@ -3,8 +3,10 @@
 		See file COPYING for copying conditions.*/
 
 #include "ZoneClient.h"
+#include "Zone.h"
 #include "ZonePacketHandler.h"
 #include "ZoneMessageProcessorTask.h"
+#include "client/swarm/SwarmStats.h"
 
 ZoneClient::ZoneClient(int port) {
 	client = new BaseClient("localhost", port);
@@ -35,6 +37,9 @@ ZoneClient::~ZoneClient() {
 }
 
 void ZoneClient::handleMessage(ServiceClient* client, Packet* message) {
+	if (zone != nullptr && zone->getBotController() != nullptr)
+		SwarmStats::instance()->addReceived(message->size());
+
 	basePacketHandler->handlePacket(ZoneClient::client, message);
 }
 
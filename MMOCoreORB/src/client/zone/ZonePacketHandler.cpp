@@ -5,6 +5,8 @@
 #include "client/zone/managers/object/ObjectManager.h"
 #include "client/zone/managers/objectcontroller/ObjectController.h"
 #include "server/zone/packets/charcreation/ClientCreateCharacter.h"
+#include "client/swarm/BotController.h"
+#include "client/swarm/SwarmStats.h"
 
 ZonePacketHandler::ZonePacketHandler(const String& s, Zone * z) : Logger(s) {
 	zone = z;
@@ -19,6 +21,9 @@ void ZonePacketHandler::handleMessage(Message* pack) {
 	sys::uint16 opcount = pack->parseShort();
 	sys::uint32 opcode = pack->parseInt();
 
+	if (zone->getBotController() != nullptr)
+		SwarmStats::instance()->messagesReceived.increment();
+
 	switch (opcount) {
 	case 02:
 		switch (opcode) {
@@ -38,6 +43,10 @@ void ZonePacketHandler::handleMessage(Message* pack) {
 			handleSceneObejctDestroyMessage(pack);
 			break;
 
+		case 0xB5ABF91A: // error message
+			handleErrorMessage(pack);
+			break;
+
 		}
 		break;
 
@@ -81,6 +90,10 @@ void ZonePacketHandler::handleMessage(Message* pack) {
 		case 0x1B24F808: // update transform message
 			handleUpdateTransformMessage(pack);
 			break;
+
+		case 0xFA500E52: // auction query headers response
+			handleAuctionQueryHeadersResponseMessage(pack);
+			break;
 		}
 		break;
 	case 9:
@@ -106,12 +119,16 @@ void ZonePacketHandler::handleClientPermissionsMessage(Message* pack) {
 
 		client->info("creating new character");
 
-		String name = "character";
-		name += ('a' + System::random(22));
-		name += ('a' + System::random(22));
-		name += ('a' + System::random(22));
-		name += ('a' + System::random(22));
-		name += ('a' + System::random(22));
+		String name = zone->getCharacterName();
+
+		if (name.isEmpty()) {
+			name = "character";
+			name += ('a' + System::random(22));
+			name += ('a' + System::random(22));
+			name += ('a' + System::random(22));
+			name += ('a' + System::random(22));
+			name += ('a' + System::random(22));
+		}
 
 		client->info("name " + name);
 
@@ -298,6 +315,20 @@ void ZonePacketHandler::handleChatInstantMessageToClient(Message* pack) {
 	client->info(infoMsg.toString());
 }
 
+void ZonePacketHandler::handleErrorMessage(Message* pack) {
+	BaseClient* client = (BaseClient*) pack->getClient();
+
+	String errorType, errorMessage;
+
+	pack->parseAscii(errorType);
+	pack->parseAscii(errorMessage);
+
+	if (errorType == "Login Queue" && zone->getBotController() != nullptr)
+		SwarmStats::instance()->loginQueueNotices.increment();
+
+	client->info(errorType + " : " + errorMessage);
+}
+
 void ZonePacketHandler::handleChatSystemMessage(Message* pack) {
 	BaseClient* client = (BaseClient*) pack->getClient();
 
@@ -358,3 +389,12 @@ void ZonePacketHandler::handleUpdateContainmentMessage(Message* pack) {
 
 	parent->transferObject(object, type);
 }
+
+void ZonePacketHandler::handleAuctionQueryHeadersResponseMessage(Message* pack) {
+	uint32 counter = pack->parseInt();
+
+	BotController* bot = zone->getBotController();
+
+	if (bot != nullptr)
+		bot->onAuctionQueryHeadersResponse(counter);
+}
@@ -27,10 +27,12 @@ public:
 	void handleBaselineMessage(Message* pack);
 	void handleChatInstantMessageToClient(Message* pack);
 	void handleChatSystemMessage(Message* pack);
+	void handleErrorMessage(Message* pack);
 	void handleObjectControllerMessage(Message* pack);
 	void handleUpdateContainmentMessage(Message* pack);
 	void handleSceneObejctDestroyMessage(Message* pack);
 	void handleClientPermissionsMessage(Message* pack);
+	void handleAuctionQueryHeadersResponseMessage(Message* pack);
 
 };
 
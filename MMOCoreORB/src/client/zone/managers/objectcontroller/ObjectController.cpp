@@ -9,6 +9,7 @@
 
 #include "client/zone/Zone.h"
 #include "client/zone/objects/scene/SceneObject.h"
+#include "client/swarm/BotController.h"
 
 #include "server/zone/packets/object/ObjectControllerMessage.h"
 
@@ -23,6 +24,10 @@ void ObjectController::handleObjectController(SceneObject* object, uint32 header
 		handleSpatialChat(object, pack);
 		break;
 
+	case 0x117:
+		handleCommandQueueRemove(object, pack);
+		break;
+
 	default:
 		break;
 	}
@@ -35,12 +40,30 @@ void ObjectController::handleSpatialChat(SceneObject* object, Message* pack) {
 	UnicodeString message;
 	pack->parseUnicode(message);
 
+	BotController* bot = zone->getBotController();
+
+	if (bot != nullptr) {
+		if (sender == zone->getCharacterID())
+			bot->onSpatialChat(message);
+
+		return;
+	}
+
 	SceneObject* senderObject = zone->getObject(sender);
 
 	if (senderObject != nullptr)
 		senderObject->info("says " + message.toString(), true);
 }
 
+void ObjectController::handleCommandQueueRemove(SceneObject* object, Message* pack) {
+	uint32 actionCount = pack->parseInt();
+
+	BotController* bot = zone->getBotController();
+
+	if (bot != nullptr)
+		bot->onCommandQueueRemove(actionCount);
+}
+
 bool ObjectController::doCommand(uint32 crc, const UnicodeString& arguments) {
 	switch (crc) {
 	case 0x6bc77878: // STRING_HASHCODE("say");
@@ -56,19 +79,23 @@ bool ObjectController::doCommand(uint32 crc, const UnicodeString& arguments) {
 	return true;
 }
 
-void ObjectController::doEnqueueCommand(uint32 command, const UnicodeString& arguments) {
+uint32 ObjectController::doEnqueueCommand(uint32 command, const UnicodeString& arguments) {
 	PlayerCreature* object = zone->getSelfPlayer();
 
 	Locker _locker(object);
 
 	BaseMessage* message = new ObjectControllerMessage(object->getObjectID(), 0x23, 0x116);
 
-	message->insertInt(object->getNewActionCount());
+	uint32 actionCount = object->getNewActionCount();
+
+	message->insertInt(actionCount);
 	message->insertInt(command);
 	message->insertLong(0);
 	message->insertUnicode(arguments);
 
 	object->getClient()->sendMessage(message);
+
+	return actionCount;
 }
 
 void ObjectController::doSayCommand(const UnicodeString& msg) {
@@ -22,11 +22,12 @@ public:
 	void handleObjectController(SceneObject* object, uint32 header1, uint32 header2, Message* pack);
 
 	void handleSpatialChat(SceneObject* object, Message* pack);
+	void handleCommandQueueRemove(SceneObject* object, Message* pack);
 
 	bool doCommand(uint32 crc, const UnicodeString& arguments);
 
 	void doSayCommand(const UnicodeString& msg);
-	void doEnqueueCommand(uint32 command, const UnicodeString& arguments);
+	uint32 doEnqueueCommand(uint32 command, const UnicodeString& arguments);
 
 	inline void setZone(Zone* zon) {
 		zone = zon;
@@ -7,6 +7,8 @@
 
 using namespace sys::thread;
 
+std::atomic<ConfigSnapshot*> ConfigSnapshot::current(nullptr);
+
 ConfigManager::ConfigManager() {
 	setLoggingName("ConfigManager");
 #ifdef DEBUG_CONFIGMANAGER
@@ -18,9 +20,20 @@ ConfigManager::ConfigManager() {
 
 ConfigManager::~ConfigManager() {
 	clearConfigData();
+
+	for (int i = 0; i < replacedItems.size(); ++i)
+		delete replacedItems.getUnsafe(i);
+
+	for (int i = 0; i < retiredSnapshots.size(); ++i)
+		delete retiredSnapshots.getUnsafe(i);
+
+	for (int i = 0; i < changeListeners.size(); ++i)
+		delete changeListeners.getUnsafe(i);
+
+	delete ConfigSnapshot::current.exchange(nullptr);
 }
 
-bool ConfigManager::loadConfigData() {
+bool ConfigManager::loadConfigData(bool reload) {
 	Locker guard(&mutex);
 
 	logChanges = false;
@@ -31,6 +44,11 @@ bool ConfigManager::loadConfigData() {
 	configStartTime.start();
 
 	if (!lua.runFile("conf/config.lua")) {
+		if (reload) {
+			error("ConfigManager failed to parse conf/config.lua, keeping the current configuration");
+			return false;
+		}
+
 		fatal("ConfigManager failed to parse conf/config.lua");
 		return false;
 	}
@@ -52,6 +70,9 @@ bool ConfigManager::loadConfigData() {
 
 	bool resultGlobal, resultCore3;
 
+	// a single snapshot for the whole file instead of one per key
+	++publishDeferred;
+
 	clearConfigData();
 
 	// Load new-style "Core3.value" settings
@@ -89,20 +110,176 @@ bool ConfigManager::loadConfigData() {
 
 	logChanges = true;
 
+	--publishDeferred;
+
+	publishSnapshot();
+
+	changedKeys.removeAll();
+
 	return resultGlobal || resultCore3;
 }
 
+int ConfigManager::reloadConfigData() {
+	Locker guard(&mutex);
+
+	VectorMap<String, String> previous;
+	previous.setNoDuplicateInsertPlan();
+
+	for (int i = 0; i < configData.size(); ++i) {
+		auto entry = configData.elementAt(i);
+
+		previous.put(entry.getKey(), entry.getValue()->toString());
+	}
+
+	if (!loadConfigData(true))
+		return -1;
+
+	for (int i = 0; i < configData.size(); ++i) {
+		auto entry = configData.elementAt(i);
+
+		int pos = previous.find(entry.getKey());
+
+		if (pos == -1 || previous.elementAt(pos).getValue() != entry.getValue()->toString())
+			changedKeys.put(entry.getKey());
+	}
+
+	for (int i = 0; i < previous.size(); ++i) {
+		const String& key = previous.elementAt(i).getKey();
+
+		if (!contains(key))
+			changedKeys.put(key);
+	}
+
+	int changes = changedKeys.size();
+
+	info(true) << "Configuration reloaded, version " << getConfigVersion() << ", " << changes << " keys changed";
+
+	guard.release();
+
+	dispatchChangeNotifications();
+
+	return changes;
+}
+
 void ConfigManager::clearConfigData() {
 	Locker guard(&mutex);
 
+	// references handed out by getString stay valid until the current snapshot is retired
 	for (int i = 0; i < configData.size(); ++i) {
 		auto entry = configData.getUnsafe(i).getValue();
-		delete entry;
+		replacedItems.add(entry);
 	}
 
 	configData.removeAll();
 	configData.setNoDuplicateInsertPlan();
 	incrementConfigVersion();
+
+	publishSnapshot();
+}
+
+int ConfigManager::registerHandle(const String& key, const ConfigSnapshotValue& defaultValue) {
+	Locker guard(&mutex);
+
+	int slot = handleKeys.size();
+
+	handleKeys.add(key);
+	handleDefaults.add(defaultValue);
+
+	publishSnapshot();
+
+	return slot;
+}
+
+void ConfigManager::publishSnapshot() {
+	if (publishDeferred > 0)
+		return;
+
+	ConfigSnapshot* snapshot = new ConfigSnapshot();
+	snapshot->version = configVersion.get();
+
+	for (int i = 0; i < handleKeys.size(); ++i) {
+		ConfigDataItem* itm = findItem(handleKeys.getUnsafe(i));
+
+		if (itm != nullptr)
+			snapshot->values.add(ConfigSnapshotValue(itm));
+		else
+			snapshot->values.add(handleDefaults.getUnsafe(i));
+	}
+
+	ConfigSnapshot* previous = ConfigSnapshot::current.exchange(snapshot, std::memory_order_acq_rel);
+
+	if (previous == nullptr)
+		return;
+
+	uint64 now = System::getMiliTime();
+
+	previous->retireTime = now;
+
+	for (int i = 0; i < replacedItems.size(); ++i)
+		previous->retiredItems.add(replacedItems.getUnsafe(i));
+
+	replacedItems.removeAll();
+
+	for (int i = retiredSnapshots.size() - 1; i >= 0; --i) {
+		ConfigSnapshot* retired = retiredSnapshots.getUnsafe(i);
+
+		if (now - retired->retireTime > SNAPSHOT_GRACE_MS) {
+			retiredSnapshots.remove(i);
+			delete retired;
+		}
+	}
+
+	retiredSnapshots.add(previous);
+}
+
+int ConfigManager::addChangeListener(const String& prefix, const Function<void()>& callback) {
+	Locker guard(&listenerMutex);
+
+	int id = nextListenerId++;
+
+	changeListeners.add(new ConfigChangeListener(id, prefix, callback));
+
+	return id;
+}
+
+void ConfigManager::removeChangeListener(int id) {
+	Locker guard(&listenerMutex);
+
+	for (int i = 0; i < changeListeners.size(); ++i) {
+		ConfigChangeListener* listener = changeListeners.getUnsafe(i);
+
+		if (listener->id == id) {
+			changeListeners.remove(i);
+			delete listener;
+
+			return;
+		}
+	}
+}
+
+void ConfigManager::dispatchChangeNotifications() {
+	Locker guard(&mutex);
+
+	SortedVector<String> changes = changedKeys;
+	changedKeys.removeAll();
+
+	guard.release();
+
+	if (changes.size() == 0)
+		return;
+
+	Locker listenerGuard(&listenerMutex);
+
+	for (int i = 0; i < changeListeners.size(); ++i) {
+		ConfigChangeListener* listener = changeListeners.getUnsafe(i);
+
+		for (int j = 0; j < changes.size(); ++j) {
+			if (changes.getUnsafe(j).beginsWith(listener->prefix)) {
+				listener->callback();
+				break;
+			}
+		}
+	}
 }
 
 void ConfigManager::dumpConfig(bool includeSecure) {
@@ -396,8 +573,12 @@ bool ConfigManager::parseConfigJSONRecursive(const String prefix, JSONSerializat
 bool ConfigManager::parseConfigJSON(const JSONSerializationType jsonData, String& errorMessage, bool updateOnly) {
 	Locker guard(&mutex);
 
+	bool result = false;
+
+	++publishDeferred;
+
 	try {
-		return parseConfigJSONRecursive("", jsonData, errorMessage, updateOnly);
+		result = parseConfigJSONRecursive("", jsonData, errorMessage, updateOnly);
 	} catch (const JSONSerializationType::exception& e) {
 		errorMessage = "Exception while parsing json:" + String(e.what()) + "(" + e.id + ")";
 		error() << "parseConfigJSON: " << errorMessage;
@@ -415,15 +596,23 @@ bool ConfigManager::parseConfigJSON(const JSONSerializationType jsonData, String
 		error() << "parseConfigJSON: " << errorMessage;
 	}
 
-	return false;
+	--publishDeferred;
+
+	publishSnapshot();
+
+	return result;
 }
 
 bool ConfigManager::parseConfigJSON(const String& jsonString, String& errorMessage, bool updateOnly) {
 	Locker guard(&mutex);
 
+	bool result = false;
+
+	++publishDeferred;
+
 	try {
 		JSONSerializationType jsonData = JSONSerializationType::parse(jsonString);
-		return parseConfigJSONRecursive("", jsonData, errorMessage, updateOnly);
+		result = parseConfigJSONRecursive("", jsonData, errorMessage, updateOnly);
 	} catch (const JSONSerializationType::exception& e) {
 		errorMessage = "Exception while parsing json:" + String(e.what()) + "(" + e.id + ")";
 		error() << "parseConfigJSON(" << jsonString << "): " << errorMessage;
@@ -441,7 +630,11 @@ bool ConfigManager::parseConfigJSON(const String& jsonString, String& errorMessa
 		error() << "parseConfigJSON(" << jsonString << "): " << errorMessage;
 	}
 
-	return false;
+	--publishDeferred;
+
+	publishSnapshot();
+
+	return result;
 }
 
 bool ConfigManager::contains(const String& name) const {
@@ -502,6 +695,16 @@ float ConfigManager::getFloat(const String& name, float defaultValue) {
 }
 
 const String& ConfigManager::getString(const String& name, const String& defaultValue) {
+	// replaced items are retired with their snapshot, so the reference outlives the lock
+	{
+		ReadLocker guard(&mutex);
+
+		ConfigDataItem* itm = findItem(name);
+
+		if (itm != nullptr)
+			return itm->getString();
+	}
+
 	Locker guard(&mutex);
 
 	ConfigDataItem* itm = findItem(name);
@@ -611,8 +814,14 @@ bool ConfigManager::updateItem(const String& name, ConfigDataItem* newItem) {
 	if (pos != -1) {
 		ConfigDataItem* oldItem = configData.get(pos);
 		configData.drop(name);
-		delete oldItem;
+
+		if (oldItem->toString() != newItem->toString())
+			changedKeys.put(name);
+
+		replacedItems.add(oldItem);
 		oldItem = nullptr;
+	} else {
+		changedKeys.put(name);
 	}
 
 	if (logChanges) {
@@ -630,6 +839,7 @@ bool ConfigManager::updateItem(const String& name, ConfigDataItem* newItem) {
 
 	configData.put(std::move(name), std::move(newItem));
 	incrementConfigVersion();
+	publishSnapshot();
 	return true;
 }
 
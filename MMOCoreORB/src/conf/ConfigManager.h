@@ -9,6 +9,8 @@
 
 #include "engine/engine.h"
 
+#include <atomic>
+
 namespace conf {
 
 	class ConfigDataItem {
@@ -43,6 +45,11 @@ namespace conf {
 			return (float)asNumber;
 		}
 
+		inline lua_Number getNumber() const {
+			usageCounter.increment();
+			return asNumber;
+		}
+
 		inline int getInt() const {
 			usageCounter.increment();
 			return (int)asNumber;
@@ -168,7 +175,110 @@ namespace conf {
 #endif // DEBUG_CONFIGMANAGER
 	};
 
+	class ConfigSnapshotValue {
+	public:
+		lua_Number number;
+		bool asBool;
+		String string;
+
+		ConfigSnapshotValue() : number(0), asBool(false) {
+		}
+
+		ConfigSnapshotValue(int value) : number(value), asBool(value != 0), string(String::valueOf(value)) {
+		}
+
+		ConfigSnapshotValue(bool value) : number(value ? 1 : 0), asBool(value), string(value ? "true" : "false") {
+		}
+
+		ConfigSnapshotValue(float value) : number(value), asBool(value != 0), string(String::valueOf(value)) {
+		}
+
+		ConfigSnapshotValue(const String& value) : number(atof(value.toCharArray())), asBool(value == "true" || number != 0), string(value) {
+		}
+
+		ConfigSnapshotValue(const ConfigDataItem* item) : number(item->getNumber()), asBool(item->getBool()), string(item->getString()) {
+		}
+
+		template<class T>
+		T get() const;
+	};
+
+	template<>
+	inline int ConfigSnapshotValue::get<int>() const {
+		return (int)number;
+	}
+
+	template<>
+	inline bool ConfigSnapshotValue::get<bool>() const {
+		return asBool;
+	}
+
+	template<>
+	inline float ConfigSnapshotValue::get<float>() const {
+		return (float)number;
+	}
+
+	template<>
+	inline String ConfigSnapshotValue::get<String>() const {
+		return string;
+	}
+
+	/**
+	 * Values of every registered ConfigHandle at one config version. A snapshot is never
+	 * modified once published, a replaced one is kept for SNAPSHOT_GRACE_MS before it is
+	 * deleted so readers that loaded the old pointer can finish with it.
+	 */
+	class ConfigSnapshot {
+	public:
+		int version;
+		uint64 retireTime;
+
+		Vector<ConfigSnapshotValue> values;
+
+		// items replaced while this snapshot was current, references from getString may still point at them
+		Vector<ConfigDataItem*> retiredItems;
+
+		ConfigSnapshot() : version(0), retireTime(0) {
+		}
+
+		~ConfigSnapshot() {
+			for (int i = 0; i < retiredItems.size(); ++i)
+				delete retiredItems.getUnsafe(i);
+		}
+
+		static std::atomic<ConfigSnapshot*> current;
+	};
+
+	/**
+	 * Typed config value registered once, usually as a function local static. Reading it
+	 * costs a load of the current snapshot pointer and follows reloads and set* calls.
+	 */
+	template<class T>
+	class ConfigHandle {
+		int slot;
+
+	public:
+		ConfigHandle(const String& key, const T& defaultValue);
+
+		inline T get() const {
+			return ConfigSnapshot::current.load(std::memory_order_acquire)->values.getUnsafe(slot).template get<T>();
+		}
+	};
+
+	class ConfigChangeListener {
+	public:
+		int id;
+		String prefix;
+		Function<void()> callback;
+
+		ConfigChangeListener(int id, const String& prefix, const Function<void()>& callback) : id(id), prefix(prefix), callback(callback) {
+		}
+	};
+
 	class ConfigManager : public Singleton<ConfigManager>, public Object, public Logger {
+	public:
+		static const uint64 SNAPSHOT_GRACE_MS = 10000;
+
 	protected:
 		Lua lua;
 
@@ -182,10 +292,26 @@ namespace conf {
 
 		ReadWriteLock mutex;
 
+		// handle slots, every snapshot has a value for each of them
+		Vector<String> handleKeys;
+		Vector<ConfigSnapshotValue> handleDefaults;
+
+		Vector<ConfigSnapshot*> retiredSnapshots;
+		Vector<ConfigDataItem*> replacedItems;
+		int publishDeferred = 0;
+
+		SortedVector<String> changedKeys;
+
+		Vector<ConfigChangeListener*> changeListeners;
+		Mutex listenerMutex;
+		int nextListenerId = 1;
+
 	private:
 		ConfigDataItem* findItem(const String& name) const;
 		bool updateItem(const String& name, ConfigDataItem* newItem);
 
+		void publishSnapshot();
+
 		bool parseConfigData(const String& prefix, bool isGlobal = false, int maxDepth = 5);
 		bool parseConfigJSONRecursive(const String prefix, JSONSerializationType jsonNode, String& errorMessage, bool updateOnly = true);
 		void writeJSONPath(StringTokenizer& tokens, JSONSerializationType& jsonData, const JSONSerializationType& jsonValue);
@@ -199,8 +325,25 @@ namespace conf {
 		ConfigManager();
 		~ConfigManager();
 
-		bool loadConfigData();
+		bool loadConfigData(bool reload = false);
 		void clearConfigData();
+
+		/**
+		 * Parses the config files again and publishes them as a new snapshot, returns the
+		 * number of keys that changed or -1 when the files could not be parsed
+		 */
+		int reloadConfigData();
+
+		/**
+		 * Calls the listeners whose prefix matches a key changed since the last dispatch,
+		 * listeners must not add or remove listeners
+		 */
+		void dispatchChangeNotifications();
+
+		int addChangeListener(const String& prefix, const Function<void()>& callback);
+		void removeChangeListener(int id);
+
+		int registerHandle(const String& key, const ConfigSnapshotValue& defaultValue);
 		void cacheHotItems();
 		bool parseConfigJSON(const String& jsonString, String& errorMessage, bool updateOnly = true);
 		bool parseConfigJSON(const JSONSerializationType jsonData, String& errorMessage, bool updateOnly = true);
@@ -256,47 +399,25 @@ namespace conf {
 		}
 
 		inline bool shouldUnloadContainers() {
-			// Use cached value as this is called often
-			static uint32 cachedVersion = 0;
-			static bool cachedUnloadContainers;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedUnloadContainers = getBool("Core3.UnloadContainers", true);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> handle("Core3.UnloadContainers", true);
 
-			return cachedUnloadContainers;
+			return handle.get();
 		}
 
 		inline bool shouldUseMetrics() {
 			// On Basilisk this is called 400/s
-			static uint32 cachedVersion = 0;
-			static bool cachedUseMetrics;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedUseMetrics = getBool("Core3.UseMetrics", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> handle("Core3.UseMetrics", false);
 
-			return cachedUseMetrics;
+			return handle.get();
 		}
 
 		inline bool getPvpMode() {
-			// Use cached value as this is a hot item called in:
+			// Hot item called in:
 			//   CreatureObjectImplementation::isAttackableBy
 			//   CreatureObjectImplementation::isAggressiveTo
-			static uint32 cachedVersion = 0;
-			static bool cachedPvpMode;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedPvpMode = getBool("Core3.PvpMode", false);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<bool> handle("Core3.PvpMode", false);
 
-			return cachedPvpMode;
+			return handle.get();
 		}
 
 		inline bool setPvpMode(bool val) {
@@ -316,17 +437,10 @@ namespace conf {
 		}
 
 		inline bool isProgressMonitorActivated() {
-			// Use cached value as this a hot item called in lots of loops
-			static uint32 cachedVersion = 0;
-			static bool cachedProgressMonitors;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedProgressMonitors = getBool("Core3.ProgressMonitors", false);
-				cachedVersion = configVersion.get();
-			}
+			// Hot item called in lots of loops
+			static ConfigHandle<bool> handle("Core3.ProgressMonitors", false);
 
-			return cachedProgressMonitors;
+			return handle.get();
 		}
 
 		inline int getDBPort() {
@@ -462,7 +576,10 @@ namespace conf {
 		}
 
 		inline int getPurgeDeletedCharacters() {
-			return getInt("Core3.PurgeDeletedCharacters", 10); // In minutes
+			// In minutes
+			static ConfigHandle<int> handle("Core3.PurgeDeletedCharacters", 10);
+
+			return handle.get();
 		}
 
 		inline int getMaxNavMeshJobs() {
@@ -498,7 +615,9 @@ namespace conf {
 		}
 
 		inline int getTermsOfServiceVersion() {
-			return getInt("Core3.TermsOfServiceVersion", 0);
+			static ConfigHandle<int> handle("Core3.TermsOfServiceVersion", 0);
+
+			return handle.get();
 		}
 
 		inline bool getJsonLogOutput() {
@@ -518,7 +637,9 @@ namespace conf {
 		}
 
 		inline int getCleanupMailCount() {
-			return getInt("Core3.CleanupMailCount", 25000);
+			static ConfigHandle<int> handle("Core3.CleanupMailCount", 25000);
+
+			return handle.get();
 		}
 
 		inline int getRESTPort() {
@@ -534,99 +655,83 @@ namespace conf {
 		}
 
 		inline bool getCharacterBuilderEnabled() {
-			return getBool("Core3.CharacterBuilderEnabled", false);
+			static ConfigHandle<bool> handle("Core3.CharacterBuilderEnabled", false);
+
+			return handle.get();
 		}
 
 		inline int getPlayerLogLevel() {
-			return getInt("Core3.PlayerLogLevel", Logger::INFO);
+			static ConfigHandle<int> handle("Core3.PlayerLogLevel", Logger::INFO);
+
+			return handle.get();
 		}
 
 		inline int getMaxLogLines() {
-			return getInt("Core3.MaxLogLines", 1000000);
+			static ConfigHandle<int> handle("Core3.MaxLogLines", 1000000);
+
+			return handle.get();
 		}
 
 		inline int getSessionStatsSeconds() {
-			static uint32 cachedVersion = 0;
-			static int cachedSessionStatsSeconds;
+			static ConfigHandle<int> handle("Core3.SessionStatsSeconds", 3600);
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedSessionStatsSeconds = getInt("Core3.SessionStatsSeconds", 3600);
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedSessionStatsSeconds;
+			return handle.get();
 		}
 
 		inline int getOnlineLogSeconds() {
-			return getInt("Core3.OnlineLogSeconds", 300);
+			static ConfigHandle<int> handle("Core3.OnlineLogSeconds", 300);
+
+			return handle.get();
 		}
 
 		inline int getOnlineLogSize() {
-			static uint32 cachedVersion = 0;
-			static int cachedOnlineLogSize;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedOnlineLogSize = getInt("Core3.OnlineLogSize", 100000000);
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<int> handle("Core3.OnlineLogSize", 100000000);
 
-			return cachedOnlineLogSize;
+			return handle.get();
 		}
 
 		//Structure Packup
 		inline bool getStructurePackupEnabled() {
-			return getBool("Core3.structurePackupEnabled", false);
+			static ConfigHandle<bool> handle("Core3.structurePackupEnabled", false);
+
+			return handle.get();
 		}
 
 		//Inactive Structure Packup
 		inline bool getInactiveStructurePackupEnabled() {
-			return getBool("Core3.inactiveStructurePackupEnabled", false);
+			static ConfigHandle<bool> handle("Core3.inactiveStructurePackupEnabled", false);
+
+			return handle.get();
 		}
 		inline int getInactiveStructurePackupDays() {
-			return getInt("Core3.inactiveStructurePackupDays", 365);
+			static ConfigHandle<int> handle("Core3.inactiveStructurePackupDays", 365);
+
+			return handle.get();
 		}
 		
 		inline String getNoTradeMessage() {
-			static uint32 cachedVersion = 0;
-			static String cachedNoTradeMessage;
-
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedNoTradeMessage = getString("Core3.TangibleObject.NoTradeMessage", "");
-				cachedVersion = configVersion.get();
-			}
+			static ConfigHandle<String> handle("Core3.TangibleObject.NoTradeMessage", "");
 
-			return cachedNoTradeMessage;
+			return handle.get();
 		}
 
 		inline String getForceNoTradeMessage() {
-			static uint32 cachedVersion = 0;
-			static String cachedForceNoTradeMessage;
+			static ConfigHandle<String> handle("Core3.TangibleObject.ForceNoTradeMessage", "");
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedForceNoTradeMessage = getString("Core3.TangibleObject.ForceNoTradeMessage", "");
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedForceNoTradeMessage;
+			return handle.get();
 		}
 
 		inline String getForceNoTradeADKMessage() {
-			static uint32 cachedVersion = 0;
-			static String cachedForceNoTradeADKMessage;
+			static ConfigHandle<String> handle("Core3.TangibleObject.ForceNoTradeADKMessage", "");
 
-			if (configVersion.get() > cachedVersion) {
-				Locker guard(&mutex);
-				cachedForceNoTradeADKMessage = getString("Core3.TangibleObject.ForceNoTradeADKMessage", "");
-				cachedVersion = configVersion.get();
-			}
-
-			return cachedForceNoTradeADKMessage;
+			return handle.get();
 		}
 	};
+
+	template<class T>
+	ConfigHandle<T>::ConfigHandle(const String& key, const T& defaultValue) {
+		slot = ConfigManager::instance()->registerHandle(key, ConfigSnapshotValue(defaultValue));
+	}
 }
 
 using namespace conf;
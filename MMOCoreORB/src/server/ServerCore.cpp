@@ -24,10 +24,20 @@
 #include "server/zone/managers/object/ObjectManager.h"
 #include "templates/manager/TemplateManager.h"
 #include "server/zone/managers/player/PlayerManager.h"
+#include "server/zone/managers/player/LoginQueue.h"
+#include "server/zone/objects/scene/BaselineCache.h"
+#include "server/zone/objects/scene/AttributeListCache.h"
 #include "server/zone/managers/director/DirectorManager.h"
 #include "server/zone/managers/collision/NavMeshManager.h"
 #include "server/zone/managers/name/NameManager.h"
 #include "server/zone/managers/frs/FrsManager.h"
+#include "server/zone/managers/director/LuaBindingProfiler.h"
+#include "server/zone/managers/statistics/TaskProfiler.h"
+#include "server/zone/managers/statistics/ZoneTrafficRecorder.h"
+#include "server/zone/managers/statistics/ZoneTrafficReplay.h"
+#include "server/zone/managers/stringid/StringIdManager.h"
+#include "server/db/DatabaseMetrics.h"
+#include "server/db/WriteBehindBatcher.h"
 
 #include "server/zone/QuadTree.h"
 
@@ -243,6 +253,141 @@ void ServerCore::registerConsoleCommmands() {
 		return SUCCESS;
 	});
 
+	addCommand("stringids", [this](const String& arguments) -> CommandResult {
+		StringTokenizer argTokenizer(arguments);
+		argTokenizer.setDelimiter(" ");
+
+		String subCommand = "info";
+
+		if (argTokenizer.hasMoreTokens())
+			argTokenizer.getStringToken(subCommand);
+
+		StringIdManager* stringIdManager = StringIdManager::instance();
+
+		try {
+			if (subCommand == "info") {
+				System::out << stringIdManager->getTableInfo() << endl;
+			} else if (subCommand == "bench") {
+				int iterations = argTokenizer.hasMoreTokens() ? argTokenizer.getIntToken() : 100000;
+
+				System::out << stringIdManager->runBenchmark(Math::max(1, iterations)) << endl;
+			} else {
+				System::out << "usage: stringids [info|bench [iterations]]" << endl;
+
+				return ERROR;
+			}
+		} catch (const Exception& e) {
+			System::out << "invalid stringids arguments: " << arguments << endl;
+
+			return ERROR;
+		}
+
+		return SUCCESS;
+	});
+
+	addCommand("loginqueue", [this](const String& arguments) -> CommandResult {
+		System::out << LoginQueue::instance()->getInfo() << endl;
+
+		return SUCCESS;
+	});
+
+	addCommand("baselines", [this](const String& arguments) -> CommandResult {
+		BaselineCache* baselineCache = BaselineCache::instance();
+
+		if (arguments == "clear") {
+			baselineCache->clear();
+		} else if (arguments == "on" || arguments == "off") {
+			baselineCache->setEnabled(arguments == "on");
+		} else if (!arguments.isEmpty()) {
+			System::out << "usage: baselines [clear|on|off]" << endl;
+
+			return ERROR;
+		}
+
+		System::out << baselineCache->getInfo() << endl;
+
+		return SUCCESS;
+	});
+
+	addCommand("attributelists", [this](const String& arguments) -> CommandResult {
+		AttributeListCache* attributeListCache = AttributeListCache::instance();
+
+		if (arguments == "clear") {
+			attributeListCache->clear();
+		} else if (arguments == "on" || arguments == "off") {
+			attributeListCache->setEnabled(arguments == "on");
+		} else if (!arguments.isEmpty()) {
+			System::out << "usage: attributelists [clear|on|off]" << endl;
+
+			return ERROR;
+		}
+
+		System::out << attributeListCache->getInfo() << endl;
+
+		return SUCCESS;
+	});
+
+	addCommand("namebench", [this](const String& arguments) -> CommandResult {
+		int iterations = 10000;
+
+		try {
+			if (!arguments.isEmpty())
+				iterations = Math::max(1, Integer::valueOf(arguments));
+		} catch (const Exception& e) {
+			System::out << "invalid iteration count: " << arguments << endl;
+
+			return ERROR;
+		}
+
+		ZoneServer* server = zoneServerRef.get();
+
+		if (server == nullptr)
+			return ERROR;
+
+		System::out << server->getNameManager()->benchmarkReservedNames(iterations) << endl;
+
+		return SUCCESS;
+	});
+
+	addCommand("dbstats", [this](const String& arguments) -> CommandResult {
+		StringTokenizer argTokenizer(arguments);
+		argTokenizer.setDelimiter(" ");
+
+		String subCommand = "show";
+
+		if (argTokenizer.hasMoreTokens())
+			argTokenizer.getStringToken(subCommand);
+
+		try {
+			if (subCommand == "show") {
+				int limit = argTokenizer.hasMoreTokens() ? argTokenizer.getIntToken() : 20;
+
+				WriteBehindBatcher* batcher = WriteBehindBatcher::instance();
+
+				System::out << "connections: " << ServerDatabase::getConnectionCount()
+					<< " write behind pending: " << batcher->getPendingRows()
+					<< " rows: " << batcher->getTotalRows()
+					<< " statements: " << batcher->getTotalStatements() << endl;
+
+				System::out << DatabaseMetrics::instance()->getReport(Math::max(1, limit));
+			} else if (subCommand == "flush") {
+				WriteBehindBatcher::instance()->flush();
+			} else if (subCommand == "reset") {
+				DatabaseMetrics::instance()->reset();
+			} else {
+				System::out << "usage: dbstats [show [limit]|flush|reset]" << endl;
+
+				return ERROR;
+			}
+		} catch (const Exception& e) {
+			System::out << "invalid dbstats arguments: " << arguments << endl;
+
+			return ERROR;
+		}
+
+		return SUCCESS;
+	});
+
 	addCommand("loglevel", [this](const String& arguments) -> CommandResult {
 		int level = 0;
 		try {
@@ -312,7 +457,7 @@ void ServerCore::registerConsoleCommmands() {
 			ZoneServer* server = zoneServerRef.get();
 
 			if (server != nullptr)
-				server->getPlayerManager()->cleanupCharacters();
+				server->getPlayerManager()->cleanupCharacters(arguments == "confirm");
 		}
 
 		return SUCCESS;
@@ -366,6 +511,149 @@ void ServerCore::registerConsoleCommmands() {
 		return SUCCESS;
 	});
 
+	addCommand("taskprofiler", [this](const String& arguments) -> CommandResult {
+		StringTokenizer argTokenizer(arguments);
+		argTokenizer.setDelimiter(" ");
+
+		String subCommand = "status";
+
+		if (argTokenizer.hasMoreTokens())
+			argTokenizer.getStringToken(subCommand);
+
+		TaskProfiler* profiler = TaskProfiler::instance();
+
+		try {
+			if (subCommand == "status") {
+				int limit = argTokenizer.hasMoreTokens() ? argTokenizer.getIntToken() : 25;
+
+				System::out << profiler->getSummary(limit);
+			} else if (subCommand == "top") {
+				int seconds = argTokenizer.hasMoreTokens() ? argTokenizer.getIntToken() : 60;
+				int limit = argTokenizer.hasMoreTokens() ? argTokenizer.getIntToken() : 25;
+
+				System::out << profiler->getTopTasks(seconds, limit);
+			} else if (subCommand == "dump") {
+				String fileName = "log/taskprofile-" + String::valueOf(Time().getTime()) + ".folded";
+
+				if (argTokenizer.hasMoreTokens())
+					argTokenizer.getStringToken(fileName);
+
+				if (!profiler->dumpToFile(fileName))
+					return ERROR;
+			} else if (subCommand == "reset") {
+				profiler->reset();
+			} else if (subCommand == "enable" || subCommand == "disable") {
+				profiler->setEnabled(subCommand == "enable");
+
+				System::out << "task profiler " << subCommand << "d" << endl;
+			} else if (subCommand == "samplerate") {
+				profiler->setSampleRate(argTokenizer.getIntToken());
+
+				System::out << "task profiler sample rate set to 1/" << profiler->getSampleRate() << endl;
+			} else {
+				System::out << "usage: taskprofiler [status [limit]|top [seconds] [limit]|dump [file]|reset|enable|disable|samplerate <n>]" << endl;
+
+				return ERROR;
+			}
+		} catch (const Exception& e) {
+			System::out << "invalid taskprofiler arguments: " << arguments << endl;
+
+			return ERROR;
+		}
+
+		return SUCCESS;
+	});
+
+	addCommand("luabindings", [this](const String& arguments) -> CommandResult {
+		StringTokenizer argTokenizer(arguments);
+		argTokenizer.setDelimiter(" ");
+
+		String subCommand = "status";
+
+		if (argTokenizer.hasMoreTokens())
+			argTokenizer.getStringToken(subCommand);
+
+		LuaBindingProfiler* profiler = LuaBindingProfiler::instance();
+
+		try {
+			if (subCommand == "status") {
+				int limit = argTokenizer.hasMoreTokens() ? argTokenizer.getIntToken() : 25;
+
+				System::out << profiler->getSummary(limit);
+			} else if (subCommand == "reset") {
+				profiler->reset();
+			} else {
+				System::out << "usage: luabindings [status [limit]|reset]" << endl;
+
+				return ERROR;
+			}
+		} catch (const Exception& e) {
+			System::out << "invalid luabindings arguments: " << arguments << endl;
+
+			return ERROR;
+		}
+
+		return SUCCESS;
+	});
+
+	addCommand("traffic", [this](const String& arguments) -> CommandResult {
+		StringTokenizer argTokenizer(arguments);
+		argTokenizer.setDelimiter(" ");
+
+		String subCommand = "status";
+
+		if (argTokenizer.hasMoreTokens())
+			argTokenizer.getStringToken(subCommand);
+
+		ZoneTrafficRecorder* recorder = ZoneTrafficRecorder::instance();
+
+		if (subCommand == "status") {
+			System::out << "traffic capture: " << recorder->getStatus() << endl;
+
+			if (trafficReplay != nullptr)
+				System::out << trafficReplay->getReport();
+		} else if (subCommand == "start") {
+			String fileName = "log/zonetraffic-" + String::valueOf(Time().getTime()) + ".trace";
+
+			if (argTokenizer.hasMoreTokens())
+				argTokenizer.getStringToken(fileName);
+
+			if (!recorder->start(fileName))
+				return ERROR;
+		} else if (subCommand == "stop") {
+			recorder->stop();
+		} else if (subCommand == "replay" && argTokenizer.hasMoreTokens()) {
+			ZoneServer* zoneServer = zoneServerRef.get();
+
+			if (zoneServer == nullptr || zoneServer->isServerLoading()) {
+				System::out << "zone server is not ready" << endl;
+
+				return ERROR;
+			}
+
+			if (trafficReplay != nullptr && !trafficReplay->isFinished()) {
+				System::out << "a replay is already running" << endl;
+
+				return ERROR;
+			}
+
+			String fileName, mode = "max";
+			argTokenizer.getStringToken(fileName);
+
+			if (argTokenizer.hasMoreTokens())
+				argTokenizer.getStringToken(mode);
+
+			trafficReplay = new ZoneTrafficReplay(fileName, zoneServer, mode == "realtime");
+			trafficReplay->start();
+		} else {
+			System::out << "usage: traffic [status|start [file]|stop|replay <file> [realtime|max]]" << endl;
+
+			return ERROR;
+		}
+
+		return SUCCESS;
+	});
+
 #ifdef COLLECT_TASKSTATISTICS
 	addCommand("statsd", [this](const String& arguments) -> CommandResult {
 		StringTokenizer argTokenizer(arguments);
@@ -473,6 +761,20 @@ void ServerCore::registerConsoleCommmands() {
 	addCommand("dumpcfg", dumpConfigLambda);
 	addCommand("dumpconfig", dumpConfigLambda);
 
+	addCommand("reloadconfig", [this](const String& arguments) -> CommandResult {
+		int changes = ConfigManager::instance()->reloadConfigData();
+
+		if (changes < 0) {
+			System::out << "failed to reload conf/config.lua, the current configuration is kept" << endl;
+
+			return ERROR;
+		}
+
+		System::out << "configuration reloaded, " << changes << " keys changed, version " << ConfigManager::instance()->getConfigVersion() << endl;
+
+		return SUCCESS;
+	});
+
 #ifdef WITH_SESSION_API
 	const auto sessionApiLambda = [this](const String& arguments) -> CommandResult {
 		return SessionAPIClient::instance()->consoleCommand(arguments) ? SUCCESS : ERROR;
@@ -552,6 +854,22 @@ void ServerCore::initialize() {
 
 	registerConsoleCommmands();
 
+	TaskProfiler::instance()->loadConfig();
+	LuaBindingProfiler::instance()->loadConfig();
+	ZoneTrafficRecorder::instance()->loadConfig();
+
+	configManager->addChangeListener("Core3.LogFileLevel", [this]() {
+		Logger::setGlobalFileLogLevel(static_cast<Logger::LogLevel>(configManager->getLogFileLevel()));
+	});
+
+	configManager->addChangeListener("Core3.TaskProfiler", []() {
+		TaskProfiler::instance()->loadConfig();
+	});
+
+	configManager->addChangeListener("Core3.LuaBindingProfiler", []() {
+		LuaBindingProfiler::instance()->loadConfig();
+	});
+
 	try {
 		ObjectManager* objectManager = ObjectManager::instance();
 
@@ -686,8 +1004,8 @@ void ServerCore::initialize() {
 		}
 #endif // WITH_SESSION_API
 
-		if (arguments.contains("playercleanup") && zoneServer != nullptr) {
-			zoneServer->getPlayerManager()->cleanupCharacters();
+		if (arguments.contains("playercleanupconfirm") && zoneServer != nullptr) {
+			zoneServer->getPlayerManager()->cleanupCharacters(true);
 		}
 
 		if (arguments.contains("playercleanupstats") && zoneServer != nullptr) {
@@ -725,6 +1043,8 @@ void ServerCore::shutdown() {
 	}
 #endif // WITH_REST_API
 
+	ZoneTrafficRecorder::instance()->stop();
+
 	ObjectManager* objectManager = ObjectManager::instance();
 
 	while (objectManager->isObjectUpdateInProgress())
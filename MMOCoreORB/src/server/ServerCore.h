@@ -30,6 +30,7 @@ namespace conf {
 class ServerDatabase;
 class MantisDatabase;
 class StatusServer;
+class ZoneTrafficReplay;
 
 #ifdef WITH_REST_API
 namespace server {
@@ -55,6 +56,7 @@ class ServerCore : public Core, public Logger {
 	Reference<StatusServer*> statusServer;
 	server::features::Features* features;
 	Reference<PingServer*> pingServer;
+	Reference<ZoneTrafficReplay*> trafficReplay;
 	MetricsManager* metricsManager;
 #ifdef WITH_REST_API
 	server::web3::RESTServer* restServer;
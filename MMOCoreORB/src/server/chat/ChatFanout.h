@@ -0,0 +1,61 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef CHATFANOUT_H_
+#define CHATFANOUT_H_
+
+#include "server/zone/packets/object/ObjectControllerMessage.h"
+
+/**
+ * Delivery helpers for spatial chat. Receivers are filtered first, then the
+ * message body is serialized once and each receiver gets a copy of that buffer
+ * with its own object id patched into the controller header.
+ */
+class ChatFanout {
+public:
+	/**
+	 * Group filter for CF_TARGET_GROUP_ONLY / CF_TARGET_SOURCE_GROUP_ONLY,
+	 * group ids are 0 when the chat target or source is not grouped
+	 */
+	static bool isGroupRecipient(uint64 receiverID, uint64 receiverGroupID, uint64 sourceID, uint64 chatTargetID, uint64 targetGroupID, uint64 sourceGroupID) {
+		if (receiverID == sourceID || receiverID == chatTargetID)
+			return true;
+
+		if (targetGroupID != 0 && targetGroupID == receiverGroupID)
+			return true;
+
+		return sourceGroupID != 0 && sourceGroupID == receiverGroupID;
+	}
+
+	/**
+	 * Sends message to every receiver, the last receiver takes ownership of the
+	 * original buffer so a single receiver costs no copy at all
+	 */
+	template<class R>
+	static void send(BaseMessage* message, const Vector<R*>& receivers) {
+		int last = receivers.size() - 1;
+
+		if (last < 0) {
+			delete message;
+			return;
+		}
+
+		for (int i = 0; i < last; ++i) {
+			R* receiver = receivers.getUnsafe(i);
+
+			auto copy = message->clone();
+			ObjectControllerMessage::setObjectID(copy, receiver->getObjectID());
+
+			receiver->sendMessage(copy);
+		}
+
+		R* receiver = receivers.getUnsafe(last);
+
+		ObjectControllerMessage::setObjectID(message, receiver->getObjectID());
+
+		receiver->sendMessage(message);
+	}
+};
+
+#endif /* CHATFANOUT_H_ */
@@ -43,8 +43,12 @@
 #include "server/chat/StringIdChatParameter.h"
 #include "server/chat/PersistentMessage.h"
 #include "server/chat/ChatMessage.h"
+#include "server/chat/ChatFanout.h"
 
 #include "server/chat/PendingMessageList.h"
+#include "server/chat/MailExpiryBucket.h"
+#include "server/chat/MailHeader.h"
+#include "server/zone/packets/chat/ChatPersistentMessageToClient.h"
 #include "server/chat/room/ChatRoom.h"
 #include "server/chat/room/ChatRoomMap.h"
 #include "templates/string/StringFile.h"
@@ -91,18 +95,80 @@ void ChatManagerImplementation::loadMailDatabase() {
 		return;
 	}
 
+	if (ObjectDatabaseManager::instance()->loadObjectDatabase("mailexpiry", true) == nullptr) {
+		error("Could not load the mail expiry database.");
+		return;
+	}
+
+	Reference<MailExpiryBucket*> timeline = getMailExpiryBucket(0, true);
+
+	if (timeline == nullptr) {
+		error("Could not load the mail expiry timeline.");
+		return;
+	}
+
+	Locker locker(timeline);
+
+	if (timeline->getLastExpiredDay() == 0) {
+		scanMailDatabase(timeline);
+		return;
+	}
+
+	// the last day all the mails of which are past their lifespan
+	uint32 expiredDay = (System::getTime() - PM_LIFESPAN) / PM_EXPIRY_DAY - 1;
+
+	const auto limit = ConfigManager::instance()->getCleanupMailCount();
+
+	int i = 0, days = 0;
+
+	for (uint32 day = timeline->getLastExpiredDay() + 1; day <= expiredDay && i < limit; ++day) {
+		Reference<MailExpiryBucket*> bucket = getMailExpiryBucket(day);
+
+		if (bucket != nullptr) {
+			const Vector<uint64>* messages = bucket->getMessages();
+
+			try {
+				for (int j = 0; j < messages->size(); ++j) {
+					playerMailDatabase->deleteData(messages->getUnsafe(j));
+					i++;
+				}
+			} catch (DatabaseException& e) {
+				error("Database exception in ChatManager::loadMailDatabase(): " + e.getMessage());
+
+				return;
+			}
+
+			ObjectManager::instance()->destroyObjectFromDatabase(bucket->_getObjectID());
+			days++;
+		}
+
+		timeline->setLastExpiredDay(day);
+	}
+
+	info(true) << "Deleted " << i << " mails sent on " << days << " days due to expiration.";
+}
+
+void ChatManagerImplementation::scanMailDatabase(MailExpiryBucket* timeline) {
+	info(true) << "Building the mail expiry timeline";
+
+	ObjectDatabase* playerMailDatabase = ObjectDatabaseManager::instance()->loadObjectDatabase("mail", true);
+
 	int i = 0, j = 0;
 
+	uint32 currentTime = System::getTime();
+	uint32 expiredDay = (currentTime - PM_LIFESPAN) / PM_EXPIRY_DAY - 1;
+	uint32 firstDay = expiredDay + 1;
+
 	try {
 		ObjectDatabaseIterator iterator(playerMailDatabase);
 
 		uint64 objectID;
-		uint32 timeStamp, currentTime = System::getTime();
+		uint32 timeStamp;
 		ObjectInputStream objectData(2000);
 
 		const auto limit = ConfigManager::instance()->getCleanupMailCount();
 
-		while (i < limit && iterator.getNextKeyAndValue(objectID, &objectData)) {
+		while (iterator.getNextKeyAndValue(objectID, &objectData)) {
 			if (!Serializable::getVariable<uint32>(STRING_HASHCODE("PersistentMessage.timeStamp"), &timeStamp, &objectData)) {
 				objectData.clear();
 				continue;
@@ -110,10 +176,15 @@ void ChatManagerImplementation::loadMailDatabase() {
 
 			j++;
 
-			if ((currentTime - timeStamp) > PM_LIFESPAN) {
+			if ((currentTime - timeStamp) > PM_LIFESPAN && i < limit) {
 				i++;
 
 				playerMailDatabase->deleteData(objectID);
+			} else {
+				// over the cleanup limit expired mails are filed too, later boots delete them
+				addToMailExpiry(objectID, timeStamp);
+
+				firstDay = Math::min(firstDay, timeStamp / PM_EXPIRY_DAY);
 			}
 
 			if (ConfigManager::instance()->isProgressMonitorActivated())
@@ -123,10 +194,46 @@ void ChatManagerImplementation::loadMailDatabase() {
 		}
 
 	} catch (DatabaseException& e) {
-		error("Database exception in ChatManager::loadMailDatabase(): " + e.getMessage());
+		error("Database exception in ChatManager::scanMailDatabase(): " + e.getMessage());
+
+		return;
+	}
+
+	timeline->setLastExpiredDay(Math::max((uint32) 1, Math::min(expiredDay, firstDay - 1)));
+
+	info(true) << "Deleted " << i << " mails due to expiration, " << j - i << " mails filed by day.";
+}
+
+Reference<MailExpiryBucket*> ChatManagerImplementation::getMailExpiryBucket(uint32 day, bool create) {
+	static const uint64 databaseID = ObjectDatabaseManager::instance()->getDatabaseID("mailexpiry");
+
+	uint64 oid = (((uint64) day) & 0x0000FFFFFFFFFFFFull) | (databaseID << 48);
+
+	Reference<ManagedObject*> bucketObj = Core::getObjectBroker()->lookUp(oid).castTo<ManagedObject*>();
+
+	if (bucketObj == nullptr && create) {
+		Locker locker(&mailExpiryMutex);
+
+		bucketObj = Core::getObjectBroker()->lookUp(oid).castTo<ManagedObject*>();
+
+		if (bucketObj == nullptr)
+			bucketObj = ObjectManager::instance()->createObject("MailExpiryBucket", 3, "mailexpiry", oid);
+	}
+
+	return bucketObj.castMoveTo<MailExpiryBucket*>();
+}
+
+void ChatManagerImplementation::addToMailExpiry(uint64 mailID, uint32 timeStamp) {
+	Reference<MailExpiryBucket*> bucket = getMailExpiryBucket(timeStamp / PM_EXPIRY_DAY, true);
+
+	if (bucket == nullptr) {
+		error() << "could not file mail " << mailID << " for expiration";
+		return;
 	}
 
-	info(true) << "Deleted " << i << " mails due to expiration.";
+	Locker locker(bucket);
+
+	bucket->addMessage(mailID);
 }
 
 void ChatManagerImplementation::loadSocialTypes() {
@@ -1088,6 +1195,14 @@ void ChatManagerImplementation::broadcastChatMessage(CreatureObject* sourceCreat
 	if (specialRange != -1)
 		range = specialRange;
 
+	uint64 sourceID = sourceCreature->getObjectID();
+	bool checkIgnore = firstName != "" && !godMode;
+	bool groupOnly = (chatFlags & CF_TARGET_GROUP_ONLY) || (chatFlags & CF_TARGET_SOURCE_GROUP_ONLY);
+	uint64 targetGroupID = (chatTarget != nullptr && chatTarget->isGrouped()) ? chatTarget->getGroupID() : 0;
+	uint64 sourceGroupID = ((chatFlags & CF_TARGET_SOURCE_GROUP_ONLY) && sourceCreature->isGrouped()) ? sourceCreature->getGroupID() : 0;
+
+	Vector<CreatureObject*> receivers(closeEntryObjects.size(), 50);
+
 	try {
 		for (int i = 0; i < closeEntryObjects.size(); ++i) {
 			SceneObject* object = static_cast<SceneObject*>(closeEntryObjects.get(i));
@@ -1120,42 +1235,30 @@ void ChatManagerImplementation::broadcastChatMessage(CreatureObject* sourceCreat
 			if (ghost == nullptr)
 				continue;
 
-			if ((firstName != "" && ghost->isIgnoring(firstName)) && !godMode)
+			if (checkIgnore && ghost->isIgnoring(firstName))
 				continue;
 
-			SpatialChat* cmsg = nullptr;
 			uint64 targetID = creature->getObjectID();
-			uint64 sourceID = sourceCreature->getObjectID();
 
 			if ((chatFlags & CF_TARGET_ONLY) && targetID != chatTargetID && targetID != sourceID)
 				continue;
 
-			if ((chatFlags & CF_TARGET_GROUP_ONLY) || (chatFlags & CF_TARGET_SOURCE_GROUP_ONLY)) {
-				bool validRecipient = false;
-
-				if (targetID == sourceID)
-					validRecipient = true;
-
-				if (targetID == chatTargetID)
-					validRecipient = true;
-
-				if (chatTarget != nullptr && chatTarget->isGrouped() && chatTarget->getGroupID() == creature->getGroupID())
-					validRecipient = true;
+			if (groupOnly && !ChatFanout::isGroupRecipient(targetID, creature->getGroupID(), sourceID, chatTargetID, targetGroupID, sourceGroupID))
+				continue;
 
-				if ((chatFlags & CF_TARGET_SOURCE_GROUP_ONLY) && sourceCreature->isGrouped() && sourceCreature->getGroupID() == creature->getGroupID())
-					validRecipient = true;
+			receivers.add(creature);
+		}
 
-				if (!validRecipient)
-					continue;
-			}
+		if (receivers.size() > 0) {
+			SpatialChat* cmsg = nullptr;
 
 			if (param == nullptr) {
-				cmsg = new SpatialChat(sourceID, targetID, chatTargetID, message, range, spatialChatType, moodType, chatFlags, languageID);
+				cmsg = new SpatialChat(sourceID, sourceID, chatTargetID, message, range, spatialChatType, moodType, chatFlags, languageID);
 			} else {
-				cmsg = new SpatialChat(sourceID, targetID, chatTargetID, *param, range, spatialChatType, moodType, chatFlags, languageID);
+				cmsg = new SpatialChat(sourceID, sourceID, chatTargetID, *param, range, spatialChatType, moodType, chatFlags, languageID);
 			}
 
-			creature->sendMessage(cmsg);
+			ChatFanout::send(cmsg, receivers);
 		}
 
 		if (param != nullptr) {
@@ -1171,9 +1274,6 @@ void ChatManagerImplementation::broadcastChatMessage(CreatureObject* sourceCreat
 
 		throw;
 	}
-
-	//zone->runlock();
-
 }
 
 void ChatManagerImplementation::broadcastChatMessage(CreatureObject* sourceCreature, StringIdChatParameter& message, uint64 chatTargetID, uint32 spatialChatType, uint32 moodType, uint32 chatFlags, int languageID) {
@@ -1221,65 +1321,52 @@ void ChatManagerImplementation::broadcastChatMessage(CreatureObject* sourceCreat
 	if (specialRange != -1)
 		range = specialRange;
 
-	try {
-		for (int i = 0; i < closeEntryObjects.size(); ++i) {
-			SceneObject* object = static_cast<SceneObject*>(closeEntryObjects.getUnsafe(i));
-
-			if (object == nullptr)
-				continue;
-
-			CreatureObject* creature = object->asCreatureObject();
-
-			if (creature == nullptr)
-				continue;
+	uint64 sourceID = sourceCreature->getObjectID();
+	bool checkIgnore = firstName != "" && !godMode;
+	bool groupOnly = (chatFlags & CF_TARGET_GROUP_ONLY) || (chatFlags & CF_TARGET_SOURCE_GROUP_ONLY);
+	uint64 targetGroupID = (chatTarget != nullptr && chatTarget->isGrouped()) ? chatTarget->getGroupID() : 0;
+	uint64 sourceGroupID = ((chatFlags & CF_TARGET_SOURCE_GROUP_ONLY) && sourceCreature->isGrouped()) ? sourceCreature->getGroupID() : 0;
 
-			if (!sourceCreature->isInRange(creature, range))
-				continue;
-
-			if (!creature->isPlayerCreature())
-				continue;
+	Vector<CreatureObject*> receivers(closeEntryObjects.size(), 50);
 
-			PlayerObject* ghost = creature->getPlayerObject();
+	for (int i = 0; i < closeEntryObjects.size(); ++i) {
+		SceneObject* object = static_cast<SceneObject*>(closeEntryObjects.getUnsafe(i));
 
-			if (ghost == nullptr)
-				continue;
+		if (object == nullptr)
+			continue;
 
-			if ((firstName != "" && ghost->isIgnoring(firstName)) && !godMode)
-				continue;
+		CreatureObject* creature = object->asCreatureObject();
 
-			SpatialChat* cmsg = nullptr;
-			uint64 targetID = creature->getObjectID();
-			uint64 sourceID = sourceCreature->getObjectID();
+		if (creature == nullptr)
+			continue;
 
-			if ((chatFlags & CF_TARGET_ONLY) && targetID != chatTargetID && targetID != sourceID)
-				continue;
+		if (!sourceCreature->isInRange(creature, range))
+			continue;
 
-			if ((chatFlags & CF_TARGET_GROUP_ONLY) || (chatFlags & CF_TARGET_SOURCE_GROUP_ONLY)) {
-				bool validRecipient = false;
+		if (!creature->isPlayerCreature())
+			continue;
 
-				if (targetID == sourceID)
-					validRecipient = true;
+		PlayerObject* ghost = creature->getPlayerObject();
 
-				if (targetID == chatTargetID)
-					validRecipient = true;
+		if (ghost == nullptr)
+			continue;
 
-				if (chatTarget != nullptr && chatTarget->isGrouped() && chatTarget->getGroupID() == creature->getGroupID())
-					validRecipient = true;
+		if (checkIgnore && ghost->isIgnoring(firstName))
+			continue;
 
-				if ((chatFlags & CF_TARGET_SOURCE_GROUP_ONLY) && sourceCreature->isGrouped() && sourceCreature->getGroupID() == creature->getGroupID())
-					validRecipient = true;
+		uint64 targetID = creature->getObjectID();
 
-				if (!validRecipient)
-					continue;
-			}
+		if ((chatFlags & CF_TARGET_ONLY) && targetID != chatTargetID && targetID != sourceID)
+			continue;
 
-			cmsg = new SpatialChat(sourceID, targetID, chatTargetID, message, range, spatialChatType, moodType, chatFlags, languageID);
+		if (groupOnly && !ChatFanout::isGroupRecipient(targetID, creature->getGroupID(), sourceID, chatTargetID, targetGroupID, sourceGroupID))
+			continue;
 
-			creature->sendMessage(cmsg);
-		}
-	} catch (...) {
-		throw;
+		receivers.add(creature);
 	}
+
+	if (receivers.size() > 0)
+		ChatFanout::send(new SpatialChat(sourceID, sourceID, chatTargetID, message, range, spatialChatType, moodType, chatFlags, languageID), receivers);
 }
 
 void ChatManagerImplementation::handleSpatialChatInternalMessage(CreatureObject* player, const UnicodeString& args) {
@@ -1657,6 +1744,7 @@ void ChatManagerImplementation::sendMail(const String& sendername, const Unicode
 		mail->setReceiverObjectID(receiverObjectID);
 		mail->setTimeStamp(currentTime);
 		ObjectManager::instance()->persistObject(mail, 1, "mail");
+		addToMailExpiry(mail->getObjectID(), mail->getTimeStamp());
 
 		ManagedReference<CreatureObject*> creo = getPlayer(name);
 		if (creo == nullptr) {
@@ -1669,7 +1757,8 @@ void ChatManagerImplementation::sendMail(const String& sendername, const Unicode
 			Locker locker(creo);
 
 			PlayerObject* ghost = creo->getPlayerObject();
-			ghost->addPersistentMessage(mail->getObjectID());
+			MailHeader header(mail);
+			ghost->addPersistentMessage(mail->getObjectID(), header);
 
 			if (ghost->isOnline())
 				mail->sendTo(creo, false);
@@ -1729,6 +1818,7 @@ int ChatManagerImplementation::sendMail(const String& sendername, const UnicodeS
 	mail->setReceiverObjectID(receiverObjectID);
 
 	ObjectManager::instance()->persistObject(mail, 1, "mail");
+	addToMailExpiry(mail->getObjectID(), mail->getTimeStamp());
 
 	if (sentMail != nullptr) {
 		*sentMail = mail;
@@ -1752,7 +1842,8 @@ int ChatManagerImplementation::sendMail(const String& sendername, const UnicodeS
 
 			PlayerObject* ghost = receiver->getPlayerObject();
 
-			ghost->addPersistentMessage(mail->getObjectID());
+			MailHeader header(mail);
+			ghost->addPersistentMessage(mail->getObjectID(), header);
 
 			if (receiver->isOnline())
 				mail->sendTo(receiver, false);
@@ -1801,6 +1892,7 @@ int ChatManagerImplementation::sendMail(const String& sendername, const UnicodeS
 	Reference<CreatureObject*> receiver = getPlayer(recipientName);
 	if (receiver == nullptr) {
 		ObjectManager::instance()->persistObject(mail, 1, "mail");
+		addToMailExpiry(mail->getObjectID(), mail->getTimeStamp());
 		ManagedReference<PendingMessageList*> list = getPendingMessages(receiverObjectID);
 		Locker locker(list);
 		list->addPendingMessage(mail->getObjectID());
@@ -1812,9 +1904,11 @@ int ChatManagerImplementation::sendMail(const String& sendername, const UnicodeS
 			return;
 
 		ObjectManager::instance()->persistObject(mail, 1, "mail");
+		addToMailExpiry(mail->getObjectID(), mail->getTimeStamp());
 		PlayerObject* ghost = receiver->getPlayerObject();
 
-		ghost->addPersistentMessage(mail->getObjectID());
+		MailHeader header(mail);
+		ghost->addPersistentMessage(mail->getObjectID(), header);
 
 		if (receiver->isOnline())
 			mail->sendTo(receiver, false);
@@ -1832,18 +1926,40 @@ void ChatManagerImplementation::loadMail(CreatureObject* player) {
 	ghost->checkPendingMessages();
 
 	SortedVector<uint64>* messages = ghost->getPersistentMessages();
+	VectorMap<uint64, MailHeader>* headers = ghost->getMailHeaders();
+
+	uint32 expireTime = System::getTime() - PM_LIFESPAN;
+	const String& galaxyName = server->getGalaxyName();
 
 	for (int i = messages->size() - 1; i >= 0 ; --i) {
 		uint64 messageObjectID = messages->get(i);
 
-		Reference<PersistentMessage*> mail = Core::getObjectBroker()->lookUp(messageObjectID).castTo<PersistentMessage*>();
+		int pos = headers->find(messageObjectID);
+
+		if (pos == -1) {
+			// mail received before the headers were kept, loaded once
+			Reference<PersistentMessage*> mail = Core::getObjectBroker()->lookUp(messageObjectID).castTo<PersistentMessage*>();
+
+			if (mail == nullptr) {
+				ghost->dropPersistentMessage(messageObjectID);
+				continue;
+			}
 
-		if (mail == nullptr) {
-			messages->drop(messageObjectID);
+			MailHeader header(mail);
+			ghost->setMailHeader(messageObjectID, header);
+
+			pos = headers->find(messageObjectID);
+		}
+
+		const MailHeader& header = headers->elementAt(pos).getValue();
+
+		// deleted by the expiry, or will be on the next boot
+		if (header.getTimeStamp() < expireTime) {
+			ghost->dropPersistentMessage(messageObjectID);
 			continue;
 		}
 
-		mail->sendTo(player, false);
+		player->sendMessage(new ChatPersistentMessageToClient(Long::hashCode(messageObjectID), header, galaxyName));
 	}
 }
 
@@ -1871,10 +1987,12 @@ void ChatManagerImplementation::handleRequestPersistentMsg(CreatureObject* playe
 	Reference<PersistentMessage*> mail = Core::getObjectBroker()->lookUp(messageObjectID).castTo<PersistentMessage*>();
 
 	if (mail == nullptr) {
-		messages->drop(messageObjectID);
+		ghost->dropPersistentMessage(messageObjectID);
 		return;
 	}
 
+	ghost->setPersistentMessageStatus(messageObjectID, PersistentMessage::READ);
+
 	_locker.release();
 
 	mail->setStatus('R');
@@ -1902,7 +2020,7 @@ void ChatManagerImplementation::deletePersistentMessage(CreatureObject* player,
 		return;
 	}
 
-	messages->drop(messageObjectID);
+	ghost->dropPersistentMessage(messageObjectID);
 
 	_locker.release();
 
@@ -0,0 +1,14 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "MailHeader.h"
+
+#include "server/chat/PersistentMessage.h"
+
+MailHeader::MailHeader(PersistentMessage* mail) : Object() {
+	senderName = mail->getSenderName();
+	subject = mail->getSubject();
+	timeStamp = mail->getTimeStamp();
+	status = mail->getStatus();
+}
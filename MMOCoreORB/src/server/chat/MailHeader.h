@@ -0,0 +1,105 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef MAILHEADER_H_
+#define MAILHEADER_H_
+
+#include "engine/engine.h"
+
+#include "engine/util/json_utils.h"
+
+namespace server {
+ namespace chat {
+  class PersistentMessage;
+ }
+}
+
+using namespace server::chat;
+
+/**
+ * What the mail list of the client shows of a PersistentMessage, kept by the
+ * recipient's PlayerObject so the list is sent at login without loading the
+ * bodies, attachments and waypoints of every mail.
+ */
+class MailHeader : public Object {
+	String senderName;
+	UnicodeString subject;
+	uint32 timeStamp;
+	byte status;
+
+public:
+	MailHeader() : Object() {
+		timeStamp = 0;
+		status = 0;
+	}
+
+	MailHeader(PersistentMessage* mail);
+
+	MailHeader(const MailHeader& header) : Object() {
+		initialize(header);
+	}
+
+	MailHeader& operator=(const MailHeader& header) {
+		if (this == &header)
+			return *this;
+
+		initialize(header);
+
+		return *this;
+	}
+
+	friend void to_json(nlohmann::json& j, const MailHeader& h) {
+		j["senderName"] = h.senderName;
+		j["subject"] = h.subject;
+		j["timeStamp"] = h.timeStamp;
+		j["status"] = h.status;
+	}
+
+	bool toBinaryStream(ObjectOutputStream* stream) {
+		senderName.toBinaryStream(stream);
+		subject.toBinaryStream(stream);
+		stream->writeInt(timeStamp);
+		stream->writeByte(status);
+
+		return true;
+	}
+
+	bool parseFromBinaryStream(ObjectInputStream* stream) {
+		senderName.parseFromBinaryStream(stream);
+		subject.parseFromBinaryStream(stream);
+		timeStamp = stream->readInt();
+		status = stream->readByte();
+
+		return true;
+	}
+
+	void initialize(const MailHeader& header) {
+		senderName = header.senderName;
+		subject = header.subject;
+		timeStamp = header.timeStamp;
+		status = header.status;
+	}
+
+	const String& getSenderName() const {
+		return senderName;
+	}
+
+	const UnicodeString& getSubject() const {
+		return subject;
+	}
+
+	uint32 getTimeStamp() const {
+		return timeStamp;
+	}
+
+	byte getStatus() const {
+		return status;
+	}
+
+	void setStatus(byte stat) {
+		status = stat;
+	}
+};
+
+#endif /* MAILHEADER_H_ */
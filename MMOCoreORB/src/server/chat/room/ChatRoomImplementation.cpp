@@ -200,7 +200,7 @@ void ChatRoomImplementation::broadcastMessageCheckIgnore(BaseMessage* msg, const
 			if (ghost == nullptr)
 				continue;
 
-			if (!ghost->isIgnoring(lowerName) || godMode) {
+			if (godMode || !ghost->isIgnoring(lowerName)) {
 #ifdef LOCKFREE_BCLIENT_BUFFERS
 				player->sendMessage(msg);
 #else
@@ -0,0 +1,98 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "DatabaseMetrics.h"
+
+#include <algorithm>
+
+DatabaseMetrics::DatabaseMetrics() : statements(64) {
+}
+
+Reference<StatementMetrics*> DatabaseMetrics::getMetrics(const String& key) {
+	ReadLocker readLocker(&lock);
+
+	Reference<StatementMetrics*> metrics = statements.get(key);
+
+	if (metrics != nullptr)
+		return metrics;
+
+	readLocker.release();
+
+	Locker locker(&lock);
+
+	metrics = statements.get(key);
+
+	if (metrics == nullptr) {
+		if (statements.size() >= MAX_STATEMENTS)
+			return nullptr;
+
+		metrics = new StatementMetrics();
+		metrics->statement = key;
+
+		statements.put(key, metrics);
+	}
+
+	return metrics;
+}
+
+void DatabaseMetrics::record(const String& key, uint64 micros, bool failed) {
+	// a reset can drop the entry while it is being updated
+	Reference<StatementMetrics*> metrics = getMetrics(key);
+
+	if (metrics == nullptr)
+		return;
+
+	metrics->count.increment();
+	metrics->totalTime.add(micros);
+
+	// racy by design, a lost update only affects a reporting value
+	if (micros > (uint64) metrics->maxTime.get())
+		metrics->maxTime.set(micros);
+
+	if (failed)
+		metrics->errors.increment();
+}
+
+String DatabaseMetrics::getReport(int limit) {
+	Vector<Reference<StatementMetrics*> > sorted;
+
+	ReadLocker locker(&lock);
+
+	HashTableIterator<String, Reference<StatementMetrics*> > iterator = statements.iterator();
+
+	while (iterator.hasNext())
+		sorted.add(iterator.getNextValue());
+
+	locker.release();
+
+	std::sort(sorted.begin(), sorted.end(), [](const Reference<StatementMetrics*>& a, const Reference<StatementMetrics*>& b) {
+		return a->totalTime.get() > b->totalTime.get();
+	});
+
+	StringBuffer buf;
+	buf << sorted.size() << " tracked statements" << endl;
+
+	for (int i = 0; i < sorted.size() && i < limit; ++i) {
+		StatementMetrics* metrics = sorted.get(i);
+		uint64 count = metrics->count.get();
+
+		if (count == 0)
+			continue;
+
+		buf << "count: " << count
+			<< " avg: " << metrics->totalTime.get() / count << "us"
+			<< " max: " << metrics->maxTime.get() << "us"
+			<< " total: " << metrics->totalTime.get() / 1000 << "ms"
+			<< " errors: " << metrics->errors.get()
+			<< " " << metrics->statement.subString(0, Math::min(metrics->statement.length(), 160)) << endl;
+	}
+
+	return buf.toString();
+}
+
+void DatabaseMetrics::reset() {
+	Locker locker(&lock);
+
+	statements.removeAll();
+}
@@ -0,0 +1,56 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef DATABASEMETRICS_H_
+#define DATABASEMETRICS_H_
+
+#include "engine/engine.h"
+
+namespace server {
+  namespace db {
+    namespace mysql {
+
+	class StatementMetrics : public Object {
+	public:
+		String statement;
+
+		AtomicLong count;
+		AtomicLong errors;
+		AtomicLong totalTime;
+		AtomicLong maxTime;
+	};
+
+	/**
+	 * Latency per statement text. Only prepared statements and write behind
+	 * batches are recorded, their text is constant so the key set stays small.
+	 * Times are in microseconds.
+	 */
+	class DatabaseMetrics : public Singleton<DatabaseMetrics>, public Object {
+		static const int MAX_STATEMENTS = 1024;
+
+		ReadWriteLock lock;
+		HashTable<String, Reference<StatementMetrics*> > statements;
+
+		Reference<StatementMetrics*> getMetrics(const String& key);
+
+	public:
+		DatabaseMetrics();
+
+		void record(const String& key, uint64 micros, bool failed = false);
+
+		/**
+		 * Slowest statements by total time first
+		 */
+		String getReport(int limit);
+
+		void reset();
+	};
+
+    } // namespace mysql
+  } // namespace db
+} // namespace server
+
+using namespace server::db::mysql;
+
+#endif /*DATABASEMETRICS_H_*/
@@ -11,6 +11,9 @@ Distribution of this file for usage outside of Core3 is prohibited.
 #include "engine/core/TaskWorkerThread.h"
 
 #include "MySqlDatabase.h"
+#include "DatabaseMetrics.h"
+
+#include <errmsg.h>
 
 using namespace server::db::mysql;
 
@@ -31,6 +34,22 @@ public:
 	}
 };
 
+class MysqlPreparedTask final : public Task {
+	MySqlDatabase* database;
+	PreparedStatement statement;
+public:
+	MysqlPreparedTask(MySqlDatabase* db, const PreparedStatement& stmt) : database(db), statement(stmt) {
+	}
+
+	void run() final {
+		try {
+			database->executePrepared(statement);
+		} catch (const Exception& e) {
+			database->error(e.getMessage().toCharArray());
+		}
+	}
+};
+
 class MysqlCallback final : public Task {
 	engine::db::ResultSet* result;
 	Function<void(engine::db::ResultSet*)> callback;
@@ -71,14 +90,14 @@ using namespace engine::db::mysql;
 
 const char* MySqlDatabase::mysqlThreadName = "mysqlThread";
 
-MySqlDatabase::MySqlDatabase(const String& s) : Mutex("MYSQL DB"), Logger(s) {
+MySqlDatabase::MySqlDatabase(const String& s) : Mutex("MYSQL DB"), Logger(s), preparedStatements(32) {
 	queryTimeout = 5;
 	writeQueryTimeout = queryTimeout * 10;
 
 	memset(&mysql, 0, sizeof(mysql));
 }
 
-MySqlDatabase::MySqlDatabase(const String& s, const String& host) : Mutex("MYSQL DB"), Logger(s) {
+MySqlDatabase::MySqlDatabase(const String& s, const String& host) : Mutex("MYSQL DB"), Logger(s), preparedStatements(32) {
 	MySqlDatabase::host = host;
 
 	memset(&mysql, 0, sizeof(mysql));
@@ -229,6 +248,165 @@ engine::db::ResultSet* MySqlDatabase::executeQuery(const char* statement) {
 	return res;
 }
 
+MYSQL_STMT* MySqlDatabase::getPreparedStatement(const String& query) {
+	MYSQL_STMT* stmt = preparedStatements.get(query);
+
+	if (stmt != nullptr)
+		return stmt;
+
+	stmt = mysql_stmt_init(&mysql);
+
+	if (stmt == nullptr) {
+		StringBuffer msg;
+		msg << "could not allocate a statement for " << query << "\n" << mysql_errno(&mysql) << ": " << mysql_error(&mysql);
+
+		Logger::error(msg);
+
+		throw DatabaseException(msg.toString());
+	}
+
+	if (mysql_stmt_prepare(stmt, query.toCharArray(), query.length())) {
+		StringBuffer msg;
+		msg << "could not prepare " << query << "\n" << mysql_stmt_errno(stmt) << ": " << mysql_stmt_error(stmt);
+
+		mysql_stmt_close(stmt);
+
+		Logger::error(msg);
+
+		throw DatabaseException(msg.toString());
+	}
+
+	preparedStatements.put(query, stmt);
+
+	return stmt;
+}
+
+void MySqlDatabase::clearPreparedStatements() {
+	HashTableIterator<String, MYSQL_STMT*> iterator = preparedStatements.iterator();
+
+	while (iterator.hasNext())
+		mysql_stmt_close(iterator.getNextValue());
+
+	preparedStatements.removeAll();
+}
+
+int MySqlDatabase::getPreparedStatementCount() {
+	Locker locker(this);
+
+	return preparedStatements.size();
+}
+
+uint64 MySqlDatabase::executePrepared(const PreparedStatement& statement) {
+	Locker locker(this);
+
+	const String& query = statement.getQuery();
+	int count = statement.getParameterCount();
+
+	Timer timer(Time::MONOTONIC_TIME);
+	timer.start();
+
+	std::vector<MYSQL_BIND> binds(count);
+	std::vector<unsigned long> lengths(count);
+
+	memset(binds.data(), 0, sizeof(MYSQL_BIND) * count);
+
+	for (int i = 0; i < count; ++i) {
+		auto& param = const_cast<PreparedStatement::Parameter&>(statement.getParameter(i));
+		MYSQL_BIND& bind = binds[i];
+
+		switch (param.type) {
+		case PreparedStatement::SIGNED:
+		case PreparedStatement::UNSIGNED:
+			bind.buffer_type = MYSQL_TYPE_LONGLONG;
+			bind.buffer = &param.intValue;
+			bind.is_unsigned = param.type == PreparedStatement::UNSIGNED;
+			break;
+		case PreparedStatement::DOUBLE:
+			bind.buffer_type = MYSQL_TYPE_DOUBLE;
+			bind.buffer = &param.doubleValue;
+			break;
+		case PreparedStatement::STRING:
+			lengths[i] = param.stringValue.length();
+
+			bind.buffer_type = MYSQL_TYPE_STRING;
+			bind.buffer = const_cast<char*>(param.stringValue.toCharArray());
+			bind.buffer_length = lengths[i];
+			bind.length = &lengths[i];
+			break;
+		default:
+			bind.buffer_type = MYSQL_TYPE_NULL;
+			break;
+		}
+	}
+
+	uint64 affectedRows = 0;
+
+	// a dropped connection invalidates every prepared handle, prepare again once
+	for (int attempt = 0; attempt < 2; ++attempt) {
+		MYSQL_STMT* stmt = getPreparedStatement(query);
+
+		if (mysql_stmt_param_count(stmt) != (unsigned long) count) {
+			DatabaseMetrics::instance()->record(query, timer.stop() / 1000, true);
+
+			throw DatabaseException("parameter count mismatch in prepared statement: " + query);
+		}
+
+		if (mysql_stmt_bind_param(stmt, binds.data()) == 0 && mysql_stmt_execute(stmt) == 0) {
+			affectedRows = mysql_stmt_affected_rows(stmt);
+			break;
+		}
+
+		unsigned int errorNumber = mysql_stmt_errno(stmt);
+
+		if (attempt == 0 && (errorNumber == CR_SERVER_GONE_ERROR || errorNumber == CR_SERVER_LOST || errorNumber == 1243/*ER_UNKNOWN_STMT_HANDLER*/)) {
+			warning() << "re-preparing statements after error " << errorNumber;
+
+			clearPreparedStatements();
+			continue;
+		}
+
+		StringBuffer msg;
+		msg << "DatabaseException caused by prepared statement: " << query << "\n" << errorNumber << ": " << mysql_stmt_error(stmt);
+
+		DatabaseMetrics::instance()->record(query, timer.stop() / 1000, true);
+
+		Logger::error(msg);
+
+		throw DatabaseException(msg.toString());
+	}
+
+#ifdef WITH_STM
+	MysqlDatabaseManager::instance()->addModifiedDatabase(this);
+#endif
+
+	DatabaseMetrics::instance()->record(query, timer.stop() / 1000);
+
+	return affectedRows;
+}
+
+void MySqlDatabase::executePreparedAsync(const PreparedStatement& statement) {
+	Reference<Task*> task = new MysqlPreparedTask(this, statement);
+	task->setCustomTaskQueue(mysqlThreadName);
+	task->execute();
+}
+
+engine::db::ResultSet* MySqlDatabase::executeQuery(const PreparedStatement& statement) {
+	Timer timer(Time::MONOTONIC_TIME);
+	timer.start();
+
+	try {
+		engine::db::ResultSet* result = executeQuery(statement.toString());
+
+		DatabaseMetrics::instance()->record(statement.getQuery(), timer.stop() / 1000);
+
+		return result;
+	} catch (const DatabaseException&) {
+		DatabaseMetrics::instance()->record(statement.getQuery(), timer.stop() / 1000, true);
+
+		throw;
+	}
+}
+
 engine::db::ResultSet* MySqlDatabase::executeQuery(const String& statement) {
 	return executeQuery(statement.toCharArray());
 }
@@ -256,6 +434,10 @@ void MySqlDatabase::autocommit(bool doCommit) {
 }
 
 void MySqlDatabase::close() {
+	Locker locker(this);
+
+	clearPreparedStatements();
+
 	mysql_close(&mysql);
 
 	info("disconnected");
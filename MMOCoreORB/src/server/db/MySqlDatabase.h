@@ -16,6 +16,7 @@ Distribution of this file for usage outside of Core3 is prohibited.
 
 #include "Statement.h"
 #include "ResultSet.h"
+#include "PreparedStatement.h"
 
 namespace server {
   namespace db {
@@ -28,16 +29,25 @@ namespace server {
 		uint32 queryTimeout;
 		uint32 writeQueryTimeout;
 
+		HashTable<String, MYSQL_STMT*> preparedStatements;
+
 	private:
 		static int createDatabaseThread();
 		static const char* mysqlThreadName;
 
+		MYSQL_STMT* getPreparedStatement(const String& query);
+		void clearPreparedStatements();
+
 	public:
 		MySqlDatabase(const String& s);
 		MySqlDatabase(const String& s, const String& host);
 
 		~MySqlDatabase();
 
+		static const char* getTaskQueueName() {
+			return mysqlThreadName;
+		}
+
 		void connect(const String& dbname, const String& user, const String& passw, int port);
 
 		void executeStatement(const char* statement);
@@ -56,6 +66,24 @@ namespace server {
 		void executeQuery(const char* query, Function<void(engine::db::ResultSet*)>&& callback);
 #endif
 
+		/**
+		 * Runs a statement that returns no rows through a cached server side
+		 * prepared statement, returns the affected row count
+		 */
+		uint64 executePrepared(const PreparedStatement& statement);
+
+		/**
+		 * Queues executePrepared on the mysql thread, ordered with executeStatement
+		 */
+		void executePreparedAsync(const PreparedStatement& statement);
+
+		/**
+		 * Result set queries expand the parameters client side, ResultSet reads MYSQL_RES
+		 */
+		engine::db::ResultSet* executeQuery(const PreparedStatement& statement);
+
+		int getPreparedStatementCount();
+
 		void commit();
 
 		void rollback();
@@ -0,0 +1,146 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef PREPAREDSTATEMENT_H_
+#define PREPAREDSTATEMENT_H_
+
+#include "engine/engine.h"
+
+namespace server {
+  namespace db {
+    namespace mysql {
+
+	/**
+	 * SQL text with '?' placeholders plus the values bound to them, in order.
+	 * The text is the cache key for server side prepared statements and the
+	 * key the latency metrics are collected under, so callers keep it constant
+	 * and pass every variable part as a parameter.
+	 */
+	class PreparedStatement {
+	public:
+		enum ParameterType {
+			NULLVALUE,
+			SIGNED,
+			UNSIGNED,
+			DOUBLE,
+			STRING
+		};
+
+		class Parameter {
+		public:
+			int type;
+			int64 intValue;
+			double doubleValue;
+			String stringValue;
+
+			Parameter() : type(NULLVALUE), intValue(0), doubleValue(0) {
+			}
+		};
+
+	protected:
+		String query;
+		Vector<Parameter> parameters;
+
+		PreparedStatement& add(int type, int64 intValue, double doubleValue, const String& stringValue) {
+			Parameter param;
+			param.type = type;
+			param.intValue = intValue;
+			param.doubleValue = doubleValue;
+			param.stringValue = stringValue;
+
+			parameters.add(param);
+
+			return *this;
+		}
+
+	public:
+		explicit PreparedStatement(const String& sql) : query(sql), parameters(1, 4) {
+		}
+
+		PreparedStatement& bindInt(int64 value) {
+			return add(SIGNED, value, 0, "");
+		}
+
+		PreparedStatement& bindUnsigned(uint64 value) {
+			return add(UNSIGNED, (int64) value, 0, "");
+		}
+
+		PreparedStatement& bindDouble(double value) {
+			return add(DOUBLE, 0, value, "");
+		}
+
+		PreparedStatement& bindString(const String& value) {
+			return add(STRING, 0, 0, value);
+		}
+
+		PreparedStatement& bindNull() {
+			return add(NULLVALUE, 0, 0, "");
+		}
+
+		void clearParameters() {
+			parameters.removeAll(1, 4);
+		}
+
+		const String& getQuery() const {
+			return query;
+		}
+
+		int getParameterCount() const {
+			return parameters.size();
+		}
+
+		const Parameter& getParameter(int index) const {
+			return parameters.get(index);
+		}
+
+		/**
+		 * Expands the placeholders into escaped literals, for the text protocol
+		 * paths (result set queries and multi row batches)
+		 */
+		String toString() const {
+			StringBuffer buffer;
+			int next = 0;
+
+			for (int i = 0; i < query.length(); ++i) {
+				char c = query.charAt(i);
+
+				if (c != '?' || next >= parameters.size()) {
+					buffer << c;
+					continue;
+				}
+
+				const Parameter& param = parameters.getUnsafe(next++);
+
+				switch (param.type) {
+				case SIGNED:
+					buffer << param.intValue;
+					break;
+				case UNSIGNED:
+					buffer << (uint64) param.intValue;
+					break;
+				case DOUBLE:
+					buffer << param.doubleValue;
+					break;
+				case STRING: {
+					String value = param.stringValue;
+					Database::escapeString(value);
+
+					buffer << "'" << value << "'";
+					break;
+				}
+				default:
+					buffer << "NULL";
+					break;
+				}
+			}
+
+			return buffer.toString();
+		}
+	};
+
+    } // namespace mysql
+  } // namespace db
+} // namespace server
+
+#endif /*PREPAREDSTATEMENT_H_*/
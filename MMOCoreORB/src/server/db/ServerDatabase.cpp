@@ -6,6 +6,7 @@
 
 #include "conf/ConfigManager.h"
 #include "MySqlDatabase.h"
+#include "WriteBehindBatcher.h"
 
 Vector<Database*>* ServerDatabase::databases = nullptr;
 AtomicInteger ServerDatabase::currentDB;
@@ -30,6 +31,9 @@ ServerDatabase::ServerDatabase(ConfigManager* configManager) {
 		databases->add(db);
 	}
 
+	WriteBehindBatcher::instance()->setConfiguration(configManager->getInt("Core3.DBWriteBehind.FlushInterval", 1000),
+			configManager->getInt("Core3.DBWriteBehind.MaxRows", 500));
+
 	try {
 		UniqueReference<ResultSet*> result(instance()->executeQuery("SELECT `schema_version` FROM `db_metadata`;"));
 
@@ -52,6 +56,8 @@ ServerDatabase::ServerDatabase(ConfigManager* configManager) {
 }
 
 ServerDatabase::~ServerDatabase() {
+	WriteBehindBatcher::instance()->flush();
+
 	for (auto db : *databases) {
 		delete db;
 	}
@@ -60,6 +66,22 @@ ServerDatabase::~ServerDatabase() {
 	databases = nullptr;
 }
 
+server::db::mysql::MySqlDatabase* ServerDatabase::getConnection() {
+	return static_cast<server::db::mysql::MySqlDatabase*>(instance());
+}
+
+uint64 ServerDatabase::executePrepared(const server::db::mysql::PreparedStatement& statement) {
+	return getConnection()->executePrepared(statement);
+}
+
+void ServerDatabase::executePreparedAsync(const server::db::mysql::PreparedStatement& statement) {
+	getConnection()->executePreparedAsync(statement);
+}
+
+ResultSet* ServerDatabase::executeQuery(const server::db::mysql::PreparedStatement& statement) {
+	return getConnection()->executeQuery(statement);
+}
+
 void ServerDatabase::alterDatabase(int nextSchemaVersion, const String& alterSql) {
 	if (dbSchemaVersion >= nextSchemaVersion)
 		return;
@@ -7,10 +7,20 @@
 
 #include "engine/engine.h"
 
+#include "server/db/PreparedStatement.h"
+
 namespace conf {
 	class ConfigManager;
 }
 
+namespace server {
+  namespace db {
+    namespace mysql {
+	class MySqlDatabase;
+    }
+  }
+}
+
 class ServerDatabase : public Logger {
 	static Vector<Database*>* databases;
 	static AtomicInteger currentDB;
@@ -29,6 +39,24 @@ public:
 		return databases->get(i);
 	}
 
+	/**
+	 * Pool connection for the next statement, round robin like instance()
+	 */
+	static server::db::mysql::MySqlDatabase* getConnection();
+
+	static uint64 executePrepared(const server::db::mysql::PreparedStatement& statement);
+
+	/**
+	 * Fire and forget, ordered with executeStatement
+	 */
+	static void executePreparedAsync(const server::db::mysql::PreparedStatement& statement);
+
+	static ResultSet* executeQuery(const server::db::mysql::PreparedStatement& statement);
+
+	static int getConnectionCount() {
+		return databases != nullptr ? databases->size() : 0;
+	}
+
 	inline int getSchemaVersion() const {
 		return dbSchemaVersion;
 	}
@@ -0,0 +1,124 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "WriteBehindBatcher.h"
+#include "ServerDatabase.h"
+#include "MySqlDatabase.h"
+#include "DatabaseMetrics.h"
+
+WriteBehindBatcher::WriteBehindBatcher() : Logger("WriteBehindBatcher"), flushInterval(1000), maxRows(500), flushScheduled(false) {
+}
+
+void WriteBehindBatcher::setConfiguration(int flushIntervalMs, int rowLimit) {
+	Locker locker(&mutex);
+
+	flushInterval = Math::max(10, flushIntervalMs);
+	maxRows = Math::max(1, rowLimit);
+
+	info() << "flush interval " << flushInterval << "ms, max rows " << maxRows;
+}
+
+void WriteBehindBatcher::add(const String& prefix, const PreparedStatement& values) {
+	String row = values.toString();
+
+	Reference<Batch*> full;
+
+	Locker locker(&mutex);
+
+	Batch* batch = nullptr;
+
+	for (int i = 0; i < batches.size(); ++i) {
+		if (batches.getUnsafe(i)->prefix == prefix) {
+			batch = batches.getUnsafe(i);
+			break;
+		}
+	}
+
+	if (batch == nullptr) {
+		batch = new Batch(prefix);
+		batches.add(batch);
+	}
+
+	if (batch->rows > 0)
+		batch->values << ", ";
+
+	batch->values << row;
+
+	if (++batch->rows >= maxRows) {
+		full = batch;
+		batches.removeElement(batch);
+	} else {
+		scheduleFlush();
+	}
+
+	locker.release();
+
+	if (full != nullptr) {
+		Core::getTaskManager()->executeTask([this, full] () {
+			write(full);
+		}, "WriteBehindWrite", MySqlDatabase::getTaskQueueName());
+	}
+}
+
+void WriteBehindBatcher::scheduleFlush() {
+	if (flushScheduled)
+		return;
+
+	flushScheduled = true;
+
+	Reference<Task*> task = new LambdaTask([this] () {
+		flush();
+	}, "WriteBehindFlush");
+
+	task->setCustomTaskQueue(MySqlDatabase::getTaskQueueName());
+	task->schedule(flushInterval);
+}
+
+void WriteBehindBatcher::flush() {
+	Vector<Reference<Batch*> > pending;
+
+	Locker locker(&mutex);
+
+	pending = batches;
+	batches.removeAll();
+	flushScheduled = false;
+
+	locker.release();
+
+	for (int i = 0; i < pending.size(); ++i)
+		write(pending.getUnsafe(i));
+}
+
+void WriteBehindBatcher::write(Batch* batch) {
+	String statement = batch->prefix + " " + batch->values.toString() + ";";
+
+	Timer timer(Time::MONOTONIC_TIME);
+	timer.start();
+
+	bool failed = false;
+
+	try {
+		ServerDatabase::getConnection()->doExecuteStatement(statement);
+	} catch (const Exception& e) {
+		error() << "lost " << batch->rows << " rows: " << e.getMessage();
+
+		failed = true;
+	}
+
+	DatabaseMetrics::instance()->record("batch " + batch->prefix, timer.stop() / 1000, failed);
+
+	totalRows.add(batch->rows);
+	totalStatements.increment();
+}
+
+int WriteBehindBatcher::getPendingRows() {
+	Locker locker(&mutex);
+
+	int rows = 0;
+
+	for (int i = 0; i < batches.size(); ++i)
+		rows += batches.getUnsafe(i)->rows;
+
+	return rows;
+}
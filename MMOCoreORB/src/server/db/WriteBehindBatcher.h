@@ -0,0 +1,81 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef WRITEBEHINDBATCHER_H_
+#define WRITEBEHINDBATCHER_H_
+
+#include "engine/engine.h"
+
+#include "PreparedStatement.h"
+
+namespace server {
+  namespace db {
+    namespace mysql {
+
+	/**
+	 * Coalesces fire and forget inserts that share the same
+	 * "INSERT INTO `table` (columns) VALUES" prefix into multi row statements.
+	 * Rows are written on the mysql task queue when a prefix reaches the row
+	 * limit or when the flush interval elapses, so they can land after
+	 * statements executed later. Only for rows nothing reads back or
+	 * updates right away.
+	 */
+	class WriteBehindBatcher : public Singleton<WriteBehindBatcher>, public Logger, public Object {
+		class Batch : public Object {
+		public:
+			String prefix;
+			StringBuffer values;
+			int rows;
+
+			Batch(const String& pre) : prefix(pre), rows(0) {
+			}
+		};
+
+		Mutex mutex;
+		Vector<Reference<Batch*> > batches;
+
+		int flushInterval;
+		int maxRows;
+		bool flushScheduled;
+
+		AtomicLong totalRows;
+		AtomicLong totalStatements;
+
+		void write(Batch* batch);
+		void scheduleFlush();
+
+	public:
+		WriteBehindBatcher();
+
+		void setConfiguration(int flushIntervalMs, int rowLimit);
+
+		/**
+		 * @param prefix "INSERT INTO `table` (`a`, `b`) VALUES"
+		 * @param values one row, "(?, ?)" with its parameters bound
+		 */
+		void add(const String& prefix, const PreparedStatement& values);
+
+		/**
+		 * Writes everything pending on the calling thread
+		 */
+		void flush();
+
+		int getPendingRows();
+
+		uint64 getTotalRows() const {
+			return totalRows.get();
+		}
+
+		uint64 getTotalStatements() const {
+			return totalStatements.get();
+		}
+	};
+
+    } // namespace mysql
+  } // namespace db
+} // namespace server
+
+using namespace server::db::mysql;
+
+#endif /*WRITEBEHINDBATCHER_H_*/
@@ -18,6 +18,7 @@
 #include "server/login/packets/LoginClusterStatus.h"
 #include "server/login/packets/LoginEnumCluster.h"
 #include "server/ServerCore.h"
+#include "server/db/WriteBehindBatcher.h"
 
 #include "server/zone/managers/object/ObjectManager.h"
 
@@ -112,16 +113,17 @@ void AccountManager::loginApprovedAccount(LoginClient* client, ManagedReference<
 	SessionAPIClient::instance()->notifySessionStart(ip, accountID);
 #endif // WITH_SESSION_API
 
-	StringBuffer sessionQuery;
-	sessionQuery << "REPLACE INTO sessions (account_id, session_id, ip, expires) VALUES (";
-	sessionQuery << accountID << ", '" << sessionID << "', '" << ip << "' , ADDTIME(NOW(), '00:15'));";
+	PreparedStatement sessionQuery("REPLACE INTO sessions (account_id, session_id, ip, expires) VALUES (?, ?, ?, ADDTIME(NOW(), '00:15'));");
+	sessionQuery.bindUnsigned(accountID).bindString(sessionID).bindString(ip);
 
-	StringBuffer logQuery;
-	logQuery << "INSERT INTO account_log (account_id, ip_address, timestamp) VALUES (" << accountID << ", '" << ip << "', NOW());";
+	PreparedStatement logRow("(?, ?, NOW())");
+	logRow.bindUnsigned(accountID).bindString(ip);
 
 	try {
-		ServerDatabase::instance()->executeStatement(sessionQuery);
-		ServerDatabase::instance()->executeStatement(logQuery);
+		ServerDatabase::executePreparedAsync(sessionQuery);
+
+		// nothing reads account_log back, let it ride with the next batch
+		WriteBehindBatcher::instance()->add("INSERT INTO account_log (account_id, ip_address, timestamp) VALUES", logRow);
 	} catch (const DatabaseException& e) {
 		client->error() << e.getMessage();
 	}
@@ -14,27 +14,23 @@ namespace server {
 namespace metrics {
 	class Metrics {
 		String path;
-		bool active;
 
 	public:
 		Metrics() {
-			active = ConfigManager::instance()->shouldUseMetrics();
 		}
 
 		Metrics(const char* path) : path(path) {
-			active = ConfigManager::instance()->shouldUseMetrics();
 		}
 
 		Metrics(String&& path) : path(std::move(path)) {
-			active = ConfigManager::instance()->shouldUseMetrics();
 		}
 
 		Metrics(const String& path) : path(path) {
-			active = ConfigManager::instance()->shouldUseMetrics();
 		}
 
 		void publishMetrics(const String& name, const char* value, const char* type) const {
-			if (!active)
+			// read from the config snapshot so a reload can turn metrics on or off
+			if (!ConfigManager::instance()->shouldUseMetrics())
 				return;
 
 			MetricsManager::Result result = MetricsManager::instance()->publish(
@@ -0,0 +1,186 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.
+*/
+
+#ifndef WEIGHTEDSAMPLER_H_
+#define WEIGHTEDSAMPLER_H_
+
+#include "system/lang.h"
+
+namespace server {
+namespace utils {
+
+/**
+ * Immutable weighted index sampler, rebuilt whenever the weights change.
+ *
+ * sample() uses an integer Vose alias table: one column pick plus one
+ * threshold compare, so the distribution is exactly weight / total with no
+ * floating point rounding. The cumulative table answers the "first entry whose
+ * running total reaches the roll" lookups the loot scripts are written
+ * against with a binary search instead of a linear walk.
+ *
+ * Negative weights are treated as zero, sample() expects the total to fit in 32 bits.
+ */
+class WeightedSampler {
+	Vector<int> weights;
+	Vector<int64> cumulative;
+
+	// column i keeps its own index while the draw is below threshold[i], in units of total
+	Vector<int64> thresholds;
+	Vector<int> aliases;
+
+	int64 totalWeight;
+
+public:
+	WeightedSampler() : weights(1, 1), cumulative(1, 1), thresholds(1, 1), aliases(1, 1), totalWeight(0) {
+	}
+
+	void build(const Vector<int>& values) {
+		int count = values.size();
+
+		weights.removeAll(count, 1);
+		cumulative.removeAll(count, 1);
+		thresholds.removeAll(count, 1);
+		aliases.removeAll(count, 1);
+		totalWeight = 0;
+
+		for (int i = 0; i < count; ++i) {
+			int weight = Math::max(0, values.getUnsafe(i));
+
+			totalWeight += weight;
+
+			weights.add(weight);
+			cumulative.add(totalWeight);
+		}
+
+		if (totalWeight <= 0)
+			return;
+
+		// scaled weight of every column is weight * count, a full column holds totalWeight
+		Vector<int> small(count, 1);
+		Vector<int> large(count, 1);
+
+		for (int i = 0; i < count; ++i) {
+			int64 scaled = (int64) weights.getUnsafe(i) * count;
+
+			thresholds.add(scaled);
+			aliases.add(i);
+
+			if (scaled < totalWeight)
+				small.add(i);
+			else
+				large.add(i);
+		}
+
+		while (small.size() > 0 && large.size() > 0) {
+			int less = small.remove(small.size() - 1);
+			int more = large.get(large.size() - 1);
+
+			aliases.set(less, more);
+
+			int64 remaining = thresholds.getUnsafe(more) - (totalWeight - thresholds.getUnsafe(less));
+			thresholds.set(more, remaining);
+
+			if (remaining < totalWeight) {
+				large.remove(large.size() - 1);
+				small.add(more);
+			}
+		}
+
+		// whatever is left is full up to rounding
+		for (int i = 0; i < large.size(); ++i)
+			thresholds.set(large.getUnsafe(i), totalWeight);
+
+		for (int i = 0; i < small.size(); ++i)
+			thresholds.set(small.getUnsafe(i), totalWeight);
+	}
+
+	/**
+	 * Alias table lookup for a column and a draw in [0, total weight)
+	 */
+	int select(int column, int64 draw) const {
+		if (column < 0 || column >= thresholds.size())
+			return -1;
+
+		return draw < thresholds.getUnsafe(column) ? column : aliases.getUnsafe(column);
+	}
+
+	/**
+	 * Returns an index with probability weight / total weight, -1 when every weight is zero
+	 */
+	int sample() const {
+		if (totalWeight <= 0)
+			return -1;
+
+		int column = System::random(thresholds.size() - 1);
+		int64 draw = System::random(totalWeight - 1);
+
+		return select(column, draw);
+	}
+
+	/**
+	 * First index whose running total is above value, the inverse of a
+	 * uniform choice in [0, total weight). -1 when value is out of range.
+	 */
+	int findAbove(int64 value) const {
+		int low = 0;
+		int high = cumulative.size();
+
+		while (low < high) {
+			int mid = (low + high) >> 1;
+
+			if (cumulative.getUnsafe(mid) > value)
+				high = mid;
+			else
+				low = mid + 1;
+		}
+
+		return low < cumulative.size() ? low : -1;
+	}
+
+	/**
+	 * First index whose running total reaches roll, -1 when the total is below roll.
+	 * With skipEmpty zero weight entries are passed over, matching loops that
+	 * test both the running total and the entry weight.
+	 */
+	int findAtLeast(int64 roll, bool skipEmpty = false) const {
+		int low = 0;
+		int high = cumulative.size();
+
+		while (low < high) {
+			int mid = (low + high) >> 1;
+
+			if (cumulative.getUnsafe(mid) >= roll)
+				high = mid;
+			else
+				low = mid + 1;
+		}
+
+		if (skipEmpty) {
+			while (low < weights.size() && weights.getUnsafe(low) <= 0)
+				++low;
+		}
+
+		return low < cumulative.size() ? low : -1;
+	}
+
+	int size() const {
+		return weights.size();
+	}
+
+	int getWeight(int index) const {
+		return weights.get(index);
+	}
+
+	int64 getTotalWeight() const {
+		return totalWeight;
+	}
+};
+
+}
+}
+
+using namespace server::utils;
+
+#endif /* WEIGHTEDSAMPLER_H_ */
@@ -56,6 +56,8 @@ void APIProxyConfigManager::handlePUT(APIRequest& apiRequest) {
 		return;
 	}
 
+	ConfigManager::instance()->dispatchChangeNotifications();
+
 	JSONSerializationType metadata;
 
 	Time now;
@@ -92,6 +94,8 @@ void APIProxyConfigManager::handlePOST(APIRequest& apiRequest) {
 		return;
 	}
 
+	ConfigManager::instance()->dispatchChangeNotifications();
+
 	JSONSerializationType metadata;
 
 	Time now;
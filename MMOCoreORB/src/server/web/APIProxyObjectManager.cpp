@@ -18,6 +18,12 @@
 #include "server/zone/objects/tangible/tool/antidecay/AntiDecayKit.h"
 #include "server/zone/managers/auction/AuctionManager.h"
 #include "server/zone/managers/auction/AuctionsMap.h"
+#include "server/zone/objects/creature/CreatureObject.h"
+#include "server/zone/objects/player/PlayerObject.h"
+#include "server/login/account/AccountManager.h"
+#include "server/login/objects/CharacterList.h"
+#include "server/zone/Zone.h"
+#include "conf/ConfigManager.h"
 
 #include "APIProxyObjectManager.h"
 #include "APIRequest.h"
@@ -138,6 +144,276 @@ void APIProxyObjectManager::handleGET(APIRequest& apiRequest) {
 	}
 }
 
+int APIProxyObjectManager::streamObjectJSON(APIRequest& apiRequest, uint64 oid, int maxDepth) {
+	auto obj = Core::lookupObject(oid).castTo<ManagedObject*>();
+
+	if (obj == nullptr) {
+		return 0;
+	}
+
+	int countFound = 0;
+	auto objects = JSONSerializationType::object();
+
+	auto scno = dynamic_cast<SceneObject*>(obj.get());
+
+	if (scno != nullptr) {
+		// Locks each object only while it is written into the snapshot
+		countFound += scno->writeRecursiveJSON(objects, maxDepth);
+	} else {
+		JSONSerializationType jsonData;
+
+		ReadLocker lock(obj);
+		obj->writeJSON(jsonData);
+		lock.release();
+
+		countFound++;
+		jsonData["_depth"] = 0;
+		jsonData["_oid"] = oid;
+		jsonData["_className"] = obj->_getClassName();
+		jsonData["_oidPath"] = JSONSerializationType::array();
+		jsonData["_oidPath"].push_back(oid);
+		objects[String::valueOf(oid)] = jsonData;
+	}
+
+	// Serialized and sent with no object locked
+	for (auto entry = objects.begin(); entry != objects.end(); ++entry) {
+		apiRequest.streamEntry(entry.key().c_str(), entry.value());
+	}
+
+	return countFound;
+}
+
+bool APIProxyObjectManager::collectBulkObjects(APIRequest& apiRequest, SortedVector<uint64>& oids, JSONSerializationType& query) {
+	auto server = getZoneServer();
+
+	if (server == nullptr) {
+		apiRequest.fail("Failed to getZoneServer");
+		return false;
+	}
+
+	bool hasFilter = false;
+
+	if (apiRequest.hasQueryField("oids")) {
+		StringTokenizer oidStrList(apiRequest.getQueryFieldString("oids"));
+		oidStrList.setDelimeter(",");
+
+		while (oidStrList.hasMoreTokens()) {
+			oids.put(oidStrList.getUnsignedLongToken());
+		}
+
+		query["oids"] = apiRequest.getQueryFieldString("oids");
+		hasFilter = true;
+	}
+
+	if (apiRequest.isMethodPOST()) {
+		if (!apiRequest.parseRequestJSON()) {
+			return false;
+		}
+
+		const auto& requestJSON = apiRequest.getRequestJSON();
+
+		if (!requestJSON.contains("oids") || !requestJSON["oids"].is_array()) {
+			apiRequest.fail("Invalid request, body must be {\"oids\": [...]}");
+			return false;
+		}
+
+		for (const auto& oid : requestJSON["oids"]) {
+			if (oid.is_number_unsigned()) {
+				oids.put(oid.get<uint64>());
+			}
+		}
+
+		query["body_oids"] = requestJSON["oids"].size();
+		hasFilter = true;
+	}
+
+	if (apiRequest.hasQueryField("zone")) {
+		auto zoneName = apiRequest.getQueryFieldString("zone");
+		auto type = apiRequest.getQueryFieldString("type", false, "all");
+
+		if (type != "all" && type != "structure" && type != "building" && type != "installation" && type != "player") {
+			apiRequest.fail("Invalid request, type must be one of: all, structure, building, installation, player");
+			return false;
+		}
+
+		auto zone = server->getZone(zoneName);
+
+		if (zone == nullptr) {
+			apiRequest.fail("Zone not found (zone: " + zoneName + ")");
+			return false;
+		}
+
+		// Only holds the zone while the references are copied out of the quad tree
+		SortedVector<ManagedReference<QuadTreeEntry*> > objects;
+		zone->getInRangeObjects(0, 0, 8192 * 1.5f, &objects, true, false);
+
+		for (int i = 0; i < objects.size(); ++i) {
+			auto scno = static_cast<SceneObject*>(objects.getUnsafe(i).get());
+
+			if (scno == nullptr) {
+				continue;
+			}
+
+			if ((type == "structure" && !scno->isStructureObject())
+				|| (type == "building" && !scno->isBuildingObject())
+				|| (type == "installation" && !scno->isInstallationObject())
+				|| (type == "player" && !scno->isPlayerCreature())) {
+				continue;
+			}
+
+			oids.put(scno->getObjectID());
+		}
+
+		query["zone"] = zoneName;
+		query["type"] = type;
+		hasFilter = true;
+	}
+
+	if (apiRequest.hasQueryField("owner")) {
+		auto ownerID = apiRequest.getQueryFieldUnsignedLong("owner");
+
+		Reference<CreatureObject*> creo = server->getObject(ownerID).castTo<CreatureObject*>();
+		Reference<PlayerObject*> ghost = creo != nullptr ? creo->getPlayerObject() : nullptr;
+
+		if (ghost == nullptr) {
+			apiRequest.fail("Player not found (owner: " + String::valueOf(ownerID) + ")");
+			return false;
+		}
+
+		for (int i = 0; i < ghost->getTotalOwnedStructureCount(); ++i) {
+			oids.put(ghost->getOwnedStructure(i));
+		}
+
+		query["owner"] = ownerID;
+		hasFilter = true;
+	}
+
+	if (apiRequest.hasQueryField("account")) {
+		auto accountID = apiRequest.getQueryFieldUnsignedLong("account");
+
+		Reference<Account*> account = AccountManager::getAccount(accountID);
+
+		if (account == nullptr) {
+			apiRequest.fail("Account not found (account: " + String::valueOf(accountID) + ")");
+			return false;
+		}
+
+		Reference<const CharacterList*> characters = account->getCharacterList();
+
+		for (int i = 0; characters != nullptr && i < characters->size(); ++i) {
+			const CharacterListEntry* entry = &characters->get(i);
+
+			if (entry->getGalaxyID() == server->getGalaxyID()) {
+				oids.put(entry->getObjectID());
+			}
+		}
+
+		query["account"] = accountID;
+		hasFilter = true;
+	}
+
+	if (!hasFilter) {
+		apiRequest.fail("Invalid request, must specify one of: oids, zone, owner, account");
+		return false;
+	}
+
+	return true;
+}
+
+void APIProxyObjectManager::handleBulk(APIRequest& apiRequest) {
+	if (!apiRequest.isMethodGET() && !apiRequest.isMethodPOST()) {
+		apiRequest.fail("Only supports GET and POST");
+		return;
+	}
+
+	auto recursive = apiRequest.getQueryFieldBool("recursive", false, false);
+	int maxDepth = apiRequest.getQueryFieldUnsignedLong("maxdepth", false, 1000);
+	auto cursor = apiRequest.getQueryFieldUnsignedLong("cursor", false, 0);
+	auto limit = apiRequest.getQueryFieldUnsignedLong("limit", false, 500);
+	uint64 maxLimit = ConfigManager::instance()->getInt("Core3.RESTServer.BulkMaxLimit", 5000);
+
+	if (limit == 0 || limit > maxLimit) {
+		apiRequest.fail("Invalid request, limit must be between 1 and " + String::valueOf(maxLimit));
+		return;
+	}
+
+	Timer msSearch, msExport;
+	SortedVector<uint64> oids;
+	auto query = JSONSerializationType::object();
+
+	oids.setNoDuplicateInsertPlan();
+
+	msSearch.start();
+
+	try {
+		if (!collectBulkObjects(apiRequest, oids, query)) {
+			return;
+		}
+	} catch (const Exception& e) {
+		apiRequest.fail("Exception looking up objects", "Exception: " + e.getMessage());
+		return;
+	}
+
+	msSearch.stop();
+
+	// The page starts after the last oid sent, objects created or deleted between pages don't shift it
+	int first = 0;
+	int last = oids.size();
+
+	while (first < last) {
+		int middle = (first + last) / 2;
+
+		if (oids.getUnsafe(middle) <= cursor) {
+			first = middle + 1;
+		} else {
+			last = middle;
+		}
+	}
+
+	int stop = Math::min(oids.size(), (int)(first + limit));
+	int countFound = 0;
+	uint64 lastOid = cursor;
+
+	apiRequest.streamBegin("objects");
+
+	msExport.start();
+
+	for (int i = first; i < stop; ++i) {
+		lastOid = oids.getUnsafe(i);
+
+		try {
+			countFound += streamObjectJSON(apiRequest, lastOid, recursive ? maxDepth : 1);
+		} catch (const Exception& e) {
+			apiRequest.error() << "Exception exporting " << lastOid << ": " << e.getMessage();
+		}
+	}
+
+	msExport.stop();
+
+	JSONSerializationType metadata;
+
+	Time now;
+	metadata["exportTime"] = now.getFormattedTimeFull();
+	metadata["objectCount"] = countFound;
+	metadata["maxDepth"] = maxDepth;
+	metadata["recursive"] = recursive;
+	metadata["msSearch"] = msSearch.getElapsedTimeMs();
+	metadata["msExport"] = msExport.getElapsedTimeMs();
+	metadata["query"] = query;
+
+	// Pagination data, pass next_cursor back as cursor until it is 0
+	metadata["cursor"] = cursor;
+	metadata["limit"] = limit;
+	metadata["total"] = oids.size();
+	metadata["resultsRemaining"] = oids.size() - stop;
+	metadata["next_cursor"] = stop < oids.size() ? lastOid : 0;
+
+	JSONSerializationType result;
+	result["metadata"] = metadata;
+
+	apiRequest.streamEnd(result);
+}
+
 int APIProxyObjectManager::deleteObject(APIRequest& apiRequest, uint64 oid, bool refundADK, String& resultMessage) {
 	auto obj = Core::lookupObject(oid).castTo<ManagedObject*>();
 
@@ -22,11 +22,14 @@ namespace server {
 		}
 
 		void handle(APIRequest& apiRequest);
+		void handleBulk(APIRequest& apiRequest);
 	private:
 		void handleGET(APIRequest& apiRequest);
 		void handlePUT(APIRequest& apiRequest);
 		void handleDELETE(APIRequest& apiRequest);
 		int writeObjectJSON(uint64 oid, bool recursive, bool parents, JSONSerializationType& objects, int maxDepth);
+		int streamObjectJSON(APIRequest& apiRequest, uint64 oid, int maxDepth);
+		bool collectBulkObjects(APIRequest& apiRequest, SortedVector<uint64>& oids, JSONSerializationType& query);
 		int deleteObject(APIRequest& apiRequest, uint64 oid, bool refundADK, String& resultMessage);
 		bool updateObject(APIRequest& apiRequest, uint64 oid, String& resultMessage);
 		String exportJSON(ManagedObject* obj, const String& exportNote);
@@ -133,6 +133,17 @@ void APIProxyPlayerManager::lookupCharacter(APIRequest& apiRequest) {
 
 	msSearch.stop();
 
+	// The last oid of the previous page, takes the place of offset so a page doesn't shift as characters are created
+	if (apiRequest.hasQueryField("cursor")) {
+		auto qCursor = apiRequest.getQueryFieldUnsignedLong("cursor");
+
+		qOffset = 0;
+
+		while (qOffset < hits.size() && hits.get(qOffset) <= qCursor) {
+			qOffset++;
+		}
+	}
+
 	msExport.start();
 
 	auto stop = qOffset + qLimit > hits.size() ? hits.size() : qOffset + qLimit;
@@ -219,6 +230,8 @@ void APIProxyPlayerManager::lookupCharacter(APIRequest& apiRequest) {
         metadata["resultsRemaining"] = 0;
     }
 
+	metadata["next_cursor"] = stop < hits.size() && stop > 0 ? hits.get(stop - 1) : 0;
+
 	JSONSerializationType result;
 
 	result["metadata"] = metadata;
@@ -40,6 +40,9 @@ APIRequest::APIRequest(http_request gatewayRequest, const String endpointKey, Lo
 	mParsedRequestJSON = false;
 	mReplied = false;
 	mFailed = false;
+	mStreamBuffer = nullptr;
+	mStreamCount = 0;
+	mStreamBytes = 0;
 	mEndpointKey = endpointKey;
 	setLoggingName("APIRequest " + mTrxId);
 	setLoggerCallback([this, &logger] (Logger::LogLevel level, const char* msg) -> int {
@@ -55,6 +58,15 @@ APIRequest::APIRequest(http_request gatewayRequest, const String endpointKey, Lo
 }
 
 APIRequest::~APIRequest() {
+	if (mStreamBuffer != nullptr) {
+		// The client gets a truncated body instead of waiting on a stream nobody writes to
+		if (mStreamBuffer->can_write()) {
+			mStreamBuffer->close(std::ios_base::out).wait();
+		}
+
+		delete mStreamBuffer;
+		mStreamBuffer = nullptr;
+	}
 }
 
 String APIRequest::toString() const {
@@ -352,6 +364,75 @@ void APIRequest::reply(JSONSerializationType result, const String& status, APIRe
 	mGatewayRequest.reply(response);
 }
 
+void APIRequest::streamBegin(const String& collectionName) {
+	if (mReplied) {
+		throw APIRequestException("Duplicate reply attempt: stream " + collectionName);
+	}
+
+	mReplied = true;
+	mStreamBuffer = new Concurrency::streams::producer_consumer_buffer<uint8_t>();
+
+	http_response response(status_codes::OK);
+
+	// No content length, the listener sends the body chunked as it is written
+	response.set_body(mStreamBuffer->create_istream(), U("application/json"));
+
+	mGatewayRequest.reply(response);
+
+	JSONSerializationType name = collectionName;
+
+	streamWrite("{" + name.dump() + ":{");
+}
+
+void APIRequest::streamEntry(const String& key, const JSONSerializationType& value) {
+	if (mStreamBuffer == nullptr) {
+		throw APIRequestException("streamEntry before streamBegin");
+	}
+
+	JSONSerializationType name = key;
+
+	std::string entry = (mStreamCount++ > 0 ? "," : "") + name.dump() + ":" + value.dump();
+
+	streamWrite(entry);
+}
+
+void APIRequest::streamWrite(const std::string& data) {
+	if (mStreamBuffer == nullptr) {
+		throw APIRequestException("streamWrite before streamBegin");
+	}
+
+	mStreamBuffer->putn_nocopy(reinterpret_cast<const uint8_t*>(data.data()), data.size()).wait();
+	mStreamBytes += data.size();
+}
+
+void APIRequest::streamEnd(JSONSerializationType result, const String& status, APIRequestStatusValue status_code) {
+	if (mStreamBuffer == nullptr) {
+		throw APIRequestException("streamEnd before streamBegin");
+	}
+
+	mFailed = status != "OK";
+
+	result["status"] = status;
+	result["status_code"] = (APIRequestStatusValue)(status_code);
+	result["trx_id"] = mTrxId;
+
+	if (!result.contains("debug")) {
+		result["debug"] = JSONSerializationType::object();
+	}
+
+	result["debug"]["req_time_ms"] = getElapsedTimeMS();
+	result["debug"]["streamed_entries"] = mStreamCount;
+
+	// Drop the opening brace, the fields follow the collection
+	streamWrite("}," + result.dump().substr(1));
+
+	mStreamBuffer->close(std::ios_base::out).wait();
+
+#if DEBUG_RESTAPI
+	debug() << "STREAMED " << mStreamBytes << " bytes " << toString();
+#endif // DEBUG_RESTAPI
+}
+
 void APIRequest::success(JSONSerializationType result, APIRequestStatusValue status_code) {
 	mFailed = false;
 
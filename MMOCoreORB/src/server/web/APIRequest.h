@@ -15,6 +15,7 @@
 
 #include <cpprest/http_listener.h>
 #include <cpprest/json.h>
+#include <cpprest/producerconsumerstream.h>
 
 namespace server {
  namespace web3 {
@@ -42,6 +43,11 @@ namespace server {
 		bool mFailed;
 		bool mParsedRequestJSON;
 
+		// Body of a streamed reply, the listener sends what is written as chunks
+		Concurrency::streams::producer_consumer_buffer<uint8_t>* mStreamBuffer;
+		int mStreamCount;
+		uint64 mStreamBytes;
+
 		bool parseQueryFields();
 		void reply(JSONSerializationType result, const String& status, APIRequestStatusValue status_code);
 		bool stringToBool(const String& boolStr) const;
@@ -112,6 +118,29 @@ namespace server {
 		uint64_t getRequestFieldUnsignedLong(const String& fieldName, bool required=true, uint64_t defaultValue=0);
 		bool getRequestFieldBool(const String& fieldName, bool required=true, bool defaultValue=false);
 
+		inline bool isStreaming() const {
+			return mStreamBuffer != nullptr;
+		}
+
+		inline uint64 getStreamBytes() const {
+			return mStreamBytes;
+		}
+
+		/**
+		 * Replies with a chunked body opening the object collectionName, the
+		 * entries are sent by streamEntry() as they are serialized and
+		 * streamEnd() closes the reply
+		 */
+		void streamBegin(const String& collectionName);
+		void streamEntry(const String& key, const JSONSerializationType& value);
+		void streamWrite(const std::string& data);
+
+		/**
+		 * Appends the fields of result after the collection with the status fields
+		 * success() would send, the HTTP status is always OK once streaming started
+		 */
+		void streamEnd(JSONSerializationType result, const String& status="OK", APIRequestStatusValue status_code=APIRequestStatus::OK);
+
 		void success(JSONSerializationType result, APIRequestStatusValue status_code=APIRequestStatus::OK);
 		void fail(const String& userMessage, const String& logMessage="", const APIRequestStatusValue status_code=APIRequestStatus::BadRequest);
 	};
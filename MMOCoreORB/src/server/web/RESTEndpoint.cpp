@@ -19,12 +19,89 @@ using namespace server::web3;
 RESTEndpoint::RESTEndpoint(const String &regex, ArrayList<String> pathFieldNames, Function<void(APIRequest& apiRequest)> handler)
 	: mRegExStr(regex), mPathFieldNames(pathFieldNames), mHandler(handler) {
 
-		mRegEx = std::regex(regex.toCharArray());
+	compile();
 }
 
 void RESTEndpoint::setRegEx(const String &regex) {
 	mRegExStr = regex;
-	mRegEx = std::regex(regex.toCharArray());
+
+	compile();
+}
+
+void RESTEndpoint::compile() {
+	mRegEx = std::regex(mRegExStr.toCharArray(), std::regex::optimize);
+
+	mMethods.removeAll();
+	mPathPrefix = "";
+
+	// The method ends at the first ':' that doesn't open a "(?:" group
+	int methodEnd = -1;
+
+	for (int i = 0; i < mRegExStr.length() && methodEnd == -1; ++i) {
+		if (mRegExStr.charAt(i) == ':' && (i == 0 || mRegExStr.charAt(i - 1) != '?'))
+			methodEnd = i;
+	}
+
+	if (methodEnd <= 0)
+		return;
+
+	String methods = mRegExStr.subString(0, methodEnd);
+
+	if (methods.beginsWith("(?:"))
+		methods = methods.subString(3);
+	else if (methods.beginsWith("("))
+		methods = methods.subString(1);
+
+	if (methods.endsWith(")"))
+		methods = methods.subString(0, methods.length() - 1);
+
+	StringTokenizer methodList(methods);
+	methodList.setDelimeter("|");
+
+	while (methodList.hasMoreTokens()) {
+		String method;
+		methodList.getStringToken(method);
+
+		for (int i = 0; i < method.length(); ++i) {
+			char c = method.charAt(i);
+
+			// Not a plain list of methods, index it for any method
+			if (c < 'A' || c > 'Z') {
+				mMethods.removeAll();
+				return;
+			}
+		}
+
+		if (!method.isEmpty())
+			mMethods.add(method);
+	}
+
+	// Copy the path up to the first regex syntax, an optional character isn't part of the prefix
+	StringBuffer literal;
+	int lastSeparator = -1;
+
+	for (int i = methodEnd + 1; i < mRegExStr.length(); ++i) {
+		char c = mRegExStr.charAt(i);
+
+		if (strchr("\\^$.|?*+()[]{}", c) != nullptr) {
+			if ((c == '?' || c == '*' || c == '{') && literal.length() > 0 && literal.length() - 1 == lastSeparator)
+				lastSeparator = -1;
+
+			break;
+		}
+
+		if (c == '/')
+			lastSeparator = literal.length();
+
+		literal << c;
+	}
+
+	String path = literal.toString();
+
+	if (!path.beginsWith("/") || lastSeparator <= 0)
+		return;
+
+	mPathPrefix = path.subString(0, lastSeparator + 1);
 }
 
 void RESTEndpoint::setPathFieldNames(ArrayList<String> pathFieldNames) {
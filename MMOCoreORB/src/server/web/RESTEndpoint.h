@@ -43,6 +43,12 @@ class RESTEndpoint {
 		ArrayList<String> mPathFieldNames;
 		Function<void(APIRequest& apiRequest)> mHandler;
 
+		// Taken from the regex when it is set, used by RESTRouteTrie to index the endpoint
+		ArrayList<String> mMethods;
+		String mPathPrefix;
+
+		void compile();
+
 	public:
 		RESTEndpoint() {
 		}
@@ -56,6 +62,22 @@ class RESTEndpoint {
 		bool isMatch(const String& endpointKey) const;
 		int getWeight() const;
 		HashTable<String, String> getPathFields(const String& endpointKey) const;
+
+		/**
+		 * Methods named in front of the regex, empty when the regex can match any method
+		 */
+		inline const ArrayList<String>& getMethods() const {
+			return mMethods;
+		}
+
+		/**
+		 * Literal path segments every match starts with, e.g. "/v1/object/" for
+		 * "(?:GET|DELETE):/v1/object/(?:(\\d*)/|)"
+		 */
+		inline const String& getPathPrefix() const {
+			return mPathPrefix;
+		}
+
 		void handle(APIRequest& apiRequest) const;
 		String toStringData() const;
 };
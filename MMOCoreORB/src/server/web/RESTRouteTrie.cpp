@@ -0,0 +1,140 @@
+/*
+                Copyright <SWGEmu>
+        See file COPYING for copying conditions.*/
+
+/**
+ * @file        : RESTRouteTrie.cpp
+ * @created     : Sun Oct 18 09:12:44 UTC 2026
+ */
+
+#ifdef WITH_REST_API
+
+#include "RESTRouteTrie.h"
+
+using namespace server::web3;
+
+RESTRouteTrie::RESTRouteTrie() {
+	mMethodRoots.setNoDuplicateInsertPlan();
+
+	removeAll();
+}
+
+void RESTRouteTrie::removeAll() {
+	mEndpoints.removeAll();
+	mMethodRoots.removeAll();
+	mAnyMethod = new Node();
+	mNodeCount = 1;
+}
+
+const RESTEndpoint& RESTRouteTrie::add(const RESTEndpoint& endpoint) {
+	int index = mEndpoints.size();
+
+	mEndpoints.add(endpoint);
+
+	const auto& methods = endpoint.getMethods();
+
+	if (methods.size() == 0) {
+		insert(mAnyMethod, endpoint.getPathPrefix(), index);
+	} else {
+		for (const auto& method : methods) {
+			Reference<Node*> root = mMethodRoots.get(method);
+
+			if (root == nullptr) {
+				root = new Node();
+				mMethodRoots.put(method, root);
+				mNodeCount++;
+			}
+
+			insert(root, endpoint.getPathPrefix(), index);
+		}
+	}
+
+	return mEndpoints.get(index);
+}
+
+void RESTRouteTrie::insert(Node* root, const String& pathPrefix, int index) {
+	Node* node = root;
+
+	// "/v1/object/" descends "v1" then "object"
+	int start = 1;
+
+	for (int i = 1; i < pathPrefix.length(); ++i) {
+		if (pathPrefix.charAt(i) != '/')
+			continue;
+
+		String segment = pathPrefix.subString(start, i);
+		start = i + 1;
+
+		Reference<Node*> child = node->children.get(segment);
+
+		if (child == nullptr) {
+			child = new Node();
+			node->children.put(segment, child);
+			mNodeCount++;
+		}
+
+		node = child;
+	}
+
+	node->endpoints.add(index);
+}
+
+void RESTRouteTrie::findBest(Node* root, const String& path, const String& endpointKey, int& hitIndex) {
+	Node* node = root;
+	int start = 1;
+	int i = 1;
+
+	while (node != nullptr) {
+		for (int j = 0; j < node->endpoints.size(); ++j) {
+			int index = node->endpoints.getUnsafe(j);
+
+			if (hitIndex != -1) {
+				int weight = mEndpoints.get(index).getWeight();
+				int hitWeight = mEndpoints.get(hitIndex).getWeight();
+
+				if (weight < hitWeight || (weight == hitWeight && index > hitIndex))
+					continue;
+			}
+
+			if (mEndpoints.get(index).isMatch(endpointKey))
+				hitIndex = index;
+		}
+
+		while (i < path.length() && path.charAt(i) != '/')
+			++i;
+
+		if (i >= path.length())
+			return;
+
+		node = node->children.get(path.subString(start, i));
+		start = ++i;
+	}
+}
+
+const RESTEndpoint* RESTRouteTrie::find(const String& endpointKey) {
+	int colon = endpointKey.indexOf(':');
+
+	if (colon <= 0)
+		return nullptr;
+
+	String path = endpointKey.subString(colon + 1);
+
+	if (!path.beginsWith("/"))
+		return nullptr;
+
+	int hitIndex = -1;
+
+	Node* root = mMethodRoots.get(endpointKey.subString(0, colon));
+
+	if (root != nullptr)
+		findBest(root, path, endpointKey, hitIndex);
+
+	findBest(mAnyMethod, path, endpointKey, hitIndex);
+
+	if (hitIndex == -1)
+		return nullptr;
+
+	return &mEndpoints.get(hitIndex);
+}
+
+#endif // WITH_REST_API
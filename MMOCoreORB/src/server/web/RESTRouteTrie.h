@@ -0,0 +1,72 @@
+/*
+                Copyright <SWGEmu>
+        See file COPYING for copying conditions.*/
+
+/**
+ * @file        : RESTRouteTrie.h
+ * @created     : Sun Oct 18 09:12:44 UTC 2026
+ */
+
+#pragma once
+
+#include "engine/engine.h"
+#include "RESTEndpoint.h"
+
+namespace server {
+ namespace web3 {
+
+/**
+ * Indexes the RESTEndpoint's by method and the literal path segments in front
+ * of their regex, a request only runs the regex of the endpoints along its own
+ * path instead of every endpoint registered.
+ */
+class RESTRouteTrie : public Object {
+	class Node : public Object {
+	public:
+		VectorMap<String, Reference<Node*> > children;
+		Vector<int> endpoints;
+
+		Node() {
+			children.setNoDuplicateInsertPlan();
+		}
+	};
+
+	ArrayList<RESTEndpoint, ArrayListNoReallocTrait::value> mEndpoints;
+
+	// Tries by method, endpoints without a plain method list go in mAnyMethod
+	VectorMap<String, Reference<Node*> > mMethodRoots;
+	Reference<Node*> mAnyMethod;
+
+	int mNodeCount;
+
+	void insert(Node* root, const String& pathPrefix, int index);
+	void findBest(Node* root, const String& path, const String& endpointKey, int& hitIndex);
+
+public:
+	RESTRouteTrie();
+
+	/**
+	 * Copies the endpoint into the trie and returns the copy
+	 */
+	const RESTEndpoint& add(const RESTEndpoint& endpoint);
+
+	/**
+	 * Finds the endpoint with the longest regex matching the key, as the
+	 * linear scan used to pick, ties go to the one added first
+	 * @return nullptr if no endpoint matches
+	 */
+	const RESTEndpoint* find(const String& endpointKey);
+
+	void removeAll();
+
+	inline int size() const {
+		return mEndpoints.size();
+	}
+
+	inline int getNodeCount() const {
+		return mNodeCount;
+	}
+};
+
+}
+}
@@ -22,6 +22,8 @@
 #include "APIProxyGuildManager.h"
 #include "APIProxyConfigManager.h"
 
+#include "server/zone/managers/statistics/TaskProfiler.h"
+
 using namespace server::web3;
 
 RESTServer::RESTServer() {
@@ -63,10 +65,12 @@ namespace web3 {
 
 void RESTServer::registerEndpoints() {
 	const auto addEndpoint = [this](auto endpoint) {
-		mAPIEndpoints.add(endpoint);
-		info() << "Registered " << endpoint;
+		info() << "Registered " << mAPIEndpoints.add(endpoint);
 	};
 
+	// start() registers again on every reload
+	mAPIEndpoints.removeAll();
+
 	info() << "Registering mAPIEndpoints...";
 
 	addEndpoint(RESTEndpoint("GET:/v1/version/", {}, [this] (APIRequest& apiRequest) -> void {
@@ -90,6 +94,10 @@ void RESTServer::registerEndpoints() {
 		mObjectManagerProxy->handle(apiRequest);
 	}));
 
+	addEndpoint(RESTEndpoint("(?:GET|POST):/v1/bulk/object/", {}, [this] (APIRequest& apiRequest) -> void {
+		mObjectManagerProxy->handleBulk(apiRequest);
+	}));
+
 	addEndpoint(RESTEndpoint("(?:PUT):/v1/object/(\\d+)/(\\w+)/(\\w+)/", {"oid", "class", "property"}, [this] (APIRequest& apiRequest) -> void {
 		mObjectManagerProxy->handle(apiRequest);
 	}));
@@ -99,6 +107,32 @@ void RESTServer::registerEndpoints() {
 	}));
 
 
+	addEndpoint(RESTEndpoint("GET:/v1/admin/taskprofiler/(?:(top)/|)", {"view"}, [this] (APIRequest& apiRequest) -> void {
+		auto limit = apiRequest.getQueryFieldUnsignedLong("limit", false, 25);
+
+		JSONSerializationType profile;
+
+		if (apiRequest.getPathFieldString("view", false) == "top") {
+			auto seconds = apiRequest.getQueryFieldUnsignedLong("seconds", false, 60);
+
+			TaskProfiler::instance()->getTopTasksAsJSON(profile, seconds, limit);
+		} else {
+			TaskProfiler::instance()->getAsJSON(profile, limit);
+		}
+
+		JSONSerializationType metadata;
+
+		Time now;
+		metadata["exportTime"] = now.getFormattedTimeFull();
+
+		JSONSerializationType result;
+
+		result["metadata"] = metadata;
+		result["result"] = profile;
+
+		apiRequest.success(result);
+	}));
+
 	addEndpoint(RESTEndpoint("POST:/v1/admin/console/(\\w+)/", {"command"}, [this] (APIRequest& apiRequest) -> void {
 		StringBuffer buf;
 
@@ -141,7 +175,7 @@ void RESTServer::registerEndpoints() {
 		mChatManagerProxy->handle(apiRequest);
 	}));
 
-	info() << "Registered " << mAPIEndpoints.size() << " endpoint(s)";
+	info() << "Registered " << mAPIEndpoints.size() << " endpoint(s) in " << mAPIEndpoints.getNodeCount() << " route node(s)";
 }
 
 void RESTServer::routeRequest(http_request& request) {
@@ -160,19 +194,16 @@ void RESTServer::routeRequest(http_request& request) {
 	}
 
 	try {
-		RESTEndpoint hitEndpoint;
+		auto hit = mAPIEndpoints.find(endpointKey);
 
-		for (auto endpoint : mAPIEndpoints) {
-			if (endpoint.isMatch(endpointKey) && endpoint.getWeight() > hitEndpoint.getWeight()) {
-				hitEndpoint = endpoint;
-			}
-		}
-
-		if (hitEndpoint.getWeight() == 0) {
+		if (hit == nullptr) {
 			request.reply(status_codes::NotFound, U("Invalid resource"));
 			return;
 		}
 
+		// The task keeps its own copy, a reload replaces the registered endpoints
+		RESTEndpoint hitEndpoint = *hit;
+
 		if (getLogLevel() >= Logger::DEBUG) {
 			auto msg = debug();
 			auto pathFields = hitEndpoint.getPathFields(endpointKey);
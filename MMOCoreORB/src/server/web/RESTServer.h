@@ -14,6 +14,7 @@
 
 #include "engine/engine.h"
 #include "system/thread/atomic/AtomicBoolean.h"
+#include "RESTRouteTrie.h"
 
 namespace web {
  namespace json {
@@ -32,7 +33,6 @@ namespace server {
  class APIProxyObjectManager;
  class APIProxyGuildManager;
  class APIProxyConfigManager;
- class RESTEndpoint;
 
  using namespace web;
  using namespace web::http;
@@ -44,7 +44,7 @@ namespace server {
 
  private:
 	String mAuthHeader;
-	ArrayList<RESTEndpoint, ArrayListNoReallocTrait::value> mAPIEndpoints;
+	RESTRouteTrie mAPIEndpoints;
 	APIProxyPlayerManager* mPlayerManagerProxy = nullptr;
 	APIProxyChatManager* mChatManagerProxy = nullptr;
 	APIProxyObjectManager* mObjectManagerProxy = nullptr;
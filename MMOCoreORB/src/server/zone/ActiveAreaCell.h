@@ -0,0 +1,130 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef ACTIVEAREACELL_H_
+#define ACTIVEAREACELL_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/objects/area/ActiveArea.h"
+
+namespace server {
+namespace zone {
+
+class ActiveAreaIndex;
+
+/**
+ * One square of the static active area grid. Cells are never changed once
+ * published: adding or removing an area builds a replacement and marks the
+ * old cell stale, so an object may keep the cell it stands in between moves
+ * and use it without holding the zone lock.
+ */
+class ActiveAreaCell : public Object {
+	const ActiveAreaIndex* index;
+
+	float minX;
+	float minY;
+	float size;
+
+	// areas that contain the whole cell
+	Vector<ManagedReference<ActiveArea*> > coveringAreas;
+
+	// areas whose border runs through the cell, these need a point test
+	Vector<ManagedReference<ActiveArea*> > edgeAreas;
+
+	AtomicBoolean stale;
+
+public:
+	ActiveAreaCell(const ActiveAreaIndex* index, float minX, float minY, float size) : index(index), minX(minX), minY(minY), size(size) {
+	}
+
+	ActiveAreaCell(const ActiveAreaCell& cell) : Object(), index(cell.index), minX(cell.minX), minY(cell.minY), size(cell.size),
+			coveringAreas(cell.coveringAreas), edgeAreas(cell.edgeAreas) {
+	}
+
+	bool containsPoint(float x, float y) const {
+		return x >= minX && x < minX + size && y >= minY && y < minY + size;
+	}
+
+	bool isCurrent(const ActiveAreaIndex* owner, float x, float y) const {
+		return index == owner && !stale.get() && containsPoint(x, y);
+	}
+
+	bool isCovering(ActiveArea* area) const {
+		for (int i = 0; i < coveringAreas.size(); ++i) {
+			if (coveringAreas.getUnsafe(i) == area)
+				return true;
+		}
+
+		return false;
+	}
+
+	bool hasArea(ActiveArea* area) const {
+		if (isCovering(area))
+			return true;
+
+		for (int i = 0; i < edgeAreas.size(); ++i) {
+			if (edgeAreas.getUnsafe(i) == area)
+				return true;
+		}
+
+		return false;
+	}
+
+	void addArea(ActiveArea* area, bool covering) {
+		if (covering)
+			coveringAreas.add(area);
+		else
+			edgeAreas.add(area);
+	}
+
+	bool removeArea(ActiveArea* area) {
+		for (int i = 0; i < coveringAreas.size(); ++i) {
+			if (coveringAreas.getUnsafe(i) == area) {
+				coveringAreas.remove(i);
+				return true;
+			}
+		}
+
+		for (int i = 0; i < edgeAreas.size(); ++i) {
+			if (edgeAreas.getUnsafe(i) == area) {
+				edgeAreas.remove(i);
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	void setStale() {
+		stale.set(true);
+	}
+
+	float getMinX() const {
+		return minX;
+	}
+
+	float getMinY() const {
+		return minY;
+	}
+
+	float getSize() const {
+		return size;
+	}
+
+	const Vector<ManagedReference<ActiveArea*> >& getCoveringAreas() const {
+		return coveringAreas;
+	}
+
+	const Vector<ManagedReference<ActiveArea*> >& getEdgeAreas() const {
+		return edgeAreas;
+	}
+};
+
+}
+}
+
+using namespace server::zone;
+
+#endif /* ACTIVEAREACELL_H_ */
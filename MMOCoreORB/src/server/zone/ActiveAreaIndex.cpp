@@ -0,0 +1,192 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "ActiveAreaIndex.h"
+
+#include "server/zone/objects/tangible/TangibleObject.h"
+#include "server/zone/objects/area/areashapes/AreaShape.h"
+#include "server/zone/objects/area/areashapes/RectangularAreaShape.h"
+
+ActiveAreaIndex::ActiveAreaIndex(float minCoordinate, float maxCoordinate, const String& zoneName) : Logger("ActiveAreaIndex " + zoneName) {
+	this->minCoordinate = minCoordinate;
+
+	cellsPerSide = Math::max(1, (int) ceil((maxCoordinate - minCoordinate) / CELLSIZE));
+
+	for (int y = 0; y < cellsPerSide; ++y) {
+		for (int x = 0; x < cellsPerSide; ++x) {
+			cells.add(new ActiveAreaCell(this, minCoordinate + x * CELLSIZE, minCoordinate + y * CELLSIZE, CELLSIZE));
+		}
+	}
+
+	staticAreas.setNoDuplicateInsertPlan();
+	pendingWorldAreaUpdates.setNoDuplicateInsertPlan();
+}
+
+int ActiveAreaIndex::getCellIndex(float coordinate) const {
+	int index = (int) floor((coordinate - minCoordinate) / CELLSIZE);
+
+	return Math::max(0, Math::min(index, cellsPerSide - 1));
+}
+
+bool ActiveAreaIndex::getAreaBounds(ActiveArea* area, float& minX, float& minY, float& maxX, float& maxY) {
+	ManagedReference<AreaShape*> shape = area->getAreaShape();
+
+	float x = area->getPositionX();
+	float y = area->getPositionY();
+	float radius = area->getRadius();
+
+	if (shape != nullptr) {
+		if (shape->isRectangularAreaShape()) {
+			RectangularAreaShape* rectangle = cast<RectangularAreaShape*>(shape.get());
+
+			minX = rectangle->getBottomLeftX();
+			minY = rectangle->getBottomLeftY();
+			maxX = rectangle->getUpperRightX();
+			maxY = rectangle->getUpperRightY();
+
+			return maxX >= minX && maxY >= minY;
+		}
+
+		Vector3 center = shape->getAreaCenter();
+
+		x = center.getX();
+		y = center.getY();
+		radius = shape->getRadius();
+	}
+
+	minX = x - radius;
+	minY = y - radius;
+	maxX = x + radius;
+	maxY = y + radius;
+
+	return radius > 0;
+}
+
+bool ActiveAreaIndex::isCellCovered(ActiveArea* area, float minX, float minY, float size) {
+	// interior areas depend on the parent cell of the object
+	if (area->getCellObjectID() != 0)
+		return false;
+
+	// corners only prove coverage for convex shapes
+	ManagedReference<AreaShape*> shape = area->getAreaShape();
+
+	if (shape != nullptr && shape->isRingAreaShape())
+		return false;
+
+	float maxX = minX + size;
+	float maxY = minY + size;
+
+	return area->containsPoint(minX, minY) && area->containsPoint(maxX, minY)
+			&& area->containsPoint(minX, maxY) && area->containsPoint(maxX, maxY);
+}
+
+void ActiveAreaIndex::addArea(ActiveArea* area, bool dynamic) {
+	float minX, minY, maxX, maxY;
+
+	if (!getAreaBounds(area, minX, minY, maxX, maxY))
+		dynamic = true;
+
+	if (dynamic) {
+		DynamicArea entry;
+		entry.area = area;
+		entry.x = (minX + maxX) / 2;
+		entry.y = (minY + maxY) / 2;
+		entry.radius = Math::sqrt((maxX - entry.x) * (maxX - entry.x) + (maxY - entry.y) * (maxY - entry.y));
+
+		if (entry.radius <= 0) {
+			entry.x = area->getPositionX();
+			entry.y = area->getPositionY();
+			entry.radius = area->getRadius();
+		}
+
+		dynamicAreas.add(entry);
+
+		return;
+	}
+
+	if (staticAreas.put(area->getObjectID()) == -1)
+		return;
+
+	int firstX = getCellIndex(minX), lastX = getCellIndex(maxX);
+	int firstY = getCellIndex(minY), lastY = getCellIndex(maxY);
+
+	for (int y = firstY; y <= lastY; ++y) {
+		for (int x = firstX; x <= lastX; ++x) {
+			int index = y * cellsPerSide + x;
+
+			Reference<ActiveAreaCell*> oldCell = cells.getUnsafe(index);
+			Reference<ActiveAreaCell*> newCell = new ActiveAreaCell(*oldCell);
+
+			newCell->addArea(area, isCellCovered(area, oldCell->getMinX(), oldCell->getMinY(), oldCell->getSize()));
+
+			cells.set(index, newCell);
+			oldCell->setStale();
+		}
+	}
+}
+
+void ActiveAreaIndex::removeArea(ActiveArea* area) {
+	for (int i = 0; i < dynamicAreas.size(); ++i) {
+		if (dynamicAreas.getUnsafe(i).area == area) {
+			dynamicAreas.remove(i);
+			return;
+		}
+	}
+
+	if (!staticAreas.drop(area->getObjectID()))
+		return;
+
+	// the shape may have changed since the area was added, so look at every cell
+	for (int i = 0; i < cells.size(); ++i) {
+		Reference<ActiveAreaCell*> oldCell = cells.getUnsafe(i);
+
+		if (!oldCell->hasArea(area))
+			continue;
+
+		Reference<ActiveAreaCell*> newCell = new ActiveAreaCell(*oldCell);
+		newCell->removeArea(area);
+
+		cells.set(i, newCell);
+		oldCell->setStale();
+	}
+}
+
+Reference<ActiveAreaCell*> ActiveAreaIndex::getCell(float x, float y) const {
+	return cells.getUnsafe(getCellIndex(y) * cellsPerSide + getCellIndex(x));
+}
+
+void ActiveAreaIndex::getDynamicAreas(float x, float y, Vector<ManagedReference<ActiveArea*> >& areas) const {
+	for (int i = 0; i < dynamicAreas.size(); ++i) {
+		const DynamicArea& entry = dynamicAreas.getUnsafe(i);
+
+		float dx = x - entry.x;
+		float dy = y - entry.y;
+
+		if (dx * dx + dy * dy <= entry.radius * entry.radius)
+			areas.add(entry.area);
+	}
+}
+
+bool ActiveAreaIndex::isStaticArea(ActiveArea* area) const {
+	return staticAreas.contains(area->getObjectID());
+}
+
+bool ActiveAreaIndex::queueWorldAreaUpdate(TangibleObject* tano) {
+	Locker locker(&worldAreaMutex);
+
+	bool first = pendingWorldAreaUpdates.size() == 0;
+
+	pendingWorldAreaUpdates.put(tano->getObjectID(), tano);
+
+	return first;
+}
+
+void ActiveAreaIndex::takeWorldAreaUpdates(Vector<Reference<TangibleObject*> >& objects) {
+	Locker locker(&worldAreaMutex);
+
+	for (int i = 0; i < pendingWorldAreaUpdates.size(); ++i)
+		objects.add(pendingWorldAreaUpdates.elementAt(i).getValue());
+
+	pendingWorldAreaUpdates.removeAll();
+}
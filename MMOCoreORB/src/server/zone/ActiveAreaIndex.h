@@ -0,0 +1,119 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef ACTIVEAREAINDEX_H_
+#define ACTIVEAREAINDEX_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/ActiveAreaCell.h"
+
+namespace server {
+ namespace zone {
+  namespace objects {
+   namespace tangible {
+    class TangibleObject;
+   }
+  }
+ }
+}
+
+using namespace server::zone::objects::tangible;
+
+namespace server {
+namespace zone {
+
+/**
+ * Point location index for the active areas of a zone. Areas that are part of
+ * the world (client regions, cities, no build and spawn areas, everything
+ * loaded with the zone) are flattened into a grid of cells listing the areas
+ * that touch them. Areas that come and go while the server runs, like camps
+ * and mission areas, are kept in a short list checked by bounding circle.
+ *
+ * Changes happen with the zone write locked, lookups with it read locked,
+ * the same as the region tree.
+ */
+class ActiveAreaIndex : public Object, public Logger {
+public:
+	static const int CELLSIZE = 256;
+
+protected:
+	float minCoordinate;
+	int cellsPerSide;
+
+	Vector<Reference<ActiveAreaCell*> > cells;
+
+	class DynamicArea {
+	public:
+		ManagedReference<ActiveArea*> area;
+		float x;
+		float y;
+		float radius;
+	};
+
+	Vector<DynamicArea> dynamicAreas;
+	SortedVector<uint64> staticAreas;
+
+	Mutex worldAreaMutex;
+	VectorMap<uint64, Reference<TangibleObject*> > pendingWorldAreaUpdates;
+
+	int getCellIndex(float coordinate) const;
+
+	/**
+	 * Bounding box of the area shape, false when the area has no usable size
+	 */
+	static bool getAreaBounds(ActiveArea* area, float& minX, float& minY, float& maxX, float& maxY);
+
+	static bool isCellCovered(ActiveArea* area, float minX, float minY, float size);
+
+public:
+	ActiveAreaIndex(float minCoordinate, float maxCoordinate, const String& zoneName);
+
+	/**
+	 * Adds an area, dynamic areas skip the grid
+	 * @pre { zone is write locked }
+	 */
+	void addArea(ActiveArea* area, bool dynamic);
+
+	/**
+	 * @pre { zone is write locked }
+	 */
+	void removeArea(ActiveArea* area);
+
+	/**
+	 * @pre { zone is read locked }
+	 */
+	Reference<ActiveAreaCell*> getCell(float x, float y) const;
+
+	/**
+	 * Dynamic areas whose bounding circle holds the point
+	 * @pre { zone is read locked }
+	 */
+	void getDynamicAreas(float x, float y, Vector<ManagedReference<ActiveArea*> >& areas) const;
+
+	bool isStaticArea(ActiveArea* area) const;
+
+	/**
+	 * Queues the object for the next world area update, returns true when
+	 * the caller has to schedule the flush
+	 */
+	bool queueWorldAreaUpdate(TangibleObject* tano);
+
+	void takeWorldAreaUpdates(Vector<Reference<TangibleObject*> >& objects);
+
+	int getStaticAreaCount() const {
+		return staticAreas.size();
+	}
+
+	int getDynamicAreaCount() const {
+		return dynamicAreas.size();
+	}
+};
+
+}
+}
+
+using namespace server::zone;
+
+#endif /* ACTIVEAREAINDEX_H_ */
@@ -0,0 +1,44 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "DeltaFlushQueue.h"
+
+#include "server/zone/objects/tangible/TangibleObject.h"
+#include "conf/ConfigManager.h"
+
+bool DeltaFlushQueue::enabled = true;
+int DeltaFlushQueue::interval = 50;
+
+AtomicLong DeltaFlushQueue::deferredFields;
+AtomicLong DeltaFlushQueue::flushedMessages;
+
+DeltaFlushQueue::DeltaFlushQueue() {
+	pendingObjects.setNoDuplicateInsertPlan();
+}
+
+void DeltaFlushQueue::loadConfig() {
+	auto config = ConfigManager::instance();
+
+	enabled = config->getInt("Core3.DeltaFlush.Enabled", 1) != 0;
+	interval = Math::max(0, config->getInt("Core3.DeltaFlush.Interval", 50));
+}
+
+bool DeltaFlushQueue::queue(TangibleObject* tano) {
+	Locker locker(&queueMutex);
+
+	bool first = pendingObjects.size() == 0;
+
+	pendingObjects.put(tano->getObjectID(), tano);
+
+	return first;
+}
+
+void DeltaFlushQueue::take(Vector<Reference<TangibleObject*> >& objects) {
+	Locker locker(&queueMutex);
+
+	for (int i = 0; i < pendingObjects.size(); ++i)
+		objects.add(pendingObjects.elementAt(i).getValue());
+
+	pendingObjects.removeAll();
+}
@@ -0,0 +1,70 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef DELTAFLUSHQUEUE_H_
+#define DELTAFLUSHQUEUE_H_
+
+#include "engine/engine.h"
+
+namespace server {
+ namespace zone {
+  namespace objects {
+   namespace tangible {
+    class TangibleObject;
+   }
+  }
+ }
+}
+
+using namespace server::zone::objects::tangible;
+
+namespace server {
+namespace zone {
+
+/**
+ * Objects of a zone with delta fields waiting to be sent. Setters mark the
+ * field dirty on the object and queue it here, the zone flushes the queue
+ * once per tick and every object sends one merged delta per baseline.
+ */
+class DeltaFlushQueue : public Object {
+	Mutex queueMutex;
+	VectorMap<uint64, Reference<TangibleObject*> > pendingObjects;
+
+	static bool enabled;
+	static int interval;
+
+public:
+	static AtomicLong deferredFields;
+	static AtomicLong flushedMessages;
+
+	DeltaFlushQueue();
+
+	static void loadConfig();
+
+	static bool isEnabled() {
+		return enabled;
+	}
+
+	static void setEnabled(bool val) {
+		enabled = val;
+	}
+
+	static int getInterval() {
+		return interval;
+	}
+
+	/**
+	 * Returns true when the queue was empty and the caller has to schedule the flush
+	 */
+	bool queue(TangibleObject* tano);
+
+	void take(Vector<Reference<TangibleObject*> >& objects);
+};
+
+}
+}
+
+using namespace server::zone;
+
+#endif /* DELTAFLUSHQUEUE_H_ */
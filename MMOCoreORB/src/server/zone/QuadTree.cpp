@@ -581,11 +581,7 @@ bool QuadTree::_update(const Reference<QuadTreeNode*>& node, QuadTreeEntry *obj)
 void QuadTree::safeInRange(QuadTreeEntry* obj, float range) {
 	CloseObjectsVector* closeObjectsVector = obj->getCloseObjects();
 
-#ifdef NO_ENTRY_REF_COUNTING
-	SortedVector<QuadTreeEntry*> closeObjectsCopy;
-#else
-	SortedVector<ManagedReference<QuadTreeEntry*> > closeObjectsCopy;
-#endif
+	EntryCopyVector closeObjectsCopy;
 
 	Locker objLocker(obj);
 
@@ -594,25 +590,27 @@ void QuadTree::safeInRange(QuadTreeEntry* obj, float range) {
 		closeObjectsVector->safeCopyTo(closeObjectsCopy);
 	}
 
-	float rangesq = range * range;
+	EntryCopyVector inRangeObjects(500, 250);
 
-	float x = obj->getPositionX();
-	float y = obj->getPositionY();
+	copyObjectsInRange(obj->getPositionX(), obj->getPositionY(), range, inRangeObjects);
 
-#ifdef NO_ENTRY_REF_COUNTING
-	SortedVector<QuadTreeEntry*> inRangeObjects(500, 250);
-#else
-	SortedVector<ManagedReference<QuadTreeEntry*> > inRangeObjects(500, 250);
-#endif
+	addInRangeObjects(obj, range, inRangeObjects);
+}
 
+void QuadTree::copyObjectsInRange(float x, float y, float range, EntryCopyVector& objects) const {
 	ReadLocker locker(&mutex);
 
-	copyObjects(root, x, y, range, inRangeObjects);
+	copyObjects(root, x, y, range, objects);
+}
 
-	locker.release();
+void QuadTree::addInRangeObjects(QuadTreeEntry* obj, float range, const EntryCopyVector& inRangeObjects) {
+	float rangesq = range * range;
+
+	float x = obj->getPositionX();
+	float y = obj->getPositionY();
 
 	for (int i = 0; i < inRangeObjects.size(); ++i) {
-		QuadTreeEntry *o = inRangeObjects.getUnsafe(i);
+		QuadTreeEntry *o = inRangeObjects.get(i);
 
 		if (o != obj) {
 			float deltaX = x - o->getPositionX();
@@ -638,8 +636,6 @@ void QuadTree::safeInRange(QuadTreeEntry* obj, float range) {
 				obj->addInRangeObject(obj, false);
 		}
 	}
-
-
 }
 
 void QuadTree::copyObjects(const Reference<QuadTreeNode*>& node, float x, float y, float range, SortedVector<ManagedReference<server::zone::QuadTreeEntry*> >& objects) {
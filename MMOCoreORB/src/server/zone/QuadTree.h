@@ -45,7 +45,20 @@ Distribution of this file for usage outside of Core3 is prohibited.
 namespace server {
   namespace zone {
 
+	class SectoredQuadTree;
+
 	class QuadTree : public Object {
+		// queries over several sectors hold all their locks and use the unlocked internals
+		friend class SectoredQuadTree;
+
+	public:
+#ifdef NO_ENTRY_REF_COUNTING
+		typedef SortedVector<QuadTreeEntry*> EntryCopyVector;
+#else
+		typedef SortedVector<ManagedReference<QuadTreeEntry*> > EntryCopyVector;
+#endif
+
+	private:
 		Reference<QuadTreeNode*> root;
 
 		static bool logTree;
@@ -112,6 +125,20 @@ namespace server {
 		 */
 		void safeInRange(QuadTreeEntry* obj, float range);
 
+		/**
+		 * Copies every entry in the nodes the range touches, unfiltered
+		 */
+		void copyObjectsInRange(float x, float y, float range, EntryCopyVector& objects) const;
+
+		/**
+		 * Second half of safeInRange, links obj with the copied entries within range
+		 */
+		static void addInRangeObjects(QuadTreeEntry* obj, float range, const EntryCopyVector& inRangeObjects);
+
+		ReadWriteLock* getLock() const {
+			return &mutex;
+		}
+
 		/**
 		 * Searches for entries that contain x, y point
 		 */
@@ -145,8 +172,8 @@ namespace server {
 		int _inRange(const Reference<QuadTreeNode*>& node, float x, float y, SortedVector<ManagedReference<QuadTreeEntry*> >& objects) const;
 		int _inRange(const Reference<QuadTreeNode*>& node, float x, float y, SortedVector<QuadTreeEntry*>& objects) const;
 
-		void copyObjects(const Reference<QuadTreeNode*>& node, float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >& objects);
-		void copyObjects(const Reference<QuadTreeNode*>& node, float x, float y, float range, SortedVector<QuadTreeEntry*>& objects);
+		static void copyObjects(const Reference<QuadTreeNode*>& node, float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >& objects);
+		static void copyObjects(const Reference<QuadTreeNode*>& node, float x, float y, float range, SortedVector<QuadTreeEntry*>& objects);
 
 	public:
 		static void setLogging(bool doLog) {
@@ -126,6 +126,14 @@ public:
 	// Test if the object is inside this node
 	bool testInside(QuadTreeEntry* obj) const;
 
+	inline float getMinX() const {
+		return minX;
+	}
+
+	inline float getMinY() const {
+		return minY;
+	}
+
 	String toStringData() const;
 
 	friend class server::zone::QuadTree;
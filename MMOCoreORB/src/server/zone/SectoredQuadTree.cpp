@@ -0,0 +1,198 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "SectoredQuadTree.h"
+
+SectoredQuadTree::SectoredQuadTree(float minx, float miny, float maxx, float maxy) {
+	minX = minx;
+	minY = miny;
+	maxX = maxx;
+	maxY = maxy;
+
+	sectorsPerSide = Math::max(1, (int) ceil(Math::max(maxx - minx, maxy - miny) / SECTORSIZE));
+
+	for (int y = 0; y < sectorsPerSide; ++y) {
+		for (int x = 0; x < sectorsPerSide; ++x) {
+			float sectorMinX = minx + x * SECTORSIZE;
+			float sectorMinY = miny + y * SECTORSIZE;
+
+			sectors.add(new QuadTree(sectorMinX, sectorMinY, Math::min(sectorMinX + SECTORSIZE, maxx), Math::min(sectorMinY + SECTORSIZE, maxy)));
+		}
+	}
+}
+
+int SectoredQuadTree::getEntrySectorIndex(QuadTreeEntry* obj) const {
+	Reference<QuadTreeNode*> node = obj->getNode();
+
+	if (node == nullptr)
+		return -1;
+
+	// every node of a sector lies inside it, so its corner names the sector
+	return getSectorIndex(node->getMinX(), node->getMinY());
+}
+
+void SectoredQuadTree::insert(QuadTreeEntry* obj) {
+	int oldIndex = getEntrySectorIndex(obj);
+
+	if (oldIndex != -1)
+		sectors.getUnsafe(oldIndex)->remove(obj);
+
+	sectors.getUnsafe(getSectorIndex(obj->getPositionX(), obj->getPositionY()))->insert(obj);
+}
+
+void SectoredQuadTree::remove(QuadTreeEntry* obj) {
+	int index = getEntrySectorIndex(obj);
+
+	if (index == -1) {
+		System::out << hex << "object [" << obj->getObjectID() <<  "] ERROR - removing the node\n";
+		return;
+	}
+
+	sectors.getUnsafe(index)->remove(obj);
+}
+
+bool SectoredQuadTree::update(QuadTreeEntry* obj) {
+	int oldIndex = getEntrySectorIndex(obj);
+
+	if (oldIndex == -1)
+		return false;
+
+	float x = obj->getPositionX();
+	float y = obj->getPositionY();
+
+	QuadTree* oldSector = sectors.getUnsafe(oldIndex);
+
+	if (!isInside(x, y)) {
+		oldSector->remove(obj);
+
+		return false;
+	}
+
+	int newIndex = getSectorIndex(x, y);
+
+	if (newIndex == oldIndex)
+		return oldSector->update(obj);
+
+	QuadTree* newSector = sectors.getUnsafe(newIndex);
+
+	// ascending index order like the read locks of the queries, so none of them can deadlock
+	Locker firstLocker(oldIndex < newIndex ? oldSector->getLock() : newSector->getLock());
+	Locker secondLocker(oldIndex < newIndex ? newSector->getLock() : oldSector->getLock());
+
+	oldSector->remove(obj);
+	newSector->insert(obj);
+
+	sectorHandoffs.increment();
+
+	return true;
+}
+
+void SectoredQuadTree::readLockSectors(const SectorRange& sectorRange) const {
+	for (int row = sectorRange.firstRow; row <= sectorRange.lastRow; ++row) {
+		for (int column = sectorRange.firstColumn; column <= sectorRange.lastColumn; ++column)
+			sectors.getUnsafe(row * sectorsPerSide + column)->getLock()->rlock();
+	}
+}
+
+void SectoredQuadTree::readUnlockSectors(const SectorRange& sectorRange) const {
+	for (int row = sectorRange.lastRow; row >= sectorRange.firstRow; --row) {
+		for (int column = sectorRange.lastColumn; column >= sectorRange.firstColumn; --column)
+			sectors.getUnsafe(row * sectorsPerSide + column)->getLock()->runlock();
+	}
+}
+
+void SectoredQuadTree::safeInRange(QuadTreeEntry* obj, float range) {
+	Locker objLocker(obj);
+
+	float x = obj->getPositionX();
+	float y = obj->getPositionY();
+
+	QuadTree::EntryCopyVector inRangeObjects(500, 250);
+
+	SectorRange sectorRange = getSectorRange(x, y, range);
+
+	readLockSectors(sectorRange);
+
+	try {
+		for (int row = sectorRange.firstRow; row <= sectorRange.lastRow; ++row) {
+			for (int column = sectorRange.firstColumn; column <= sectorRange.lastColumn; ++column)
+				QuadTree::copyObjects(sectors.getUnsafe(row * sectorsPerSide + column)->root, x, y, range, inRangeObjects);
+		}
+	} catch (Exception& e) {
+		System::out << "[SectoredQuadTree] " << e.getMessage() << "\n";
+		e.printStackTrace();
+	}
+
+	readUnlockSectors(sectorRange);
+
+	QuadTree::addInRangeObjects(obj, range, inRangeObjects);
+}
+
+int SectoredQuadTree::inRange(float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >& objects, bool readLock) const {
+	int count = 0;
+
+	SectorRange sectorRange = getSectorRange(x, y, range);
+
+	if (!readLock) {
+		for (int row = sectorRange.firstRow; row <= sectorRange.lastRow; ++row) {
+			for (int column = sectorRange.firstColumn; column <= sectorRange.lastColumn; ++column)
+				count += sectors.getUnsafe(row * sectorsPerSide + column)->inRange(x, y, range, objects);
+		}
+
+		return count;
+	}
+
+	readLockSectors(sectorRange);
+
+	try {
+		for (int row = sectorRange.firstRow; row <= sectorRange.lastRow; ++row) {
+			for (int column = sectorRange.firstColumn; column <= sectorRange.lastColumn; ++column) {
+				const QuadTree* sector = sectors.getUnsafe(row * sectorsPerSide + column);
+
+				count += sector->_inRange(sector->root, x, y, range, objects);
+			}
+		}
+	} catch (Exception& e) {
+		System::out << "[SectoredQuadTree] " << e.getMessage() << "\n";
+		e.printStackTrace();
+	}
+
+	readUnlockSectors(sectorRange);
+
+	return count;
+}
+
+int SectoredQuadTree::inRange(float x, float y, float range, SortedVector<QuadTreeEntry*>& objects, bool readLock) const {
+	int count = 0;
+
+	SectorRange sectorRange = getSectorRange(x, y, range);
+
+	if (!readLock) {
+		for (int row = sectorRange.firstRow; row <= sectorRange.lastRow; ++row) {
+			for (int column = sectorRange.firstColumn; column <= sectorRange.lastColumn; ++column)
+				count += sectors.getUnsafe(row * sectorsPerSide + column)->inRange(x, y, range, objects);
+		}
+
+		return count;
+	}
+
+	readLockSectors(sectorRange);
+
+	try {
+		for (int row = sectorRange.firstRow; row <= sectorRange.lastRow; ++row) {
+			for (int column = sectorRange.firstColumn; column <= sectorRange.lastColumn; ++column) {
+				const QuadTree* sector = sectors.getUnsafe(row * sectorsPerSide + column);
+
+				count += sector->_inRange(sector->root, x, y, range, objects);
+			}
+		}
+	} catch (Exception& e) {
+		System::out << "[SectoredQuadTree] " << e.getMessage() << "\n";
+		e.printStackTrace();
+	}
+
+	readUnlockSectors(sectorRange);
+
+	return count;
+}
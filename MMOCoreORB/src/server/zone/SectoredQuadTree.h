@@ -0,0 +1,121 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef SECTOREDQUADTREE_H_
+#define SECTOREDQUADTREE_H_
+
+#include "server/zone/QuadTree.h"
+
+namespace server {
+namespace zone {
+
+/**
+ * The object quad tree of a zone split into fixed square sectors, each its
+ * own QuadTree with its own lock. A move inside a sector only locks that
+ * sector, a move across a border locks the two sectors in index order and
+ * hands the entry over. Range queries read lock every sector they touch in
+ * the same index order for the whole query, so they never see an entry
+ * halfway through a handoff; nothing locks a whole zone any more.
+ *
+ * Entries belong to the sector holding their position, which is all the
+ * position based queries of the object tree need. Region trees answer
+ * point in area queries and stay a single QuadTree.
+ */
+class SectoredQuadTree : public Object {
+public:
+	static const int SECTORSIZE = 1024;
+
+protected:
+	float minX;
+	float minY;
+	float maxX;
+	float maxY;
+
+	int sectorsPerSide;
+
+	Vector<Reference<QuadTree*> > sectors;
+
+	AtomicLong sectorHandoffs;
+
+	int getSectorColumn(float coordinate, float min) const {
+		int column = (int) floor((coordinate - min) / SECTORSIZE);
+
+		return Math::max(0, Math::min(column, sectorsPerSide - 1));
+	}
+
+	int getSectorIndex(float x, float y) const {
+		return getSectorColumn(y, minY) * sectorsPerSide + getSectorColumn(x, minX);
+	}
+
+	/**
+	 * Sector currently holding the entry, -1 when it is not in the tree
+	 */
+	int getEntrySectorIndex(QuadTreeEntry* obj) const;
+
+	bool isInside(float x, float y) const {
+		return x >= minX && x < maxX && y >= minY && y < maxY;
+	}
+
+	class SectorRange {
+	public:
+		int firstColumn, lastColumn;
+		int firstRow, lastRow;
+	};
+
+	SectorRange getSectorRange(float x, float y, float range) const {
+		SectorRange sectorRange;
+
+		sectorRange.firstColumn = getSectorColumn(x - range, minX);
+		sectorRange.lastColumn = getSectorColumn(x + range, minX);
+		sectorRange.firstRow = getSectorColumn(y - range, minY);
+		sectorRange.lastRow = getSectorColumn(y + range, minY);
+
+		return sectorRange;
+	}
+
+	/**
+	 * Read locks the sectors in ascending index order, the order update() write locks them in
+	 */
+	void readLockSectors(const SectorRange& sectorRange) const;
+	void readUnlockSectors(const SectorRange& sectorRange) const;
+
+public:
+	SectoredQuadTree(float minx, float miny, float maxx, float maxy);
+
+	void insert(QuadTreeEntry* obj);
+
+	void remove(QuadTreeEntry* obj);
+
+	/**
+	 * Same contract as QuadTree::update, false when the entry left the tree
+	 */
+	bool update(QuadTreeEntry* obj);
+
+	/**
+	 * Updates COV, adds new in range objects
+	 */
+	void safeInRange(QuadTreeEntry* obj, float range);
+
+	/**
+	 * With readLock false each sector is read locked on its own and an
+	 * entry changing sectors during the query can be missed
+	 */
+	int inRange(float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >& objects, bool readLock = true) const;
+	int inRange(float x, float y, float range, SortedVector<QuadTreeEntry*>& objects, bool readLock = true) const;
+
+	int getSectorCount() const {
+		return sectors.size();
+	}
+
+	uint64 getSectorHandoffs() const {
+		return sectorHandoffs.get();
+	}
+};
+
+}
+}
+
+using namespace server::zone;
+
+#endif /* SECTOREDQUADTREE_H_ */
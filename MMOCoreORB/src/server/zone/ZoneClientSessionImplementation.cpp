@@ -11,6 +11,7 @@
 #include "server/zone/objects/player/events/ClearClientEvent.h"
 #include "server/zone/objects/player/events/DisconnectClientEvent.h"
 #include "server/zone/managers/player/PlayerManager.h"
+#include "server/zone/managers/statistics/ZoneTrafficReplay.h"
 
 ZoneClientSessionImplementation::ZoneClientSessionImplementation(BaseClientProxy* session)
 		:  ManagedObjectImplementation() {
@@ -36,10 +37,23 @@ ZoneClientSessionImplementation::ZoneClientSessionImplementation(BaseClientProxy
 }
 
 void ZoneClientSessionImplementation::disconnect() {
-	session->disconnect();
+	if (session != nullptr)
+		session->disconnect();
 }
 
 void ZoneClientSessionImplementation::sendMessage(BasePacket* msg) {
+	if (session == nullptr) {
+		// replayed sessions have no connection, count what would have gone out
+		ZoneTrafficReplay::countOutbound(msg->size());
+
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+		if (!msg->getReferenceCount())
+#endif
+		delete msg;
+
+		return;
+	}
+
 	session->sendPacket(msg);
 }
 
@@ -55,7 +69,7 @@ void ZoneClientSessionImplementation::disconnect(bool doLock) {
 
 	ManagedReference<CreatureObject*> player = this->player.get();
 	Reference<ZoneClientSession*> zoneClientSession;
-	if (session->hasError() || !session->isClientDisconnected()) {
+	if (session == nullptr || session->hasError() || !session->isClientDisconnected()) {
 		if (player != nullptr) {
 			zoneClientSession = player->getClient();
 
@@ -134,10 +148,9 @@ void ZoneClientSessionImplementation::closeConnection(bool lockPlayer, bool doLo
 	Locker locker(_this.getReferenceUnsafeStaticCast());
 	Reference<BaseClientProxy* > session = this->session;
 
-	if (session == nullptr)
-		return;
-
-	session->info("disconnecting client \'" + session->getIPAddress() + "\'");
+	// replayed sessions have no connection but their player still has to be cleared
+	if (session != nullptr)
+		session->info("disconnecting client \'" + session->getIPAddress() + "\'");
 
 	ZoneServer* server = nullptr;
 	ManagedReference<CreatureObject*> play = player.get();
@@ -151,6 +164,9 @@ void ZoneClientSessionImplementation::closeConnection(bool lockPlayer, bool doLo
 		setPlayer(nullptr); // we must call setPlayer to increase/decrease online player counter
 	}
 
+	if (session == nullptr)
+		return;
+
 	session->disconnect();
 
 	if (server != nullptr) {
@@ -160,27 +176,53 @@ void ZoneClientSessionImplementation::closeConnection(bool lockPlayer, bool doLo
 }
 
 void ZoneClientSessionImplementation::balancePacketCheckupTime() {
-	session->balancePacketCheckupTime();
+	if (session != nullptr)
+		session->balancePacketCheckupTime();
 }
 
 void ZoneClientSessionImplementation::resetPacketCheckupTime() {
-	session->resetPacketCheckupTime();
+	if (session != nullptr)
+		session->resetPacketCheckupTime();
 }
 
 void ZoneClientSessionImplementation::info(const String& msg, bool force) {
-	session->info(msg, force);
+	if (session != nullptr)
+		session->info(msg, force);
 }
 
 void ZoneClientSessionImplementation::debug(const String& msg) {
-	session->debug(msg);
+	if (session != nullptr)
+		session->debug(msg);
 }
 
 void ZoneClientSessionImplementation::error(const String& msg) {
-	session->error(msg);
+	if (session != nullptr)
+		session->error(msg);
 }
 
 String ZoneClientSessionImplementation::getAddress() const {
-	return session->getAddress();
+	return session != nullptr ? session->getAddress() : getIPAddress();
+}
+
+LoggerHelperStream ZoneClientSessionImplementation::info(int forced) const {
+	if (session == nullptr)
+		return Logger::console.info(forced);
+
+	return session->info(forced);
+}
+
+LoggerHelperStream ZoneClientSessionImplementation::error() const {
+	if (session == nullptr)
+		return Logger::console.error();
+
+	return session->error();
+}
+
+LoggerHelperStream ZoneClientSessionImplementation::debug() const {
+	if (session == nullptr)
+		return Logger::console.debug();
+
+	return session->debug();
 }
 
 String ZoneClientSessionImplementation::getIPAddress() const {
@@ -8,6 +8,7 @@
 #include "ZoneContainerComponent.h"
 
 #include "server/zone/Zone.h"
+#include "server/zone/ActiveAreaIndex.h"
 #include "server/zone/objects/building/BuildingObject.h"
 #include "server/zone/managers/planet/PlanetManager.h"
 #include "templates/building/SharedBuildingObjectTemplate.h"
@@ -40,6 +41,11 @@ bool ZoneContainerComponent::insertActiveArea(Zone* newZone, ActiveArea* activeA
 
 	regionTree->insert(activeArea);
 
+	// whatever is placed after the zone loaded, except regions and no build zones, comes and goes
+	bool dynamicArea = newZone->hasManagersStarted() && !activeArea->isRegion() && !activeArea->isNavArea() && !activeArea->isNoBuildArea();
+
+	newZone->getActiveAreaIndex()->addArea(activeArea, dynamicArea);
+
 	//regionTree->inRange(activeArea, 512);
 
 	// lets update area to the in range players
@@ -100,6 +106,7 @@ bool ZoneContainerComponent::removeActiveArea(Zone* zone, ActiveArea* activeArea
 	QuadTree* regionTree = zone->getRegionTree();
 
 	regionTree->remove(activeArea);
+	zone->getActiveAreaIndex()->removeArea(activeArea);
 
 	// lets remove the in range active areas of players
 	SortedVector<QuadTreeEntry*> objects;
@@ -330,6 +337,9 @@ bool ZoneContainerComponent::removeObject(SceneObject* sceneObject, SceneObject*
 
 				area->enqueueExitEvent(object);
 			}
+
+			// the next zone insert has to enter the covering areas again
+			tano->setActiveAreaCell(nullptr);
 		} else if (object->isStaticObjectClass()) {
 			SortedVector<ManagedReference<NavArea*> > meshes;
 			oldZone->getInRangeNavMeshes(object->getPositionX(), object->getPositionY(), &meshes, true);
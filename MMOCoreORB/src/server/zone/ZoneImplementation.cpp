@@ -5,10 +5,12 @@
 #include "server/zone/Zone.h"
 
 #include "server/zone/ZoneProcessServer.h"
+#include "server/zone/ActiveAreaIndex.h"
 #include "server/zone/objects/scene/SceneObject.h"
 #include "server/zone/managers/planet/PlanetManager.h"
 #include "server/zone/managers/space/SpaceManager.h"
 #include "server/zone/managers/creature/CreatureManager.h"
+#include "server/zone/managers/creature/ZoneAwarenessPass.h"
 #include "server/zone/managers/components/ComponentManager.h"
 #include "server/zone/packets/player/GetMapLocationsResponseMessage.h"
 
@@ -30,7 +32,9 @@ ZoneImplementation::ZoneImplementation(ZoneProcessServer* serv, const String& na
 	zoneCRC = name.hashCode();
 
 	regionTree = new server::zone::QuadTree(-8192, -8192, 8192, 8192);
-	quadTree = new server::zone::QuadTree(-8192, -8192, 8192, 8192);
+	activeAreaIndex = new ActiveAreaIndex(-8192, 8192, name);
+	deltaFlushQueue = new DeltaFlushQueue();
+	quadTree = new SectoredQuadTree(-8192, -8192, 8192, 8192);
 
 	objectMap = new ObjectMap();
 
@@ -62,6 +66,8 @@ void ZoneImplementation::initializePrivateData() {
 	creatureManager = new CreatureManager(_this.getReferenceUnsafeStaticCast());
 	creatureManager->deploy("CreatureManager " + zoneName);
 	creatureManager->setZoneProcessor(processor);
+
+	awarenessPass = new ZoneAwarenessPass(_this.getReferenceUnsafeStaticCast());
 }
 
 void ZoneImplementation::finalize() {
@@ -87,12 +93,19 @@ void ZoneImplementation::startManagers() {
 
 	planetManager->start();
 
+	awarenessPass->start();
+
 	managersStarted = true;
 }
 
 void ZoneImplementation::stopManagers() {
 	info("Shutting down.. ", true);
 
+	if (awarenessPass != nullptr) {
+		awarenessPass->stop();
+		awarenessPass = nullptr;
+	}
+
 	if (creatureManager != nullptr) {
 		creatureManager->stop();
 		creatureManager = nullptr;
@@ -180,8 +193,7 @@ void ZoneImplementation::remove(QuadTreeEntry* entry) {
 }
 
 void ZoneImplementation::update(QuadTreeEntry* entry) {
-	Locker locker(_this.getReferenceUnsafeStaticCast());
-
+	// only the sectors the entry leaves and enters are locked
 	quadTree->update(entry);
 }
 
@@ -192,17 +204,7 @@ void ZoneImplementation::inRange(QuadTreeEntry* entry, float range) {
 int ZoneImplementation::getInRangeSolidObjects(float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >* objects, bool readLockZone) {
 	objects->setNoDuplicateInsertPlan();
 
-	bool readlock = readLockZone && !_this.getReferenceUnsafeStaticCast()->isLockedByCurrentThread();
-
-	try {
-		_this.getReferenceUnsafeStaticCast()->rlock(readlock);
-
-		quadTree->inRange(x, y, range, *objects);
-
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	} catch (...) {
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	}
+	quadTree->inRange(x, y, range, *objects, readLockZone);
 
 	if (objects->size() > 0) {
 		for (int i = objects->size() - 1; i >= 0; i--) {
@@ -242,17 +244,7 @@ int ZoneImplementation::getInRangeSolidObjects(float x, float y, float range, So
 int ZoneImplementation::getInRangeObjects(float x, float y, float range, SortedVector<ManagedReference<QuadTreeEntry*> >* objects, bool readLockZone, bool includeBuildingObjects) {
 	objects->setNoDuplicateInsertPlan();
 
-	bool readlock = readLockZone && !_this.getReferenceUnsafeStaticCast()->isLockedByCurrentThread();
-
-	try {
-		_this.getReferenceUnsafeStaticCast()->rlock(readlock);
-
-		quadTree->inRange(x, y, range, *objects);
-
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	} catch (...) {
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	}
+	quadTree->inRange(x, y, range, *objects, readLockZone);
 
 	if (includeBuildingObjects) {
 		Vector<ManagedReference<QuadTreeEntry*> > buildingObjects;
@@ -300,17 +292,7 @@ int ZoneImplementation::getInRangeObjects(float x, float y, float range, SortedV
 int ZoneImplementation::getInRangeObjects(float x, float y, float range, InRangeObjectsVector* objects, bool readLockZone, bool includeBuildingObjects) {
 	objects->setNoDuplicateInsertPlan();
 
-	bool readlock = readLockZone && !_this.getReferenceUnsafeStaticCast()->isLockedByCurrentThread();
-
-	try {
-		_this.getReferenceUnsafeStaticCast()->rlock(readlock);
-
-		quadTree->inRange(x, y, range, *objects);
-
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	} catch (...) {
-		_this.getReferenceUnsafeStaticCast()->runlock(readlock);
-	}
+	quadTree->inRange(x, y, range, *objects, readLockZone);
 
 	if (includeBuildingObjects) {
 		Vector<QuadTreeEntry*> buildingObjects;
@@ -567,9 +549,15 @@ void ZoneImplementation::updateActiveAreas(TangibleObject* tano) {
 	_alocker.release();
 
 	Vector3 worldPos = tano->getWorldPosition();
+	float x = worldPos.getX();
+	float y = worldPos.getY();
+	uint64 parentID = tano->getParentID();
 
-	SortedVector<QuadTreeEntry*> entryObjects;
-	SortedVector<QuadTreeEntry*> entryObjects2;
+	// membership of the areas covering the cell only changes when the object changes cell
+	Reference<ActiveAreaCell*> cell = tano->getActiveAreaCell();
+	bool changedCell = cell == nullptr || !cell->isCurrent(activeAreaIndex, x, y);
+
+	Vector<ManagedReference<ActiveArea*> > dynamicAreas;
 
 	Zone* managedRef = _this.getReferenceUnsafeStaticCast();
 
@@ -578,15 +566,22 @@ void ZoneImplementation::updateActiveAreas(TangibleObject* tano) {
 	managedRef->rlock(readlock);
 
 	try {
-		regionTree->inRange(worldPos.getX(), worldPos.getY(), entryObjects);
+		if (changedCell)
+			cell = activeAreaIndex->getCell(x, y);
 
-		regionTree->inRange(worldPos.getX(), worldPos.getY(), 1024, entryObjects2);
+		activeAreaIndex->getDynamicAreas(x, y, dynamicAreas);
 	} catch (...) {
 		error("unexpeted error caught in void ZoneImplementation::updateActiveAreas(SceneObject* object) {");
 	}
 
 	managedRef->runlock(readlock);
 
+	if (cell == nullptr)
+		return;
+
+	if (changedCell)
+		tano->setActiveAreaCell(cell);
+
 	//locker.release();
 
 
@@ -601,7 +596,7 @@ void ZoneImplementation::updateActiveAreas(TangibleObject* tano) {
 
 //			Locker locker(area, object);
 
-			if (!area->containsPoint(worldPos.getX(), worldPos.getY(), tano->getParentID())) {
+			if (!cell->isCovering(area) && !area->containsPoint(x, y, parentID)) {
 				tano->dropActiveArea(area);
 				area->enqueueExitEvent(tano);
 //				area->notifyExit(object);
@@ -610,60 +605,51 @@ void ZoneImplementation::updateActiveAreas(TangibleObject* tano) {
 			}
 		}
 
-		// we update the ones in quadtree.
-		for (int i = 0; i < entryObjects.size(); ++i) {
-			//update in new ones
-			ActiveArea* activeArea = static_cast<ActiveArea*>(entryObjects.getUnsafe(i));
+		// areas covering the new cell are entered without a point test
+		if (changedCell) {
+			const auto& coveringAreas = cell->getCoveringAreas();
+
+			for (int i = 0; i < coveringAreas.size(); ++i) {
+				ActiveArea* activeArea = coveringAreas.getUnsafe(i);
 
-			if (!tano->hasActiveArea(activeArea) && activeArea->containsPoint(worldPos.getX(), worldPos.getY(), tano->getParentID())) {
-				//Locker lockerO(object);
+				if (!tano->hasActiveArea(activeArea)) {
+					tano->addActiveArea(activeArea);
+					activeArea->enqueueEnterEvent(tano);
+				}
+			}
+		}
 
-				//Locker locker(activeArea, object);
+		// areas with an edge in this cell and the dynamic ones still need the point test
+		const auto& edgeAreas = cell->getEdgeAreas();
 
+		for (int i = 0; i < edgeAreas.size(); ++i) {
+			ActiveArea* activeArea = edgeAreas.getUnsafe(i);
+
+			if (!tano->hasActiveArea(activeArea) && activeArea->containsPoint(x, y, parentID)) {
 				tano->addActiveArea(activeArea);
 				activeArea->enqueueEnterEvent(tano);
-				//activeArea->notifyEnter(object);
 			}
 		}
 
-		// we update the ones in quadtree.
-		for (int i = 0; i < entryObjects2.size(); ++i) {
-			//update in new ones
-			ActiveArea* activeArea = static_cast<ActiveArea*>(entryObjects2.getUnsafe(i));
-
-			if (!tano->hasActiveArea(activeArea) && activeArea->containsPoint(worldPos.getX(), worldPos.getY(), tano->getParentID())) {
-				//Locker lockerO(object);
-
-				//Locker locker(activeArea, object);
+		for (int i = 0; i < dynamicAreas.size(); ++i) {
+			ActiveArea* activeArea = dynamicAreas.getUnsafe(i);
 
+			if (!tano->hasActiveArea(activeArea) && activeArea->containsPoint(x, y, parentID)) {
 				tano->addActiveArea(activeArea);
 				activeArea->enqueueEnterEvent(tano);
-				//activeArea->notifyEnter(object);
 			}
 		}
 
-		// update world areas
+		// update world areas, moves are collected and handed to the world areas in batches
 		if (creatureManager != nullptr) {
 			auto worldAreas = creatureManager->getWorldSpawnAreas();
 
-			if (worldAreas != nullptr && worldAreas->size()) {
-				Reference<TangibleObject*> tanoStrong = tano;
-
-				Core::getTaskManager()->executeTask([worldAreas, tanoStrong] () {
-					Locker lockerO(tanoStrong);
+			if (worldAreas != nullptr && worldAreas->size() && activeAreaIndex->queueWorldAreaUpdate(tano)) {
+				Reference<Zone*> zone = managedRef;
 
-					for (int i = 0; i < worldAreas->size(); ++i) {
-						auto activeArea = worldAreas->get(i);
-
-						if (!tanoStrong->hasActiveArea(activeArea)) {
-							tanoStrong->addActiveArea(activeArea);
-							//activeArea->enqueueEnterEvent(object);
-							activeArea->notifyEnter(tanoStrong);
-						} else {
-							activeArea->notifyPositionUpdate(tanoStrong);
-						}
-					}
-				}, "UpdateWorldActiveAreas");
+				Core::getTaskManager()->scheduleTask([zone] () {
+					zone->flushWorldAreaUpdates();
+				}, "UpdateWorldActiveAreas", WORLDAREAUPDATEDELAY);
 			}
 		}
 	} catch (...) {
@@ -675,6 +661,61 @@ void ZoneImplementation::updateActiveAreas(TangibleObject* tano) {
 	managedRef->wlock(!readlock);
 }
 
+void ZoneImplementation::flushWorldAreaUpdates() {
+	Vector<Reference<TangibleObject*> > objects;
+	activeAreaIndex->takeWorldAreaUpdates(objects);
+
+	if (creatureManager == nullptr)
+		return;
+
+	auto worldAreas = creatureManager->getWorldSpawnAreas();
+
+	if (worldAreas == nullptr)
+		return;
+
+	for (int i = 0; i < objects.size(); ++i) {
+		TangibleObject* tano = objects.getUnsafe(i);
+
+		Locker lockerO(tano);
+
+		for (int j = 0; j < worldAreas->size(); ++j) {
+			auto activeArea = worldAreas->get(j);
+
+			if (!tano->hasActiveArea(activeArea)) {
+				tano->addActiveArea(activeArea);
+				//activeArea->enqueueEnterEvent(object);
+				activeArea->notifyEnter(tano);
+			} else {
+				activeArea->notifyPositionUpdate(tano);
+			}
+		}
+	}
+}
+
+void ZoneImplementation::queueDeltaFlush(TangibleObject* tano) {
+	if (!deltaFlushQueue->queue(tano))
+		return;
+
+	Reference<Zone*> zone = _this.getReferenceUnsafeStaticCast();
+
+	Core::getTaskManager()->scheduleTask([zone] () {
+		zone->flushDeltaUpdates();
+	}, "FlushDeltaUpdates", DeltaFlushQueue::getInterval());
+}
+
+void ZoneImplementation::flushDeltaUpdates() {
+	Vector<Reference<TangibleObject*> > objects;
+	deltaFlushQueue->take(objects);
+
+	for (int i = 0; i < objects.size(); ++i) {
+		TangibleObject* tano = objects.getUnsafe(i);
+
+		Locker locker(tano);
+
+		tano->flushDirtyDeltas();
+	}
+}
+
 void ZoneImplementation::addSceneObject(SceneObject* object) {
 	ManagedReference<SceneObject*> old = objectMap->put(object->getObjectID(), object);
 
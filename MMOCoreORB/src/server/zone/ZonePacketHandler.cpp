@@ -7,6 +7,7 @@
 #include "server/zone/ZoneServer.h"
 #include "server/zone/ZoneClientSession.h"
 #include "server/zone/ZoneProcessServer.h"
+#include "server/zone/managers/statistics/ZoneTrafficRecorder.h"
 
 #include "packets/zone/ClientIDMessageCallback.h"
 #include "packets/zone/SelectCharacterCallback.h"
@@ -215,6 +216,12 @@ Task* ZonePacketHandler::generateMessageTask(ZoneClientSession* client, Message*
 	if (client == nullptr)
 		return nullptr;
 
+	ZoneTrafficRecorder* recorder = ZoneTrafficRecorder::instance();
+
+	// sessions without a connection are being replayed, their messages are in a trace already
+	if (recorder->isRecording() && client->getSession() != nullptr)
+		recorder->record(client, pack);
+
 	try {
 		uint16 opcount = pack->parseShort();
 		uint32 opcode = pack->parseInt();
@@ -15,6 +15,9 @@
 #include "server/zone/managers/object/ObjectManager.h"
 #include "server/zone/managers/stringid/StringIdManager.h"
 #include "server/zone/managers/player/PlayerManager.h"
+#include "server/zone/managers/player/LoginQueue.h"
+#include "server/zone/objects/scene/BaselineCache.h"
+#include "server/zone/objects/scene/AttributeListCache.h"
 #include "server/zone/managers/radial/RadialManager.h"
 #include "server/zone/managers/resource/ResourceManager.h"
 #include "server/zone/managers/crafting/CraftingManager.h"
@@ -24,6 +27,8 @@
 #include "server/zone/managers/creature/CreatureTemplateManager.h"
 #include "server/zone/managers/creature/DnaManager.h"
 #include "server/zone/managers/creature/PetManager.h"
+#include "server/zone/managers/creature/ZoneAwarenessPass.h"
+#include "server/zone/DeltaFlushQueue.h"
 #include "server/zone/managers/guild/GuildManager.h"
 #include "server/zone/managers/faction/FactionManager.h"
 #include "server/zone/managers/reaction/ReactionManager.h"
@@ -131,6 +136,24 @@ void ZoneServerImplementation::initialize() {
 	objectManager->setZoneProcessor(processor);
 	objectManager->updateObjectVersion();
 
+	LoginQueue::instance()->initialize();
+	BaselineCache::instance()->loadConfig();
+	AttributeListCache::instance()->loadConfig();
+	ZoneAwarenessPass::loadConfig();
+	DeltaFlushQueue::loadConfig();
+
+	configManager->addChangeListener("Core3.BaselineCache", []() {
+		BaselineCache::instance()->loadConfig();
+	});
+
+	configManager->addChangeListener("Core3.AttributeListCache", []() {
+		AttributeListCache::instance()->loadConfig();
+	});
+
+	configManager->addChangeListener("Core3.DeltaFlush", []() {
+		DeltaFlushQueue::loadConfig();
+	});
+
 	stringIdManager = StringIdManager::instance();
 
 	reactionManager = new ReactionManager(_this.getReferenceUnsafeStaticCast());
@@ -0,0 +1,199 @@
+/*
+ * AuctionExpiryIndex.h
+ *
+ * Min heap of auction ids ordered on their expire time, so the periodic
+ * maintenance only touches the listings that are due instead of every
+ * listing of every terminal.
+ */
+
+#ifndef AUCTIONEXPIRYINDEX_H_
+#define AUCTIONEXPIRYINDEX_H_
+
+#include "engine/engine.h"
+
+class AuctionExpiryEntry {
+public:
+	uint64 expireTime;
+	uint64 id;
+
+	AuctionExpiryEntry() : expireTime(0), id(0) {
+	}
+
+	AuctionExpiryEntry(uint64 time, uint64 itemID) : expireTime(time), id(itemID) {
+	}
+
+	inline bool operator<(const AuctionExpiryEntry& entry) const {
+		return expireTime < entry.expireTime || (expireTime == entry.expireTime && id < entry.id);
+	}
+};
+
+/**
+ * Rescheduling an id leaves its old heap entry behind. The time last scheduled is kept
+ * per id and entries that do not match it are dropped when they reach the top, the heap
+ * is rebuilt once more than half of it is stale. Not thread safe, AuctionsMap guards it.
+ */
+class AuctionExpiryIndex {
+	Vector<AuctionExpiryEntry> heap;
+	HashTable<uint64, uint64> scheduled;
+
+	void siftUp(int index) {
+		AuctionExpiryEntry entry = heap.getUnsafe(index);
+
+		while (index > 0) {
+			int parent = (index - 1) / 2;
+
+			if (!(entry < heap.getUnsafe(parent)))
+				break;
+
+			heap.set(index, heap.getUnsafe(parent));
+			index = parent;
+		}
+
+		heap.set(index, entry);
+	}
+
+	void siftDown(int index) {
+		int size = heap.size();
+		AuctionExpiryEntry entry = heap.getUnsafe(index);
+
+		while (true) {
+			int child = index * 2 + 1;
+
+			if (child >= size)
+				break;
+
+			if (child + 1 < size && heap.getUnsafe(child + 1) < heap.getUnsafe(child))
+				++child;
+
+			if (!(heap.getUnsafe(child) < entry))
+				break;
+
+			heap.set(index, heap.getUnsafe(child));
+			index = child;
+		}
+
+		heap.set(index, entry);
+	}
+
+	void popTop() {
+		int last = heap.size() - 1;
+
+		if (last > 0)
+			heap.set(0, heap.getUnsafe(last));
+
+		heap.remove(last);
+
+		if (heap.size() > 1)
+			siftDown(0);
+	}
+
+	inline bool isCurrent(const AuctionExpiryEntry& entry) {
+		return scheduled.containsKey(entry.id) && scheduled.get(entry.id) == entry.expireTime;
+	}
+
+	void compact() {
+		Vector<AuctionExpiryEntry> entries;
+
+		for (int i = 0; i < heap.size(); ++i) {
+			const AuctionExpiryEntry& entry = heap.getUnsafe(i);
+
+			// an id scheduled twice at the same time has two current entries
+			if (isCurrent(entry))
+				entries.add(entry);
+		}
+
+		heap.removeAll(entries.size() + 1, 1024);
+
+		for (int i = 0; i < entries.size(); ++i) {
+			heap.add(entries.getUnsafe(i));
+			siftUp(heap.size() - 1);
+		}
+	}
+
+public:
+	AuctionExpiryIndex() : heap(1024, 1024), scheduled(1024) {
+	}
+
+	/**
+	 * Adds id or moves it to expireTime
+	 */
+	void schedule(uint64 id, uint64 expireTime) {
+		if (scheduled.containsKey(id)) {
+			if (scheduled.get(id) == expireTime)
+				return;
+
+			scheduled.remove(id);
+		}
+
+		scheduled.put(id, expireTime);
+
+		heap.add(AuctionExpiryEntry(expireTime, id));
+		siftUp(heap.size() - 1);
+
+		if (heap.size() > 1024 && heap.size() > scheduled.size() * 2)
+			compact();
+	}
+
+	void remove(uint64 id) {
+		scheduled.remove(id);
+
+		if (heap.size() > 1024 && heap.size() > scheduled.size() * 2)
+			compact();
+	}
+
+	inline bool contains(uint64 id) {
+		return scheduled.containsKey(id);
+	}
+
+	/**
+	 * Removes the ids due at now from the index and adds them to ids in expire time order,
+	 * at most limit of them when limit is above 0
+	 */
+	int pollDue(uint64 now, Vector<uint64>& ids, int limit = 0) {
+		int count = 0;
+
+		while (heap.size() > 0 && (limit <= 0 || count < limit)) {
+			AuctionExpiryEntry top = heap.getUnsafe(0);
+
+			if (top.expireTime > now)
+				break;
+
+			popTop();
+
+			if (!isCurrent(top))
+				continue;
+
+			scheduled.remove(top.id);
+
+			ids.add(top.id);
+			++count;
+		}
+
+		return count;
+	}
+
+	/**
+	 * Expire time of the first id due, 0 when empty
+	 */
+	uint64 getNextExpireTime() {
+		while (heap.size() > 0 && !isCurrent(heap.getUnsafe(0)))
+			popTop();
+
+		return heap.size() > 0 ? heap.getUnsafe(0).expireTime : 0;
+	}
+
+	inline int size() const {
+		return scheduled.size();
+	}
+
+	inline int getHeapSize() const {
+		return heap.size();
+	}
+
+	void removeAll() {
+		heap.removeAll(1024, 1024);
+		scheduled.removeAll();
+	}
+};
+
+#endif /* AUCTIONEXPIRYINDEX_H_ */
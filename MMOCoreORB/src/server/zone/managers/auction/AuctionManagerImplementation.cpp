@@ -287,11 +287,16 @@ void AuctionManagerImplementation::checkVendorItems(bool startupTask) {
     	Timer timer(Time::MONOTONIC_TIME);
 
 	timer.start();
-	TerminalListVector items = auctionMap->getVendorTerminalData("", "", 0);
 
-	info("Checking " + String::valueOf(items.size()) + " vendor terminals", true);
+	if (!startupTask && ConfigManager::instance()->getBool("Core3.AuctionManager.ExpiryIndex", true)) {
+		checkExpiredItems(false, "vendor");
+	} else {
+		TerminalListVector items = auctionMap->getVendorTerminalData("", "", 0);
+
+		info("Checking " + String::valueOf(items.size()) + " vendor terminals", true);
 
-	doAuctionMaint(&items, "vendor", startupTask);
+		doAuctionMaint(&items, "vendor", startupTask);
+	}
 
 	auto elapsed = timer.stopMs();
 
@@ -313,17 +318,45 @@ void AuctionManagerImplementation::checkAuctions(bool startupTask) {
 
     Timer timer(Time::MONOTONIC_TIME);
 	timer.start();
-	TerminalListVector items = auctionMap->getBazaarTerminalData("", "", 0);
 
-	info("Checking " + String::valueOf(items.size()) + " bazaar terminals", true);
+	if (!startupTask && ConfigManager::instance()->getBool("Core3.AuctionManager.ExpiryIndex", true)) {
+		checkExpiredItems(true, "bazaar");
+	} else {
+		TerminalListVector items = auctionMap->getBazaarTerminalData("", "", 0);
 
-	doAuctionMaint(&items, "bazaar", startupTask);
+		info("Checking " + String::valueOf(items.size()) + " bazaar terminals", true);
+
+		doAuctionMaint(&items, "bazaar", startupTask);
+	}
 
 	auto elapsed = timer.stopMs();
 
 	info("Bazaar terminal checks completed in " + String::valueOf(elapsed) + "ms", true);
 }
 
+void AuctionManagerImplementation::checkExpiredItems(bool bazaar, const String& logTag) {
+	Vector<ManagedReference<AuctionItem*> > dueItems = auctionMap->pollExpiredItems(bazaar, time(0));
+
+	info(true) << logTag << ": " << dueItems.size() << " due item(s), " << auctionMap->getExpiryIndexSize(bazaar) << " item(s) in the expiry index";
+
+	if (dueItems.isEmpty())
+		return;
+
+	Reference<TerminalItemList*> list = new TerminalItemList();
+
+	for (int i = 0; i < dueItems.size(); ++i)
+		list->put(dueItems.get(i));
+
+	TerminalListVector items;
+	items.put(list);
+
+	doAuctionMaint(&items, logTag, false);
+
+	// Whatever is still listed goes back in the index, items left due are checked again next run
+	for (int i = 0; i < dueItems.size(); ++i)
+		auctionMap->updateExpiry(dueItems.get(i));
+}
+
 void AuctionManagerImplementation::doAuctionMaint(TerminalListVector* items, const String& logTag, bool startupTask) {
 	Time expireTime;
 	Time progressTime;
@@ -406,6 +439,8 @@ void AuctionManagerImplementation::doAuctionMaint(TerminalListVector* items, con
 			}
 
 			if (updatedExpire) {
+				auctionMap->updateExpiry(item);
+
 				if(item->isAuction() && auctionEvents.contains(item->getAuctionedItemObjectID())) {
 					Reference<Task*> newTask = auctionEvents.get(item->getAuctionedItemObjectID());
 
@@ -961,6 +996,8 @@ void AuctionManagerImplementation::doInstantBuy(CreatureObject* player, AuctionI
 	item->setBidderName(playername);
 	item->clearAuctionWithdraw();
 
+	auctionMap->updateExpiry(item);
+
 	TransactionLog trx(player, seller, TrxCode::INSTANTBUY, item->getPrice(), false);
 	trx.setAutoCommit(false);
 	trx.addRelatedObject(item->getAuctionedItemObjectID(), true);
@@ -1920,6 +1957,7 @@ void AuctionManagerImplementation::cancelItem(CreatureObject* player, uint64 obj
 	item->setStatus(AuctionItem::EXPIRED);
 	item->setExpireTime(availableTime);
 	item->clearAuctionWithdraw();
+	auctionMap->updateExpiry(item);
 
 	BaseMessage* msg = new CancelLiveAuctionResponseMessage(objectID, 0);
 	player->sendMessage(msg);
@@ -1964,6 +2002,7 @@ void AuctionManagerImplementation::expireSale(AuctionItem* item) {
 	item->setStatus(AuctionItem::EXPIRED);
 	item->setExpireTime(availableTime);
 	item->clearAuctionWithdraw();
+	auctionMap->updateExpiry(item);
 
 	locker.release();
 
@@ -2005,6 +2044,7 @@ void AuctionManagerImplementation::expireBidAuction(AuctionItem* item) {
 	item->setStatus(AuctionItem::EXPIRED);
 	item->setExpireTime(availableTime);
 	item->clearAuctionWithdraw();
+	auctionMap->updateExpiry(item);
 
 	locker.release();
 
@@ -2042,6 +2082,7 @@ void AuctionManagerImplementation::expireAuction(AuctionItem* item) {
 	Locker locker(item);
 	item->setExpireTime(availableTime);
 	item->clearAuctionWithdraw();
+	auctionMap->updateExpiry(item);
 
 	if (playername.isEmpty()) {
 		locker.release();
@@ -2,6 +2,7 @@
 #define AUCTIONSEARCHTASK_H_
 
 #include "server/zone/managers/auction/AuctionManager.h"
+#include "server/zone/managers/statistics/TaskProfiler.h"
 
 namespace server {
 namespace zone {
@@ -18,6 +19,7 @@ class AuctionSearchTask : public Task {
 	bool includeEntranceFee;
 	int32 category;
 	UnicodeString filterText;
+	Time queuedTime;
 
 public:
 	AuctionSearchTask(AuctionManager* manager, CreatureObject* play, SceneObject* uVendor, const String& plnt, const String& reg, SceneObject* vend, int scr, uint32 cat, const UnicodeString& filter, int minP, int maxP, bool entFee, int counter, int off) {
@@ -40,6 +42,8 @@ public:
 	}
 
 	void run() {
+		TaskProfiler::Scope profile(this, queuedTime.miliDifference());
+
 		ManagedReference<AuctionManager*> strongRef = auctionManager.get();
 
 		if (strongRef == nullptr)
@@ -57,8 +61,12 @@ public:
 
 		ManagedReference<SceneObject*> strongVendor = vendor.get();
 
+		profile.startLockWait();
+
 		Locker locker(strongPlayer);
 
+		profile.stopLockWait();
+
 		strongRef->getAuctionData(strongPlayer, strongVendorInUse, planet, region, strongVendor, screen, category, filterText, minPrice, maxPrice, includeEntranceFee, clientCounter, offset);
 
 	}
@@ -65,6 +65,7 @@ int AuctionsMapImplementation::addVendorItem(CreatureObject* player, const Strin
 		return ItemSoldMessage::UNKNOWNERROR;
 
 	allItems.put(item->getAuctionedItemObjectID(), item);
+	vendorExpiry.schedule(item->getAuctionedItemObjectID(), item->getExpireTime());
 
 	return ItemSoldMessage::SUCCESS;
 }
@@ -90,6 +91,8 @@ int AuctionsMapImplementation::addBazaarItem(CreatureObject* player, const Strin
 		return ItemSoldMessage::UNKNOWNERROR;
 
 	allItems.put(item->getAuctionedItemObjectID(), item);
+	bazaarExpiry.schedule(item->getAuctionedItemObjectID(), item->getExpireTime());
+
 	return ItemSoldMessage::SUCCESS;
 }
 
@@ -110,6 +113,9 @@ void AuctionsMapImplementation::removeItem(SceneObject* vendor, AuctionItem* ite
 	}
 
 	allItems.drop(item->getAuctionedItemObjectID());
+
+	vendorExpiry.remove(item->getAuctionedItemObjectID());
+	bazaarExpiry.remove(item->getAuctionedItemObjectID());
 }
 
 void AuctionsMapImplementation::removeVendorItem(SceneObject* vendor, AuctionItem* item) {
@@ -228,6 +234,7 @@ void AuctionsMapImplementation::deleteTerminalItems(SceneObject* vendor) {
 
 			if(item != nullptr) {
 				allItems.drop(item->getAuctionedItemObjectID());
+				vendorExpiry.remove(item->getAuctionedItemObjectID());
 				item->destroyAuctionItemFromDatabase(false, true);
 			}
 		}
@@ -323,3 +330,38 @@ void AuctionsMapImplementation::removeFromCommodityLimit(AuctionItem* item) {
 		commoditiesLimit.drop(item->getOwnerID());
 }
 
+void AuctionsMapImplementation::updateExpiry(AuctionItem* item) {
+	Locker locker(_this.getReferenceUnsafeStaticCast());
+
+	uint64 id = item->getAuctionedItemObjectID();
+
+	if (allItems.get(id).get() != item)
+		return;
+
+	if (bazaarItemsForSale.contains(item->getVendorID()))
+		bazaarExpiry.schedule(id, item->getExpireTime());
+	else
+		vendorExpiry.schedule(id, item->getExpireTime());
+}
+
+Vector<ManagedReference<AuctionItem*> > AuctionsMapImplementation::pollExpiredItems(bool bazaar, uint64 now) {
+	Locker locker(_this.getReferenceUnsafeStaticCast());
+
+	Vector<uint64> ids;
+
+	if (bazaar)
+		bazaarExpiry.pollDue(now, ids);
+	else
+		vendorExpiry.pollDue(now, ids);
+
+	Vector<ManagedReference<AuctionItem*> > items(ids.size() + 1, 100);
+
+	for (int i = 0; i < ids.size(); ++i) {
+		ManagedReference<AuctionItem*> item = allItems.get(ids.getUnsafe(i));
+
+		if (item != nullptr)
+			items.add(item);
+	}
+
+	return items;
+}
@@ -32,9 +32,20 @@ void SchematicMap::initialize(ZoneServer* server) {
 	zoneServer = server;
 	objectManager = zoneServer->getObjectManager();
 
+	Time start;
+
 	loadDraftSchematicDatabase();
+
+	uint64 databaseTime = start.miliDifference();
+
 	loadDraftSchematicFile();
+
+	uint64 scriptTime = start.miliDifference() - databaseTime;
+
 	loadSchematicGroups();
+
+	info(true) << "schematics loaded in " << start.miliDifference() << "ms: database " << databaseTime << "ms, scripts "
+		<< scriptTime << "ms, groups " << start.miliDifference() - databaseTime - scriptTime << "ms";
 }
 
 void SchematicMap::loadSchematicGroups() {
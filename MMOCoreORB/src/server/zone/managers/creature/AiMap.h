@@ -19,6 +19,7 @@
 #include "server/zone/objects/creature/ai/bt/ParallelSelectorBehavior.h"
 #include "server/zone/objects/creature/ai/bt/LuaBehavior.h"
 #include "templates/params/creature/CreatureFlag.h"
+#include "system/thread/atomic/AtomicLong.h"
 #include "server/zone/managers/creature/PetManager.h"
 
 class AiMap : public Singleton<AiMap>, public Logger, public Object {
@@ -58,6 +59,11 @@ public:
 	AtomicInteger activeAwarenessEvents;
 	AtomicInteger scheduledAwarenessEvents;
 
+	AtomicLong awarenessPasses;
+	AtomicLong awarenessCandidateWakeups;
+	AtomicLong awarenessWakeupsAvoided;
+	AtomicLong awarenessMoveWakeupsSkipped;
+
 	AtomicInteger activeRecoveryEvents;
 	AtomicInteger activeWaitEvents;
 
@@ -15,13 +15,14 @@ AtomicInteger CreatureTemplateManager::loadedMobileTemplates;
 int CreatureTemplateManager::DEBUG_MODE = 0;
 int CreatureTemplateManager::ERROR_CODE = NO_ERROR;
 
+thread_local CreatureTemplateStaging* CreatureTemplateManager::staging = nullptr;
+
 CreatureTemplateManager::CreatureTemplateManager() : Logger("CreatureTemplateManager") {
 	/*setLogging(false);
 		setGlobalLogging(true);*/
 	//setLoggingName("CreatureTemplateManager");
 
-	lua = new Lua();
-	lua->init();
+	lua = createLuaState();
 
 	if (DEBUG_MODE) {
 		setLogging(true);
@@ -30,6 +31,13 @@ CreatureTemplateManager::CreatureTemplateManager() : Logger("CreatureTemplateMan
 
 	hashTable.setNullValue(nullptr);
 
+	loadLuaConfig();
+}
+
+Lua* CreatureTemplateManager::createLuaState() {
+	Lua* lua = new Lua();
+	lua->init();
+
 	lua->registerFunction("includeFile", includeFile);
 	lua->registerFunction("addTemplate", addTemplate);
 	lua->registerFunction("addWeapon", addWeapon);
@@ -86,7 +94,7 @@ CreatureTemplateManager::CreatureTemplateManager() : Logger("CreatureTemplateMan
 	lua->setGlobalInt("NAME_DARKTROOPER", NameManagerType::DARKTROOPER);
 	lua->setGlobalInt("NAME_SWAMPTROOPER", NameManagerType::SWAMPTROOPER);
 
-	loadLuaConfig();
+	return lua;
 }
 
 void CreatureTemplateManager::loadLuaConfig() {
@@ -126,14 +134,44 @@ int CreatureTemplateManager::loadTemplates() {
 
 	bool ret = false;
 
+	ParallelLuaLoader loader("mobile templates");
+	loader.addIndexFile("serverobjects.lua");
+
+	// dress groups are read by CreatureTemplate::readObject, conversations set up the ConversationManager
+	loader.addSerialFile("conversations.lua");
+	loader.addSerialFile("dressgroup/serverobjects.lua");
+
+	auto runEntry = [](Lua* state) -> bool {
+		return state->runFile("scripts/mobile/creatures.lua");
+	};
+
+	Vector<CreatureTemplateStaging*> stagings;
+
 	try {
-		ret = lua->runFile("scripts/mobile/creatures.lua");
+		ret = loader.loadMain(lua, runEntry);
+
+		for (int i = 0; i < loader.getStagingSlotCount(); ++i)
+			stagings.add(new CreatureTemplateStaging());
+
+		ret = loader.loadPartitions(&createLuaState, runEntry, [&stagings](int slot) {
+			staging = slot >= 0 ? stagings.get(slot) : nullptr;
+		}) && ret;
 	} catch (Exception& e) {
 		error(e.getMessage());
 		e.printStackTrace();
 		ret = false;
 	}
 
+	Time mergeStart;
+
+	for (int i = 0; i < loader.getPartitionCount(); ++i)
+		mergeStaging(stagings.get(i), loader.getPartition(i));
+
+	for (int i = 0; i < stagings.size(); ++i)
+		delete stagings.get(i);
+
+	uint64 mergeTime = mergeStart.miliDifference();
+
 	lua = nullptr;
 
 	if (!ret)
@@ -142,11 +180,47 @@ int CreatureTemplateManager::loadTemplates() {
 	if (!DEBUG_MODE) {
 		printf("\n");
 		info("done loading mobile templates", true);
+
+		loader.logBreakdown(mergeTime);
 	}
 
 	return ERROR_CODE;
 }
 
+void CreatureTemplateManager::mergeStaging(const CreatureTemplateStaging* stage, const String& file) {
+	for (int i = 0; i < stage->templates.size(); ++i) {
+		uint32 crc = stage->templates.getKey(i);
+
+		if (hashTable.containsKey(crc)) {
+			error("overwriting mobile " + stage->templates.getName(i) + " with " + file);
+
+			ERROR_CODE = DUPLICATE_MOBILE;
+		}
+
+		hashTable.put(crc, stage->templates.getValue(i));
+	}
+
+	for (int i = 0; i < stage->conversations.size(); ++i) {
+		uint32 crc = stage->conversations.getKey(i);
+
+		if (conversations.containsKey(crc)) {
+			error("overwriting convoTemplate " + stage->conversations.getName(i) + " with " + file);
+
+			ERROR_CODE = DUPLICATE_CONVO;
+		}
+
+		conversations.put(crc, stage->conversations.getValue(i));
+	}
+
+	stage->weapons.mergeInto(weaponMap);
+	stage->spawnGroups.mergeInto(spawnGroupMap);
+	stage->lairTemplates.mergeInto(lairTemplates);
+	stage->destroyMissionGroups.mergeInto(destroyMissionGroupMap);
+	stage->patrolPaths.mergeInto(patrolPaths);
+	stage->outfits.mergeInto(outfits);
+	stage->dressGroups.mergeInto(dressMap);
+}
+
 int CreatureTemplateManager::checkArgumentCount(lua_State* L, int args) {
 	int parameterCount = lua_gettop(L);
 
@@ -167,10 +241,15 @@ int CreatureTemplateManager::includeFile(lua_State* L) {
 
 	String filename = Lua::getStringParameter(L);
 
+	if (!ParallelLuaLoader::beginInclude(filename))
+		return 0;
+
 	int oldError = ERROR_CODE;
 
 	bool ret = Lua::runFile("scripts/mobile/" + filename, L);
 
+	ParallelLuaLoader::endInclude();
+
 	if (!ret) {
 		ERROR_CODE = GENERAL_ERROR;
 
@@ -199,18 +278,22 @@ int CreatureTemplateManager::addTemplate(lua_State* L) {
 	newTemp->setTemplateName(ascii);
 	newTemp->readObject(&obj);
 
-	if (instance()->hashTable.containsKey(crc)) {
-		luaL_where (L, 2);
-		String luaMethodName = lua_tostring(L, -1);
+	if (staging != nullptr) {
+		staging->templates.put(crc, ascii, newTemp);
+	} else {
+		if (instance()->hashTable.containsKey(crc)) {
+			luaL_where (L, 2);
+			String luaMethodName = lua_tostring(L, -1);
 
-		lua_pop(L, 1);
+			lua_pop(L, 1);
 
-		instance()->error("overwriting mobile " + ascii + " with " + luaMethodName);
+			instance()->error("overwriting mobile " + ascii + " with " + luaMethodName);
 
-		ERROR_CODE = DUPLICATE_MOBILE;
-	}
+			ERROR_CODE = DUPLICATE_MOBILE;
+		}
 
-	CreatureTemplateManager::instance()->hashTable.put(crc, newTemp);
+		CreatureTemplateManager::instance()->hashTable.put(crc, newTemp);
+	}
 
 	int count = loadedMobileTemplates.increment();
 
@@ -233,6 +316,14 @@ int CreatureTemplateManager::addConversationTemplate(lua_State* L) {
 	LuaObject obj(L);
 	Reference<ConversationTemplate*> newTemp = new ConversationTemplate(crc);
 
+	if (staging != nullptr) {
+		newTemp->readObject(&obj);
+
+		staging->conversations.put(crc, ascii, newTemp);
+
+		return 0;
+	}
+
 	if (instance()->conversations.containsKey(crc)) {
 		luaL_where (L, 2);
 		String luaMethodName = lua_tostring(L, -1);
@@ -267,7 +358,10 @@ int CreatureTemplateManager::addWeapon(lua_State* L) {
 		for (int i = 1; i <= obj.getTableSize(); ++i)
 			weps.add(obj.getStringAt(i));
 
-		CreatureTemplateManager::instance()->weaponMap.put(crc, weps);
+		if (staging != nullptr)
+			staging->weapons.put(crc, ascii, weps);
+		else
+			CreatureTemplateManager::instance()->weaponMap.put(crc, weps);
 	}
 
 	return 0;
@@ -284,7 +378,12 @@ int CreatureTemplateManager::addSpawnGroup(lua_State* L) {
 	uint32 crc = (uint32) ascii.hashCode();
 
 	LuaObject obj(L);
-	CreatureTemplateManager::instance()->spawnGroupMap.put(crc, new SpawnGroup(ascii, obj));
+	Reference<SpawnGroup*> group = new SpawnGroup(ascii, obj);
+
+	if (staging != nullptr)
+		staging->spawnGroups.put(crc, ascii, group);
+	else
+		CreatureTemplateManager::instance()->spawnGroupMap.put(crc, group);
 
 	return 0;
 }
@@ -304,7 +403,10 @@ int CreatureTemplateManager::addLairTemplate(lua_State* L) {
 	Reference<LairTemplate*> templ = new LairTemplate(ascii);
 	templ->readObject(&obj);
 
-	CreatureTemplateManager::instance()->lairTemplates.put(crc, templ);
+	if (staging != nullptr)
+		staging->lairTemplates.put(crc, ascii, templ);
+	else
+		CreatureTemplateManager::instance()->lairTemplates.put(crc, templ);
 
 	return 0;
 }
@@ -320,7 +422,12 @@ int CreatureTemplateManager::addDestroyMissionGroup(lua_State* L) {
 	uint32 crc = (uint32) ascii.hashCode();
 
 	LuaObject obj(L);
-	CreatureTemplateManager::instance()->destroyMissionGroupMap.put(crc, new SpawnGroup(ascii, obj));
+	Reference<SpawnGroup*> group = new SpawnGroup(ascii, obj);
+
+	if (staging != nullptr)
+		staging->destroyMissionGroups.put(crc, ascii, group);
+	else
+		CreatureTemplateManager::instance()->destroyMissionGroupMap.put(crc, group);
 
 	return 0;
 }
@@ -339,7 +446,10 @@ int CreatureTemplateManager::addPatrolPathTemplate(lua_State* L) {
 	Reference<PatrolPathTemplate*> templ = new PatrolPathTemplate();
 	templ->readObject(&obj);
 
-	instance()->patrolPaths.put(ascii, templ);
+	if (staging != nullptr)
+		staging->patrolPaths.put(ascii, ascii, templ);
+	else
+		instance()->patrolPaths.put(ascii, templ);
 
 	return 0;
 }
@@ -358,7 +468,10 @@ int CreatureTemplateManager::addOutfitGroup(lua_State* L) {
 	Reference<MobileOutfitGroup*> templ = new MobileOutfitGroup();
 	templ->readObject(&obj);
 
-	instance()->outfits.put(ascii, templ);
+	if (staging != nullptr)
+		staging->outfits.put(ascii, ascii, templ);
+	else
+		instance()->outfits.put(ascii, templ);
 
 	return 0;
 }
@@ -391,7 +504,10 @@ int CreatureTemplateManager::addDressGroup(lua_State* L) {
 			dressGroup.add(templ);
 		}
 
-		CreatureTemplateManager::instance()->dressMap.put(crc, dressGroup);
+		if (staging != nullptr)
+			staging->dressGroups.put(crc, ascii, dressGroup);
+		else
+			CreatureTemplateManager::instance()->dressMap.put(crc, dressGroup);
 	}
 
 	return 0;
@@ -15,12 +15,26 @@
 #include "templates/mobile/MobileOutfitGroup.h"
 #include "SpawnGroup.h"
 #include "AiSpeciesData.h"
+#include "ParallelLuaLoader.h"
 
 namespace server {
 namespace zone {
 namespace managers {
 namespace creature {
 
+class CreatureTemplateStaging {
+public:
+	LuaStagedPuts<uint32, Reference<CreatureTemplate*> > templates;
+	LuaStagedPuts<uint32, Reference<ConversationTemplate*> > conversations;
+	LuaStagedPuts<uint32, Vector<String> > weapons;
+	LuaStagedPuts<uint32, Reference<SpawnGroup*> > spawnGroups;
+	LuaStagedPuts<uint32, Reference<LairTemplate*> > lairTemplates;
+	LuaStagedPuts<uint32, Reference<SpawnGroup*> > destroyMissionGroups;
+	LuaStagedPuts<String, Reference<PatrolPathTemplate*> > patrolPaths;
+	LuaStagedPuts<String, Reference<MobileOutfitGroup*> > outfits;
+	LuaStagedPuts<uint32, Vector<String> > dressGroups;
+};
+
 class CreatureTemplateManager : public Singleton<CreatureTemplateManager>, public Object, public Logger {
 protected:
 	VectorMap<uint32, Vector<String> > weaponMap;
@@ -38,6 +52,13 @@ protected:
 	HashTable<String, Reference<MobileOutfitGroup*> > outfits;
 	static AtomicInteger loadedMobileTemplates;
 
+	// set on the worker states of a parallel load, the callbacks put into it instead of the tables
+	static thread_local CreatureTemplateStaging* staging;
+
+	static Lua* createLuaState();
+
+	void mergeStaging(const CreatureTemplateStaging* stage, const String& file);
+
 public:
 	static int DEBUG_MODE;
 	enum LUA_ERROR_CODE { NO_ERROR = 0, GENERAL_ERROR, DUPLICATE_MOBILE, INCORRECT_ARGUMENTS, DUPLICATE_CONVO };
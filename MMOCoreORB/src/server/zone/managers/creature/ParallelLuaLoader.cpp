@@ -0,0 +1,251 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "ParallelLuaLoader.h"
+#include "conf/ConfigManager.h"
+
+#include <thread>
+
+thread_local ParallelLuaLoader::IncludeState ParallelLuaLoader::includeState;
+
+class ParallelLuaLoaderThread : public Thread {
+	ParallelLuaLoader* loader;
+	int worker;
+
+	const ParallelLuaLoader::StateFactory& createState;
+	const ParallelLuaLoader::EntryRunner& runEntry;
+	const ParallelLuaLoader::StagingSelector& selectStaging;
+
+public:
+	ParallelLuaLoaderThread(ParallelLuaLoader* loader, int worker, const ParallelLuaLoader::StateFactory& createState,
+			const ParallelLuaLoader::EntryRunner& runEntry, const ParallelLuaLoader::StagingSelector& selectStaging)
+		: loader(loader), worker(worker), createState(createState), runEntry(runEntry), selectStaging(selectStaging) {
+	}
+
+	void run() {
+		loader->runWorker(worker, createState, runEntry, selectStaging);
+	}
+};
+
+ParallelLuaLoader::ParallelLuaLoader(const String& name, int threadCount) : Logger("ParallelLuaLoader") {
+	dataSet = name;
+	threads = threadCount > 0 ? threadCount : getConfiguredThreads();
+
+	mainTime = 0;
+	parallelTime = 0;
+}
+
+int ParallelLuaLoader::getConfiguredThreads() {
+	int count = ConfigManager::instance()->getInt("Core3.ParallelLuaLoader.Threads", 0);
+
+	if (count > 0)
+		return count;
+
+	count = std::thread::hardware_concurrency();
+
+	return Math::max(1, Math::min(count, 8));
+}
+
+bool ParallelLuaLoader::matches(const Vector<String>& files, const String& file) const {
+	String fileName = file.subString(file.lastIndexOf("/") + 1);
+
+	for (int i = 0; i < files.size(); ++i) {
+		const String& name = files.get(i);
+
+		if (name == file || name == fileName)
+			return true;
+	}
+
+	return false;
+}
+
+bool ParallelLuaLoader::beginInclude(const String& file) {
+	IncludeState& state = includeState;
+	ParallelLuaLoader* loader = state.loader;
+
+	if (loader == nullptr || state.mode == PARTITION)
+		return true;
+
+	// everything a serial file includes runs with it
+	if (state.serialDepth == -1) {
+		bool serial = loader->matches(loader->serialFiles, file);
+
+		if (serial && state.skipped == 0) {
+			if (state.mode == PRELUDE)
+				return false;
+
+			state.serialDepth = state.depth + 1;
+		} else {
+			if (serial && state.mode == MAIN)
+				loader->warning() << file << " is included after the first partition of " << loader->dataSet << ", loading it as a partition";
+
+			bool index = loader->matches(loader->indexFiles, file);
+			bool parentIndex = state.indexMask & (1ull << state.depth);
+
+			if (!index && (parentIndex || state.skipped > 0)) {
+				int partition = state.skipped++;
+
+				if (state.mode == MAIN) {
+					loader->partitions.add(file);
+					loader->partitionTimes.add(0);
+				} else if (partition >= loader->partitions.size() || loader->partitions.get(partition) != file) {
+					loader->error() << "worker state included " << file << " as partition " << partition << " of " << loader->dataSet;
+					loader->failed.set(true);
+				}
+
+				return false;
+			}
+
+			if (index)
+				state.indexMask |= 1ull << (state.depth + 1);
+		}
+	}
+
+	++state.depth;
+
+	return true;
+}
+
+void ParallelLuaLoader::endInclude() {
+	IncludeState& state = includeState;
+
+	if (state.loader == nullptr || state.mode == PARTITION)
+		return;
+
+	if (state.depth == state.serialDepth)
+		state.serialDepth = -1;
+
+	state.indexMask &= ~(1ull << state.depth);
+
+	--state.depth;
+}
+
+bool ParallelLuaLoader::loadMain(Lua* lua, const EntryRunner& runEntry) {
+	Time start;
+
+	// with a single state everything runs inline like before
+	if (threads > 1) {
+		includeState = IncludeState();
+		includeState.loader = this;
+		includeState.mode = MAIN;
+	}
+
+	bool ret = runEntry(lua);
+
+	includeState = IncludeState();
+
+	threads = Math::max(1, Math::min(threads, partitions.size()));
+
+	mainTime = start.miliDifference();
+
+	return ret;
+}
+
+bool ParallelLuaLoader::loadPartitions(const StateFactory& createState, const EntryRunner& runEntry, const StagingSelector& selectStaging) {
+	if (partitions.isEmpty())
+		return true;
+
+	Time start;
+
+	nextPartition.set(0);
+
+	Vector<ParallelLuaLoaderThread*> workers;
+
+	for (int i = 0; i < threads; ++i)
+		workers.add(new ParallelLuaLoaderThread(this, i, createState, runEntry, selectStaging));
+
+	for (int i = 0; i < threads; ++i)
+		workers.get(i)->start();
+
+	for (int i = 0; i < threads; ++i) {
+		workers.get(i)->join();
+
+		delete workers.get(i);
+	}
+
+	parallelTime = start.miliDifference();
+
+	return !failed.get();
+}
+
+void ParallelLuaLoader::runWorker(int worker, const StateFactory& createState, const EntryRunner& runEntry, const StagingSelector& selectStaging) {
+	Time start;
+
+	includeState = IncludeState();
+	includeState.loader = this;
+	includeState.mode = PRELUDE;
+
+	selectStaging(partitions.size() + worker);
+
+	Lua* lua = createState();
+
+	if (!runEntry(lua)) {
+		error() << "worker state " << worker << " failed to run the entry script of " << dataSet;
+		failed.set(true);
+	}
+
+	if (includeState.skipped != partitions.size()) {
+		error() << "worker state " << worker << " skipped " << includeState.skipped << " of " << partitions.size() << " partitions of " << dataSet;
+		failed.set(true);
+	}
+
+	preludeTime.add(start.miliDifference());
+
+	includeState.mode = PARTITION;
+
+	lua_State* L = lua->getLuaState();
+
+	int index;
+
+	while ((index = nextPartition.increment() - 1) < partitions.size()) {
+		uint64 partitionStart = System::getMikroTime();
+
+		selectStaging(index);
+
+		lua_getglobal(L, "includeFile");
+		lua_pushstring(L, partitions.get(index).toCharArray());
+
+		if (lua_pcall(L, 1, 0, 0) != 0) {
+			error() << "loading " << partitions.get(index) << ": " << lua_tostring(L, -1);
+			lua_pop(L, 1);
+
+			failed.set(true);
+		}
+
+		// every slot is written by a single worker
+		partitionTimes.set(index, System::getMikroTime() - partitionStart);
+	}
+
+	selectStaging(-1);
+
+	includeState = IncludeState();
+
+	delete lua;
+}
+
+void ParallelLuaLoader::logBreakdown(uint64 mergeTime) {
+	uint64 totalTime = 0;
+	int slowest = -1;
+
+	for (int i = 0; i < partitionTimes.size(); ++i) {
+		uint64 time = partitionTimes.get(i);
+
+		totalTime += time;
+
+		if (slowest == -1 || time > partitionTimes.get(slowest))
+			slowest = i;
+	}
+
+	auto msg = info(true);
+
+	msg << dataSet << " loaded in " << mainTime + parallelTime + mergeTime << "ms: main state " << mainTime << "ms";
+
+	if (!partitions.isEmpty()) {
+		msg << ", " << partitions.size() << " files on " << threads << " states " << parallelTime << "ms"
+			<< " (prelude avg " << (uint64) preludeTime.get() / threads << "ms, files total " << totalTime / 1000 << "ms"
+			<< ", slowest " << partitions.get(slowest) << " " << partitionTimes.get(slowest) << "us)";
+	}
+
+	msg << ", merge " << mergeTime << "ms";
+}
@@ -0,0 +1,186 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef PARALLELLUALOADER_H_
+#define PARALLELLUALOADER_H_
+
+#include "engine/engine.h"
+
+/**
+ * Puts made by one partition of a data set, replayed into the shared tables in
+ * partition order once every partition is loaded.
+ */
+template<class K, class V>
+class LuaStagedPuts {
+	Vector<K> keys;
+	Vector<String> names;
+	Vector<V> values;
+
+public:
+	void put(const K& key, const String& name, const V& value) {
+		keys.add(key);
+		names.add(name);
+		values.add(value);
+	}
+
+	inline int size() const {
+		return keys.size();
+	}
+
+	inline const K& getKey(int index) const {
+		return keys.get(index);
+	}
+
+	inline const String& getName(int index) const {
+		return names.get(index);
+	}
+
+	inline const V& getValue(int index) const {
+		return values.get(index);
+	}
+
+	template<class Table>
+	void mergeInto(Table& table) const {
+		for (int i = 0; i < keys.size(); ++i)
+			table.put(keys.get(i), values.get(i));
+	}
+};
+
+/**
+ * Loads a lua data set that is spread over files pulled in through includeFile on several
+ * lua states at once.
+ *
+ * The main state runs the entry script first. Index files (the serverobjects.lua lists) are
+ * entered as usual, but every file they include is recorded as a partition instead of run,
+ * as is any other file included after the first partition. Serial files run in full on the
+ * main state right away, they are for data the partitions read while loading.
+ *
+ * Each worker state then runs the entry script once with all partitions and serial files
+ * skipped, to get the same globals, and takes partitions off a shared counter. The include
+ * callback of the data set is used to run them, so the owner stages the puts of partition i
+ * in its own slot and merges the slots in order: the result and the conflicts reported are
+ * the same as when loading everything on one state.
+ */
+class ParallelLuaLoader : public Logger {
+public:
+	enum LOAD_MODE { MAIN = 0, PRELUDE, PARTITION };
+
+	/**
+	 * Creates a worker lua state with the data set functions and globals registered
+	 */
+	typedef Function<Lua*()> StateFactory;
+
+	/**
+	 * Runs the entry script on the given state
+	 */
+	typedef Function<bool(Lua*)> EntryRunner;
+
+	/**
+	 * Points the staging of the calling thread to the slot, slots past getPartitionCount()
+	 * are for the worker preludes and are discarded, -1 clears it
+	 */
+	typedef Function<void(int)> StagingSelector;
+
+protected:
+	String dataSet;
+
+	Vector<String> indexFiles;
+	Vector<String> serialFiles;
+
+	Vector<String> partitions;
+	Vector<uint64> partitionTimes; // us
+
+	AtomicInteger nextPartition;
+	AtomicBoolean failed;
+
+	int threads;
+
+	uint64 mainTime;
+	uint64 parallelTime;
+	AtomicLong preludeTime;
+
+	class IncludeState {
+	public:
+		ParallelLuaLoader* loader;
+		int mode;
+		int depth;
+		uint64 indexMask;
+		int serialDepth;
+		int skipped;
+
+		IncludeState() : loader(nullptr), mode(MAIN), depth(0), indexMask(0), serialDepth(-1), skipped(0) {
+		}
+	};
+
+	static thread_local IncludeState includeState;
+
+	bool matches(const Vector<String>& files, const String& file) const;
+
+	void runWorker(int worker, const StateFactory& createState, const EntryRunner& runEntry, const StagingSelector& selectStaging);
+
+	friend class ParallelLuaLoaderThread;
+
+public:
+	ParallelLuaLoader(const String& name, int threadCount = 0);
+
+	/**
+	 * Files whose includes are partitions, matched against the include name or its file name
+	 */
+	inline void addIndexFile(const String& file) {
+		indexFiles.add(file);
+	}
+
+	/**
+	 * Files run in full on the main state before any partition, skipped by the workers
+	 */
+	inline void addSerialFile(const String& file) {
+		serialFiles.add(file);
+	}
+
+	/**
+	 * Runs the entry script on the main state and records the partitions
+	 */
+	bool loadMain(Lua* lua, const EntryRunner& runEntry);
+
+	/**
+	 * Loads the recorded partitions on the worker states, returns once all are loaded
+	 */
+	bool loadPartitions(const StateFactory& createState, const EntryRunner& runEntry, const StagingSelector& selectStaging);
+
+	/**
+	 * Logs the time spent on the main state, the workers and the merge of the data set
+	 */
+	void logBreakdown(uint64 mergeTime);
+
+	inline int getPartitionCount() const {
+		return partitions.size();
+	}
+
+	inline const String& getPartition(int index) const {
+		return partitions.get(index);
+	}
+
+	inline int getStagingSlotCount() const {
+		return partitions.size() + threads;
+	}
+
+	inline int getThreadCount() const {
+		return threads;
+	}
+
+	/**
+	 * Called by the include callback of the data set before running file, false when the
+	 * file is loaded elsewhere and must be skipped. Every true result needs an endInclude.
+	 */
+	static bool beginInclude(const String& file);
+
+	static void endInclude();
+
+	/**
+	 * Configured number of worker states, 0 means one per core with a max of 8
+	 */
+	static int getConfiguredThreads();
+};
+
+#endif /* PARALLELLUALOADER_H_ */
@@ -0,0 +1,212 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "ZoneAwarenessPass.h"
+
+#include "server/zone/Zone.h"
+#include "server/zone/CloseObjectsVector.h"
+#include "server/zone/objects/creature/ai/AiAgent.h"
+#include "server/zone/managers/creature/AiMap.h"
+
+#include <vector>
+
+bool ZoneAwarenessPass::enabled = true;
+
+ZoneAwarenessPass::ZoneAwarenessPass(Zone* zone) : Logger("ZoneAwarenessPass"), zone(zone) {
+	auto config = ConfigManager::instance();
+
+	interval = Math::max(100, config->getInt("Core3.AwarenessPass.Interval", 1000));
+	minimumRadius = Math::max(0, config->getInt("Core3.AwarenessPass.MinRadius", 40));
+
+	movedCreatures.setNoDuplicateInsertPlan();
+
+	setLoggingName("ZoneAwarenessPass " + zone->getZoneName());
+}
+
+ZoneAwarenessPass::~ZoneAwarenessPass() {
+}
+
+void ZoneAwarenessPass::loadConfig() {
+	enabled = ConfigManager::instance()->getInt("Core3.AwarenessPass.Enabled", 1) != 0;
+}
+
+void ZoneAwarenessPass::start() {
+	if (!enabled || !running.compareAndSet(false, true))
+		return;
+
+	schedulePass();
+}
+
+void ZoneAwarenessPass::stop() {
+	running.set(false);
+
+	Reference<Task*> task = passTask;
+
+	if (task != nullptr && task->isScheduled())
+		task->cancel();
+
+	Locker locker(&movedMutex);
+
+	movedCreatures.removeAll();
+}
+
+void ZoneAwarenessPass::schedulePass() {
+	ManagedReference<Zone*> strongZone = zone.get();
+
+	if (strongZone == nullptr)
+		return;
+
+	Reference<ZoneAwarenessPass*> pass = this;
+
+	passTask = new LambdaTask([pass]() {
+		pass->runPass();
+
+		if (pass->running.get())
+			pass->schedulePass();
+	}, "ZoneAwarenessPassTask");
+
+	passTask->setCustomTaskQueue(strongZone->getZoneName());
+	passTask->schedule(interval);
+}
+
+void ZoneAwarenessPass::notifyCreatureMoved(CreatureObject* creature) {
+	if (!running.get())
+		return;
+
+	Locker locker(&movedMutex);
+
+	movedCreatures.put(creature->getObjectID(), creature);
+}
+
+float ZoneAwarenessPass::getAwarenessRadius(int aggroRadius, int agentLevel, int playerLevel, float minimumRadius) {
+	float radius = aggroRadius;
+
+	if (radius == 0)
+		radius = AiAgent::DEFAULTAGGRORADIUS;
+
+	float levelDiff = playerLevel - agentLevel;
+	float mod = Math::max(0.04f, Math::min((1.f - (levelDiff / 20.f)), 1.2f));
+
+	return Math::max(radius * mod * 2, minimumRadius);
+}
+
+void ZoneAwarenessPass::runPass() {
+	VectorMap<uint64, ManagedWeakReference<CreatureObject*> > movers;
+
+	{
+		Locker locker(&movedMutex);
+
+		if (movedCreatures.size() == 0)
+			return;
+
+		movers = movedCreatures;
+		movedCreatures.removeAll();
+	}
+
+	AiMap* aiMap = AiMap::instance();
+	aiMap->awarenessPasses.increment();
+
+	// strong references, the close objects vector lock is released once copied
+	Vector<ManagedReference<QuadTreeEntry*> > closeObjects;
+	Vector<ManagedReference<AiAgent*> > agents;
+
+	std::vector<float> agentX, agentY, agentZ, radiusSquared;
+	std::vector<uint8> inRange;
+
+	for (int i = 0; i < movers.size(); ++i) {
+		ManagedReference<CreatureObject*> mover = movers.elementAt(i).getValue().get();
+
+		if (mover == nullptr || mover->getZoneUnsafe() == nullptr || mover->isInvisible())
+			continue;
+
+		CloseObjectsVector* vec = (CloseObjectsVector*) mover->getCloseObjects();
+
+		if (vec == nullptr)
+			continue;
+
+		closeObjects.removeAll();
+		vec->safeCopyReceiversTo(closeObjects, CloseObjectsVector::CREOTYPE);
+
+		agents.removeAll();
+		agentX.clear();
+		agentY.clear();
+		agentZ.clear();
+		radiusSquared.clear();
+
+		int moverLevel = mover->getLevel();
+
+		// only players are joined against aggro radii, other movers only wake what follows them
+		bool playerMover = mover->isPlayerCreature();
+
+		// dirty reads, the agent revalidates everything under its own lock once woken
+		for (int j = 0; j < closeObjects.size(); ++j) {
+			SceneObject* scene = static_cast<SceneObject*>(closeObjects.getUnsafe(j).get());
+			AiAgent* agent = scene->asAiAgent();
+
+			if (agent == nullptr || agent == mover || agent->isDead() || agent->isInCombat())
+				continue;
+
+			// whatever the agent follows is always worth a look, it can time out or run off
+			ManagedReference<SceneObject*> followObject = agent->getFollowObject().get();
+
+			if (followObject != nullptr && followObject->getObjectID() == mover->getObjectID()) {
+				aiMap->awarenessCandidateWakeups.increment();
+				agent->queueAwarenessCandidate(mover);
+				continue;
+			}
+
+			if (!playerMover)
+				continue;
+
+			Vector3 position = agent->getWorldPosition();
+			float radius = getAwarenessRadius(agent->getAggroRadius(), agent->getLevel(), moverLevel, minimumRadius);
+
+			agents.add(agent);
+			agentX.push_back(position.getX());
+			agentY.push_back(position.getY());
+			agentZ.push_back(position.getZ());
+			radiusSquared.push_back(radius * radius);
+		}
+
+		int count = agents.size();
+
+		if (count == 0)
+			continue;
+
+		Vector3 moverPosition = mover->getWorldPosition();
+		float px = moverPosition.getX();
+		float py = moverPosition.getY();
+		float pz = moverPosition.getZ();
+
+		inRange.resize(count);
+
+		const float* xs = agentX.data();
+		const float* ys = agentY.data();
+		const float* zs = agentZ.data();
+		const float* rs = radiusSquared.data();
+		uint8* hits = inRange.data();
+
+		// branch free over flat arrays so the compiler can vectorize it
+		for (int j = 0; j < count; ++j) {
+			float dx = xs[j] - px;
+			float dy = ys[j] - py;
+			float dz = zs[j] - pz;
+
+			hits[j] = (dx * dx + dy * dy + dz * dz) <= rs[j];
+		}
+
+		int woken = 0;
+
+		for (int j = 0; j < count; ++j) {
+			if (!hits[j])
+				continue;
+
+			agents.getUnsafe(j)->queueAwarenessCandidate(mover);
+			++woken;
+		}
+
+		aiMap->awarenessCandidateWakeups.add(woken);
+		aiMap->awarenessWakeupsAvoided.add(count - woken);
+	}
+}
@@ -0,0 +1,93 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef ZONEAWARENESSPASS_H_
+#define ZONEAWARENESSPASS_H_
+
+#include "engine/engine.h"
+
+namespace server {
+ namespace zone {
+  namespace objects {
+   namespace creature {
+    class CreatureObject;
+   }
+  }
+
+  class Zone;
+ }
+}
+
+using namespace server::zone::objects::creature;
+using namespace server::zone;
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace creature {
+
+/**
+ * Awareness for a whole zone at a fixed tick. Players that moved since the
+ * last pass are joined against the AI agents around them; an agent is only
+ * woken, with the mover attached as its candidate, when the mover is inside
+ * its level scaled awareness radius. Other creatures that moved, pets and
+ * NPCs, only wake the agents following them.
+ * Agents no longer schedule an awareness event for every move of every player
+ * they can see. Once woken an agent polls on its own again while players are
+ * in range, so targets that stop moving are still looked at.
+ */
+class ZoneAwarenessPass : public Object, public Logger {
+	ManagedWeakReference<Zone*> zone;
+
+	Mutex movedMutex;
+	VectorMap<uint64, ManagedWeakReference<CreatureObject*> > movedCreatures;
+
+	Reference<Task*> passTask;
+
+	int interval;
+	float minimumRadius;
+
+	AtomicBoolean running;
+
+	static bool enabled;
+
+	void schedulePass();
+
+public:
+	ZoneAwarenessPass(Zone* zone);
+	~ZoneAwarenessPass();
+
+	static void loadConfig();
+
+	static bool isEnabled() {
+		return enabled;
+	}
+
+	void start();
+	void stop();
+
+	/**
+	 * Called once per creature move, the creature is looked at by the next pass
+	 */
+	void notifyCreatureMoved(CreatureObject* creature);
+
+	void runPass();
+
+	/**
+	 * Radius within which a mover can change what an agent does: the stalker
+	 * range of runStartAwarenessInterrupt, scaled by level difference like the
+	 * interrupt does, but never below the fixed ranges of the lua interrupts
+	 * and reaction chat
+	 */
+	static float getAwarenessRadius(int aggroRadius, int agentLevel, int playerLevel, float minimumRadius);
+};
+
+}
+}
+}
+}
+
+using namespace server::zone::managers::creature;
+
+#endif /* ZONEAWARENESSPASS_H_ */
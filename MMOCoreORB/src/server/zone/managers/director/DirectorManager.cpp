@@ -31,6 +31,7 @@
 #include "server/zone/managers/collision/CollisionManager.h"
 #include "server/zone/managers/director/ScreenPlayObserver.h"
 #include "server/zone/managers/director/PersistentEvent.h"
+#include "server/zone/managers/director/LuaBindingProfiler.h"
 #include "server/zone/managers/creature/CreatureManager.h"
 #include "server/zone/managers/creature/PetManager.h"
 #include "server/zone/managers/planet/PlanetManager.h"
@@ -587,44 +588,44 @@ void DirectorManager::initializeLuaEngine(Lua* luaEngine) {
 	// SUI Window Types (WIP)
 	luaEngine->setGlobalInt("NEWSNET_INFO", SuiWindowType::NEWSNET_INFO);
 
-	Luna<LuaCellObject>::Register(luaEngine->getLuaState());
-	Luna<LuaBuildingObject>::Register(luaEngine->getLuaState());
-	Luna<LuaCreatureObject>::Register(luaEngine->getLuaState());
-	Luna<LuaSceneObject>::Register(luaEngine->getLuaState());
-	Luna<LuaConversationScreen>::Register(luaEngine->getLuaState());
-	Luna<LuaConversationSession>::Register(luaEngine->getLuaState());
-	Luna<LuaConversationTemplate>::Register(luaEngine->getLuaState());
-	Luna<LuaIntangibleObject>::Register(luaEngine->getLuaState());
-	Luna<LuaControlDevice>::Register(luaEngine->getLuaState());
-	Luna<LuaPlayerObject>::Register(luaEngine->getLuaState());
-	Luna<LuaAiAgent>::Register(luaEngine->getLuaState());
-	Luna<LuaActiveArea>::Register(luaEngine->getLuaState());
-	Luna<LuaTangibleObject>::Register(luaEngine->getLuaState());
-	Luna<LuaSuiManager>::Register(luaEngine->getLuaState());
-	Luna<LuaSuiBox>::Register(luaEngine->getLuaState());
-	Luna<LuaObjectMenuResponse>::Register(luaEngine->getLuaState());
-	Luna<LuaDeed>::Register(luaEngine->getLuaState());
-	Luna<LuaCityRegion>::Register(luaEngine->getLuaState());
-	Luna<LuaStringIdChatParameter>::Register(luaEngine->getLuaState());
-	Luna<LuaTicketObject>::Register(luaEngine->getLuaState());
-	Luna<LuaQuestInfo>::Register(luaEngine->getLuaState());
-	Luna<LuaFsPuzzlePack>::Register(luaEngine->getLuaState());
-	Luna<LuaFsCsObject>::Register(luaEngine->getLuaState());
-	Luna<LuaFsBuffItem>::Register(luaEngine->getLuaState());
-	Luna<LuaResourceSpawn>::Register(luaEngine->getLuaState());
-	Luna<LuaCustomIngredient>::Register(luaEngine->getLuaState());
-	Luna<LuaFsCraftingComponentObject>::Register(luaEngine->getLuaState());
-	Luna<LuaSuiPageData>::Register(luaEngine->getLuaState());
-	Luna<LuaQuestVectorMap>::Register(luaEngine->getLuaState());
-	Luna<LuaSuiBoxPage>::Register(luaEngine->getLuaState());
-	Luna<LuaPowerupObject>::Register(luaEngine->getLuaState());
-	Luna<LuaWaypointObject>::Register(luaEngine->getLuaState());
-	Luna<LuaComponent>::Register(luaEngine->getLuaState());
-	Luna<LuaSuiListBox>::Register(luaEngine->getLuaState());
-	Luna<LuaLightsaberCrystalComponent>::Register(luaEngine->getLuaState());
-	Luna<LuaSkill>::Register(luaEngine->getLuaState());
-	Luna<LuaSkillManager>::Register(luaEngine->getLuaState());
-	Luna<LuaContractCrate>::Register(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaCellObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaBuildingObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaCreatureObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaSceneObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaConversationScreen>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaConversationSession>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaConversationTemplate>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaIntangibleObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaControlDevice>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaPlayerObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaAiAgent>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaActiveArea>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaTangibleObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaSuiManager>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaSuiBox>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaObjectMenuResponse>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaDeed>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaCityRegion>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaStringIdChatParameter>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaTicketObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaQuestInfo>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaFsPuzzlePack>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaFsCsObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaFsBuffItem>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaResourceSpawn>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaCustomIngredient>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaFsCraftingComponentObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaSuiPageData>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaQuestVectorMap>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaSuiBoxPage>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaPowerupObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaWaypointObject>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaComponent>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaSuiListBox>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaLightsaberCrystalComponent>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaSkill>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaSkillManager>(luaEngine->getLuaState());
+	LuaBindingProfiler::registerClass<LuaContractCrate>(luaEngine->getLuaState());
 }
 
 int DirectorManager::loadScreenPlays(Lua* luaEngine) {
@@ -2494,9 +2495,32 @@ Lua* DirectorManager::getLuaInstance() {
 		*version = masterScreenPlayVersion.get();
 	}
 
+	releaseObjectWrappers(lua);
+
 	return lua;
 }
 
+void DirectorManager::releaseObjectWrappers(Lua* lua) {
+	lua_State* L = lua->getLuaState();
+	lua_Debug ar;
+
+	// a nested call still uses the wrappers of the call running below it
+	if (lua_getstack(L, 0, &ar))
+		return;
+
+	lua_getglobal(L, "releaseObjectWrappers");
+
+	if (!lua_isfunction(L, -1)) {
+		lua_pop(L, 1);
+		return;
+	}
+
+	if (lua_pcall(L, 0, 0, 0) != 0) {
+		error() << "releaseObjectWrappers: " << lua_tostring(L, -1);
+		lua_pop(L, 1);
+	}
+}
+
 int DirectorManager::runScreenPlays() {
 	Lua* lua = localLua.get();
 	uint32* version = localScreenPlayVersion.get();
@@ -2631,7 +2655,7 @@ int DirectorManager::getStringId(lua_State* L) {
 	}
 
 	String stringid = lua_tostring(L, -1);
-	String stringvalue = StringIdManager::instance()->getStringId(stringid.hashCode()).toString();
+	String stringvalue = StringIdManager::instance()->getStringIdAsString(stringid.hashCode());
 	lua_pushstring(L, stringvalue.toCharArray());
 
 	return 1;
@@ -0,0 +1,163 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "LuaBindingProfiler.h"
+#include "conf/ConfigManager.h"
+
+#include <algorithm>
+
+LuaBindingProfiler::LuaBindingProfiler() : Logger("LuaBindingProfiler"), counters(100, 100), enabled(false) {
+	counters.setNoDuplicateInsertPlan();
+}
+
+LuaBindingProfiler::~LuaBindingProfiler() {
+	for (int i = 0; i < counters.size(); ++i)
+		delete counters.elementAt(i).getValue();
+}
+
+void LuaBindingProfiler::loadConfig() {
+	enabled = ConfigManager::instance()->getBool("Core3.LuaBindingProfiler.Enabled", false);
+
+	info() << "enabled: " << enabled;
+}
+
+LuaBindingCounter* LuaBindingProfiler::getCounter(const String& className, const String& methodName) {
+	String key = className + ":" + methodName;
+
+	Locker locker(&countersMutex);
+
+	int index = counters.find(key);
+
+	if (index != -1)
+		return counters.elementAt(index).getValue();
+
+	LuaBindingCounter* counter = new LuaBindingCounter(className, methodName);
+
+	counters.put(key, counter);
+
+	return counter;
+}
+
+int LuaBindingProfiler::profiledCall(lua_State* L) {
+	LuaBindingCounter* counter = static_cast<LuaBindingCounter*>(lua_touserdata(L, lua_upvalueindex(2)));
+
+	int args = lua_gettop(L);
+
+	lua_pushvalue(L, lua_upvalueindex(1));
+	lua_insert(L, 1);
+
+	uint64 start = Time::currentNanoTime();
+
+	lua_call(L, args, LUA_MULTRET);
+
+	counter->record(Time::currentNanoTime() - start);
+
+	return lua_gettop(L);
+}
+
+void LuaBindingProfiler::instrument(lua_State* L, const char* className) {
+	if (!enabled)
+		return;
+
+	luaL_getmetatable(L, className);
+
+	if (!lua_istable(L, -1)) {
+		lua_pop(L, 1);
+
+		error() << "no metatable registered for " << className;
+
+		return;
+	}
+
+	int metatable = lua_gettop(L);
+
+	instrumentTable(L, metatable, className);
+
+	// methods either live in the metatable itself or in the table __index points to
+	lua_getfield(L, metatable, "__index");
+
+	if (lua_istable(L, -1) && !lua_rawequal(L, -1, metatable))
+		instrumentTable(L, lua_gettop(L), className);
+
+	lua_pop(L, 2);
+}
+
+void LuaBindingProfiler::instrumentTable(lua_State* L, int table, const char* className) {
+	lua_pushnil(L);
+
+	while (lua_next(L, table) != 0) {
+		lua_CFunction function = lua_tocfunction(L, -1);
+
+		// only existing fields are replaced, which lua_next allows during the traversal
+		if (lua_type(L, -2) == LUA_TSTRING && function != nullptr && function != &profiledCall) {
+			const char* methodName = lua_tostring(L, -2);
+
+			if (methodName[0] != '_' || methodName[1] != '_') {
+				LuaBindingCounter* counter = getCounter(className, methodName);
+
+				lua_pushvalue(L, -2);
+				lua_pushvalue(L, -2);
+				lua_pushlightuserdata(L, counter);
+				lua_pushcclosure(L, &profiledCall, 2);
+				lua_rawset(L, table);
+			}
+		}
+
+		lua_pop(L, 1);
+	}
+}
+
+uint64 LuaBindingProfiler::getCalls(const String& className, const String& methodName) {
+	Locker locker(&countersMutex);
+
+	int index = counters.find(className + ":" + methodName);
+
+	if (index == -1)
+		return 0;
+
+	return counters.elementAt(index).getValue()->calls.get();
+}
+
+void LuaBindingProfiler::reset() {
+	Locker locker(&countersMutex);
+
+	for (int i = 0; i < counters.size(); ++i)
+		counters.elementAt(i).getValue()->reset();
+}
+
+String LuaBindingProfiler::getSummary(int limit) {
+	Vector<LuaBindingCounter*> sorted;
+
+	Locker locker(&countersMutex);
+
+	for (int i = 0; i < counters.size(); ++i) {
+		LuaBindingCounter* counter = counters.elementAt(i).getValue();
+
+		if (counter->calls.get() > 0)
+			sorted.add(counter);
+	}
+
+	locker.release();
+
+	std::sort(sorted.begin(), sorted.end(), [](LuaBindingCounter* a, LuaBindingCounter* b) {
+		return a->totalTime.get() > b->totalTime.get();
+	});
+
+	StringBuffer buf;
+	buf << "Lua binding profiler " << (enabled ? "enabled" : "disabled") << ", " << counters.size() << " bindings" << endl;
+
+	for (int i = 0; i < sorted.size() && (limit <= 0 || i < limit); ++i) {
+		LuaBindingCounter* counter = sorted.get(i);
+
+		uint64 calls = counter->calls.get();
+
+		buf << counter->className << ":" << counter->methodName
+			<< " calls: " << calls
+			<< " total: " << counter->totalTime.get() / 1000 << "us"
+			<< " avg: " << counter->totalTime.get() / calls << "ns"
+			<< " max: " << counter->maxTime.get() / 1000 << "us" << endl;
+	}
+
+	return buf.toString();
+}
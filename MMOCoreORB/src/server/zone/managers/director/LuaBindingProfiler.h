@@ -0,0 +1,91 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef LUABINDINGPROFILER_H_
+#define LUABINDINGPROFILER_H_
+
+#include "engine/engine.h"
+
+class LuaBindingCounter {
+public:
+	const String className;
+	const String methodName;
+
+	AtomicLong calls;
+	AtomicLong totalTime;
+	AtomicLong maxTime;
+
+	LuaBindingCounter(const String& cls, const String& method) : className(cls), methodName(method) {
+	}
+
+	inline void record(uint64 time) {
+		calls.increment();
+		totalTime.add(time);
+
+		// racy by design, a lost update only affects a reporting value
+		if (time > (uint64) maxTime.get())
+			maxTime.set(time);
+	}
+
+	void reset() {
+		calls.set(0);
+		totalTime.set(0);
+		maxTime.set(0);
+	}
+};
+
+/**
+ * Call counts and run time per Luna binding. When enabled every method of a registered
+ * class is replaced in its metatable by a closure that times the original, counters are
+ * shared by all director lua states.
+ */
+class LuaBindingProfiler : public Singleton<LuaBindingProfiler>, public Logger, public Object {
+	VectorMap<String, LuaBindingCounter*> counters;
+	Mutex countersMutex;
+
+	bool enabled;
+
+	LuaBindingCounter* getCounter(const String& className, const String& methodName);
+
+	void instrumentTable(lua_State* L, int table, const char* className);
+
+	static int profiledCall(lua_State* L);
+
+public:
+	LuaBindingProfiler();
+	~LuaBindingProfiler();
+
+	void loadConfig();
+
+	/**
+	 * Wraps the methods Luna registered for className, call after Luna<T>::Register
+	 */
+	void instrument(lua_State* L, const char* className);
+
+	template<class T>
+	static void registerClass(lua_State* L) {
+		Luna<T>::Register(L);
+
+		LuaBindingProfiler::instance()->instrument(L, T::className);
+	}
+
+	void reset();
+
+	/**
+	 * Only affects lua states registered afterwards
+	 */
+	inline void setEnabled(bool val) {
+		enabled = val;
+	}
+
+	inline bool isEnabled() const {
+		return enabled;
+	}
+
+	uint64 getCalls(const String& className, const String& methodName);
+
+	String getSummary(int limit = 25);
+};
+
+#endif /* LUABINDINGPROFILER_H_ */
@@ -1,7 +1,10 @@
 #include "ScreenPlayTask.h"
 #include "server/zone/managers/director/DirectorManager.h"
+#include "server/zone/managers/statistics/TaskProfiler.h"
 
 void ScreenPlayTask::run() {
+	TaskProfiler::Scope profile(this, getNextExecutionTime().miliDifference(), profileName.toCharArray());
+
 	ZoneServer* zoneServer = ServerCore::getZoneServer();
 
 	if (zoneServer == nullptr || zoneServer->isServerShuttingDown())
@@ -16,8 +19,12 @@ void ScreenPlayTask::run() {
 	ManagedReference<SceneObject*> obj = this->obj.get();
 
 	if (obj != nullptr) {
+		profile.startLockWait();
+
 		Locker locker(obj);
 
+		profile.stopLockWait();
+
 		DirectorManager::instance()->activateEvent(this);
 	} else {
 		DirectorManager::instance()->activateEvent(this);
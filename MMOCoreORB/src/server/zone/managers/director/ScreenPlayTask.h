@@ -24,6 +24,7 @@ class ScreenPlayTask : public Task {
 	String taskKey;
 	String screenPlay;
 	String args;
+	String profileName;
 	Reference<PersistentEvent*> persistentEvent;
 public:
 
@@ -33,6 +34,9 @@ public:
 		screenPlay = playName;
 		args = arguments;
 		persistentEvent = nullptr;
+
+		// args are left out of the profile name to keep the number of distinct entries bounded
+		profileName = "ScreenPlayTask " + screenPlay + ":" + taskKey;
 	}
 
 	void run();
@@ -11,7 +11,8 @@
 
 Lua* LootGroupMap::lua = nullptr;
 int LootGroupMap::ERROR_CODE = NO_ERROR;
-String LootGroupMap::currentFilename = "";
+thread_local String LootGroupMap::currentFilename = "";
+thread_local LootGroupStaging* LootGroupMap::staging = nullptr;
 
 LootGroupMap::LootGroupMap() : Logger("LootGroupMap") {
 	lua = nullptr;
@@ -29,14 +30,33 @@ int LootGroupMap::initialize() {
 	if (lua != nullptr)
 		return ERROR_CODE;
 
-	lua = new Lua();
-	lua->init();
+	lua = createLuaState();
 
-	registerFunctions();
-	registerGlobals();
+	ParallelLuaLoader loader("loot templates");
+	loader.addIndexFile("serverobjects.lua");
+	loader.addIndexFile("items.lua");
+	loader.addIndexFile("groups.lua");
 
-	bool res = lua->runFile("scripts/loot/lootgroup.lua");
-	bool res2 = lua->runFile("scripts/loot/serverobjects.lua");
+	Vector<LootGroupStaging*> stagings;
+
+	bool res = loader.loadMain(lua, &runEntry);
+
+	for (int i = 0; i < loader.getStagingSlotCount(); ++i)
+		stagings.add(new LootGroupStaging());
+
+	bool res2 = loader.loadPartitions(&createLuaState, &runEntry, [&stagings](int slot) {
+		staging = slot >= 0 ? stagings.get(slot) : nullptr;
+	});
+
+	Time mergeStart;
+
+	for (int i = 0; i < loader.getPartitionCount(); ++i)
+		mergeStaging(stagings.get(i), loader.getPartition(i));
+
+	for (int i = 0; i < stagings.size(); ++i)
+		delete stagings.get(i);
+
+	loader.logBreakdown(mergeStart.miliDifference());
 
 	if (!res || !res2)
 		ERROR_CODE = GENERAL_ERROR;
@@ -44,24 +64,66 @@ int LootGroupMap::initialize() {
 	return ERROR_CODE;
 }
 
-void LootGroupMap::registerFunctions() {
-	lua->registerFunction("addLootGroupTemplate", addLootGroupTemplate);
-	lua->registerFunction("addLootItemTemplate", addLootItemTemplate);
-	lua->registerFunction("includeFile", includeFile);
+Lua* LootGroupMap::createLuaState() {
+	Lua* state = new Lua();
+	state->init();
+
+	registerFunctions(state);
+	registerGlobals(state);
+
+	return state;
 }
 
-void LootGroupMap::registerGlobals() {
+bool LootGroupMap::runEntry(Lua* state) {
+	bool res = state->runFile("scripts/loot/lootgroup.lua");
+	bool res2 = state->runFile("scripts/loot/serverobjects.lua");
+
+	return res && res2;
+}
+
+void LootGroupMap::mergeStaging(const LootGroupStaging* stage, const String& file) {
+	for (int i = 0; i < stage->items.size(); ++i) {
+		const String& name = stage->items.getKey(i);
+
+		if (itemTemplates.containsKey(name))
+			warning("overwriting loot item template " + name + " with " + file);
+
+		putLootItemTemplate(name, stage->items.getValue(i));
+	}
+
+	for (int i = 0; i < stage->groups.size(); ++i) {
+		const String& name = stage->groups.getKey(i);
+
+		if (groupTemplates.containsKey(name))
+			warning("overwriting loot group template " + name + " with " + file);
+
+		putLootGroupTemplate(name, stage->groups.getValue(i));
+	}
+}
+
+void LootGroupMap::registerFunctions(Lua* state) {
+	state->registerFunction("addLootGroupTemplate", addLootGroupTemplate);
+	state->registerFunction("addLootItemTemplate", addLootItemTemplate);
+	state->registerFunction("includeFile", includeFile);
+}
+
+void LootGroupMap::registerGlobals(Lua* state) {
 }
 
 int LootGroupMap::includeFile(lua_State* L) {
 	String filename = Lua::getStringParameter(L);
 
+	if (!ParallelLuaLoader::beginInclude(filename))
+		return 0;
+
 	String file = filename.subString(filename.lastIndexOf("/") + 1, filename.lastIndexOf("."));
 
 	currentFilename = file;
 
 	bool res = Lua::runFile("scripts/loot/" + filename, L);
 
+	ParallelLuaLoader::endInclude();
+
 	if (!res)
 		ERROR_CODE = GENERAL_ERROR;
 
@@ -76,7 +138,10 @@ int LootGroupMap::addLootGroupTemplate(lua_State* L) {
 	Reference<LootGroupTemplate*> group = new LootGroupTemplate(name);
 	group->readObject(&obj);
 
-	instance()->putLootGroupTemplate(name, group);
+	if (staging != nullptr)
+		staging->groups.put(name, name, group);
+	else
+		instance()->putLootGroupTemplate(name, group);
 
 	if (currentFilename != name)
 		instance()->warning("Loot group template name: " + name + " does not match file name: " + currentFilename);
@@ -92,7 +157,10 @@ int LootGroupMap::addLootItemTemplate(lua_State* L) {
 	Reference<LootItemTemplate*> item = new LootItemTemplate(name);
 	item->readObject(&obj);
 
-	instance()->putLootItemTemplate(name, item);
+	if (staging != nullptr)
+		staging->items.put(name, name, item);
+	else
+		instance()->putLootItemTemplate(name, item);
 
 	if (currentFilename != name)
 		instance()->warning("Loot item template name: " + name + " does not match file name: " + currentFilename);
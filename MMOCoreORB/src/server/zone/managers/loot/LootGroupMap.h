@@ -16,6 +16,14 @@ class LootItemTemplate;
 #include "engine/util/Singleton.h"
 #include "engine/lua/Lua.h"
 
+#include "server/zone/managers/creature/ParallelLuaLoader.h"
+
+class LootGroupStaging {
+public:
+	LuaStagedPuts<String, Reference<LootItemTemplate*> > items;
+	LuaStagedPuts<String, Reference<LootGroupTemplate*> > groups;
+};
+
 class LootGroupMap : public Singleton<LootGroupMap>, public Object, public Logger {
 public:
 	static Lua* lua;
@@ -65,10 +73,18 @@ public:
 	}
 
 private:
-	static String currentFilename;
+	static thread_local String currentFilename;
+
+	// set on the worker states of a parallel load, the callbacks put into it instead of the tables
+	static thread_local LootGroupStaging* staging;
+
+	static Lua* createLuaState();
+	static bool runEntry(Lua* state);
+
+	static void registerFunctions(Lua* state);
+	static void registerGlobals(Lua* state);
 
-	void registerFunctions();
-	void registerGlobals();
+	void mergeStaging(const LootGroupStaging* stage, const String& file);
 
 	static int includeFile(lua_State* L);
 
@@ -766,27 +766,16 @@ bool LootManagerImplementation::createLootFromCollection(TransactionLog& trx, Sc
 		if (roll > lootChance)
 			continue;
 
-		int tempChance = 0; //Start at 0.
-
 		const LootGroups* lootGroups = entry->getLootGroups();
 
 		//Now we do the second roll to determine loot group.
 		roll = System::random(10000000);
 
 		//Select the loot group to use.
-		for (int i = 0; i < lootGroups->count(); ++i) {
-			const LootGroupEntry* entry = lootGroups->get(i);
-
-			tempChance += entry->getLootChance();
-
-			//Is this entry lower than the roll? If yes, then we want to try the next entry.
-			if (tempChance < roll)
-				continue;
-
-			createLoot(trx, container, entry->getLootGroupName(), level);
+		const LootGroupEntry* groupEntry = lootGroups->getEntryForRoll(roll);
 
-			break;
-		}
+		if (groupEntry != nullptr)
+			createLoot(trx, container, groupEntry->getLootGroupName(), level);
 	}
 
 	return true;
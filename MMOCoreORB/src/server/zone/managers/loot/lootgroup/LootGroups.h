@@ -9,10 +9,22 @@
 #define LOOTGROUPS_H_
 
 #include "LootGroupEntry.h"
+#include "server/utils/WeightedSampler.h"
 
 class LootGroups {
 	SortedVector<LootGroupEntry> entries;
 
+	WeightedSampler sampler;
+
+	void buildSampler() {
+		Vector<int> weights(entries.size(), 1);
+
+		for (int i = 0; i < entries.size(); ++i)
+			weights.add(entries.getUnsafe(i).getLootChance());
+
+		sampler.build(weights);
+	}
+
 public:
 	LootGroups() {
 	}
@@ -31,14 +43,30 @@ public:
 			LootGroupEntry entry;
 			entry.readObject(&luagroup);
 
-			put(entry);
+			entries.put(entry);
 
 			luagroup.pop();
 		}
+
+		buildSampler();
 	}
 
 	void put(const LootGroupEntry& entry) {
 		entries.put(entry);
+
+		buildSampler();
+	}
+
+	/**
+	 * First group whose running chance reaches roll, nullptr when the chances add up to less than roll
+	 */
+	const LootGroupEntry* getEntryForRoll(int roll) const {
+		int index = sampler.findAtLeast(roll);
+
+		if (index == -1)
+			return nullptr;
+
+		return &entries.get(index);
 	}
 
 	int count() const {
@@ -1791,8 +1791,6 @@ LairSpawn* MissionManagerImplementation::getRandomLairSpawn(CreatureObject* play
 		return nullptr;
 	}
 
-	bool foundLair = false;
-	int counter = availableLairList->size();
 	int playerLevel = server->getPlayerManager()->calculatePlayerLevel(player);
 	if (player->isGrouped())
 		playerLevel = player->getGroup()->getGroupLevel();
@@ -1802,50 +1800,31 @@ LairSpawn* MissionManagerImplementation::getRandomLairSpawn(CreatureObject* play
 	//Cap the minLevel to prevent a group from being too high to get missions on a planet
 	int minLevel = Math::min(playerLevel - 5, minLevelCeiling);
 
-	//Try to pick random lair within playerLevel +-5;
-	while (counter > 0 && !foundLair) {
-		LairSpawn* randomLairSpawn = availableLairList->get(System::random(availableLairList->size() - 1));
-		if (randomLairSpawn != nullptr) {
-			if (randomLairSpawn->getMinDifficulty() <= (playerLevel + 5) && randomLairSpawn->getMaxDifficulty() >= minLevel) {
-				if (type == MissionTypes::DESTROY) {
-					lairSpawn = randomLairSpawn;
-					foundLair = true;
-				} else {
-					LairTemplate* lairTemp = CreatureTemplateManager::instance()->getLairTemplate(randomLairSpawn->getLairTemplateName().hashCode());
+	//Pick a random lair within playerLevel +-5, every eligible lair is equally likely.
+	//One pass over the list replaces the old draw and retry loop.
+	Vector<LairSpawn*> eligibleLairs(availableLairList->size(), 1);
 
-					if (lairTemp->getMobType() == LairTemplate::CREATURE) {
-						lairSpawn = randomLairSpawn;
-						foundLair = true;
-					}
-				}
-			}
-		}
+	for (int i = 0; i < availableLairList->size(); i++) {
+		LairSpawn* randomLairSpawn = availableLairList->getUnsafe(i);
 
-		--counter;
-	}
+		if (randomLairSpawn == nullptr || randomLairSpawn->getMinDifficulty() > (playerLevel + 5) || randomLairSpawn->getMaxDifficulty() < minLevel)
+			continue;
 
-	if (!foundLair) {
-		//No random lair found, iterate through all lairs and find the first within playerLevel +-5;
-		for (int i = 0; i < availableLairList->size(); i++) {
-			LairSpawn* randomLairSpawn = availableLairList->get(i);
-			if (randomLairSpawn->getMinDifficulty() <= (playerLevel + 5) && randomLairSpawn->getMaxDifficulty() >= minLevel) {
-				if (type == MissionTypes::DESTROY) {
-					lairSpawn = randomLairSpawn;
-					foundLair = true;
-					break;
-				} else {
-					LairTemplate* lairTemp = CreatureTemplateManager::instance()->getLairTemplate(randomLairSpawn->getLairTemplateName().hashCode());
+		if (type != MissionTypes::DESTROY) {
+			LairTemplate* lairTemp = CreatureTemplateManager::instance()->getLairTemplate(randomLairSpawn->getLairTemplateName().hashCode());
 
-					if (lairTemp->getMobType() == LairTemplate::CREATURE) {
-						lairSpawn = randomLairSpawn;
-						foundLair = true;
-						break;
-					}
-				}
-			}
+			if (lairTemp == nullptr || lairTemp->getMobType() != LairTemplate::CREATURE)
+				continue;
 		}
+
+		eligibleLairs.add(randomLairSpawn);
 	}
 
+	bool foundLair = eligibleLairs.size() > 0;
+
+	if (foundLair)
+		lairSpawn = eligibleLairs.getUnsafe(System::random(eligibleLairs.size() - 1));
+
 	if (!foundLair) {
 		//There are no lairs within playerLevel +-5, pick the first lair below playerLevel +5
 		for (int i = 0; i < availableLairList->size(); i++) {
@@ -192,7 +192,20 @@ void NameManager::loadConfigData(bool reload) {
 		}
 	}
 
-	info("Loaded " + String::valueOf(reservedNames.size()) + " reserved name patterns.", true);
+	Reference<ReservedNameMatcher*> matcher = new ReservedNameMatcher();
+
+	for (int i = 0; i < reservedNames.size(); ++i) {
+		const auto& entry = reservedNames.elementAt(i);
+
+		matcher->add(entry.getKey(), entry.getValue());
+	}
+
+	matcher->compile();
+
+	reservedNameMatcher = matcher;
+
+	info("Loaded " + String::valueOf(reservedNames.size()) + " reserved name patterns, " + String::valueOf(matcher->getLiteralCount())
+			+ " literals in " + String::valueOf(matcher->getStateCount()) + " automaton states.", true);
 
 	luaObject.pop();
 
@@ -217,21 +230,66 @@ bool NameManager::isReserved(const String& name) const {
 }
 
 int NameManager::validateReservedNames(const String& name, int resultType) const {
-	for (int i = 0; i < reservedNames.size(); i++) {
-		VectorMapEntry<String, int> entry = reservedNames.elementAt(i);
+	Reference<ReservedNameMatcher*> matcher = reservedNameMatcher;
 
-		std::regex regexCheck(entry.getKey().toCharArray());
-		int reservedReason = entry.getValue();
+	if (matcher == nullptr)
+		return NameManagerResult::ACCEPTED;
 
-		if (resultType > 0 && resultType != reservedReason)
-			continue;
+	return matcher->match(name, resultType, NameManagerResult::ACCEPTED);
+}
+
+String NameManager::benchmarkReservedNames(int iterations) const {
+	Vector<String> names;
+
+	// every reserved pattern embedded in a name plus a few clean names
+	for (int i = 0; i < reservedNames.size(); ++i)
+		names.add("xx" + reservedNames.elementAt(i).getKey() + "yy");
+
+	names.add("Lorrin");
+	names.add("Tavik Sorn");
+	names.add("Qel");
+
+	int mismatches = 0;
+	Time start;
+
+	for (int n = 0; n < iterations; ++n) {
+		const String& name = names.get(n % names.size());
+
+		int result = NameManagerResult::ACCEPTED;
 
-		if (std::regex_search(name.toCharArray(), regexCheck)) {
-			//error("Name " + name + " failed check against regex " + entry.getKey() + " , reason: " + reservedReason);
-			return reservedReason;
+		for (int i = 0; i < reservedNames.size(); i++) {
+			const VectorMapEntry<String, int>& entry = reservedNames.elementAt(i);
+
+			std::regex regexCheck(entry.getKey().toCharArray());
+
+			if (std::regex_search(name.toCharArray(), regexCheck)) {
+				result = entry.getValue();
+				break;
+			}
 		}
+
+		if (result != validateReservedNames(name))
+			++mismatches;
 	}
-	return NameManagerResult::ACCEPTED;
+
+	uint64 combined = start.miliDifference();
+
+	start.updateToCurrentTime();
+
+	int rejected = 0;
+
+	for (int n = 0; n < iterations; ++n) {
+		if (validateReservedNames(names.get(n % names.size())) != NameManagerResult::ACCEPTED)
+			++rejected;
+	}
+
+	uint64 compiled = start.miliDifference();
+
+	StringBuffer buf;
+	buf << iterations << " names against " << reservedNames.size() << " patterns: regex per call (plus compiled check) "
+		<< combined << "ms, compiled " << compiled << "ms, rejected " << rejected << ", mismatches " << mismatches;
+
+	return buf.toString();
 }
 
 int NameManager::validateName(const CreatureObject* obj) const {
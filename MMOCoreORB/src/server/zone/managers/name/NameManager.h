@@ -7,6 +7,7 @@
 
 #include "engine/core/ManagedReference.h"
 #include "server/zone/managers/name/NameData.h"
+#include "server/zone/managers/name/ReservedNameMatcher.h"
 
 namespace server {
 	namespace zone {
@@ -102,6 +103,7 @@ class NameManager : public Singleton<NameManager>, public Logger, public Object
 	NameData* reactiveGasResourceData;
 
 	VectorMap<String, int> reservedNames;
+	Reference<ReservedNameMatcher*> reservedNameMatcher;
 
 	Vector<String> stormtrooperPrefixes;
 	Vector<String> scouttrooperPrefixes;
@@ -143,6 +145,11 @@ public:
 	int validateChatRoomName(const String& name) const;
 	int validateReservedNames(const String& name, int resultType = -1) const;
 
+	/**
+	 * Times the compiled matcher against building a std::regex per pattern per call
+	 */
+	String benchmarkReservedNames(int iterations) const;
+
 	const String makeCreatureName(int type = 1, int species = 0) const;
 
 	String generateSingleName(const NameData* nameData, const NameRules* rules) const;
@@ -0,0 +1,169 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "ReservedNameMatcher.h"
+
+ReservedNameMatcher::ReservedNameMatcher() : classCount(1) {
+	memset(characterClass, 0, sizeof(characterClass));
+}
+
+bool ReservedNameMatcher::isLiteral(const String& pattern) {
+	for (int i = 0; i < pattern.length(); ++i) {
+		switch (pattern.charAt(i)) {
+		case '\\': case '^': case '$': case '.': case '|': case '?':
+		case '*': case '+': case '(': case ')': case '[': case ']':
+		case '{': case '}':
+			return false;
+		}
+	}
+
+	return pattern.length() > 0;
+}
+
+void ReservedNameMatcher::add(const String& pattern, int reason) {
+	patterns.add(pattern);
+	reasons.add(reason);
+}
+
+int ReservedNameMatcher::addState() {
+	states.add(State());
+
+	for (int i = 0; i < classCount; ++i)
+		transitions.add(-1);
+
+	return states.size() - 1;
+}
+
+void ReservedNameMatcher::compile() {
+	// only characters used by some literal get their own column, the rest share class 0
+	for (int i = 0; i < patterns.size(); ++i) {
+		const String& pattern = patterns.get(i);
+
+		if (!isLiteral(pattern))
+			continue;
+
+		for (int j = 0; j < pattern.length(); ++j) {
+			uint8 c = (uint8) pattern.charAt(j);
+
+			if (characterClass[c] == 0)
+				characterClass[c] = classCount++;
+		}
+	}
+
+	addState();
+
+	for (int i = 0; i < patterns.size(); ++i) {
+		const String& pattern = patterns.get(i);
+
+		if (!isLiteral(pattern)) {
+			regexes.emplace_back(pattern.toCharArray());
+			regexPatterns.add(i);
+
+			continue;
+		}
+
+		int state = 0;
+
+		for (int j = 0; j < pattern.length(); ++j) {
+			int column = state * classCount + characterClass[(uint8) pattern.charAt(j)];
+			int next = transitions.get(column);
+
+			if (next == -1) {
+				next = addState();
+				transitions.set(column, next);
+			}
+
+			state = next;
+		}
+
+		int reason = reasons.get(i);
+		State& end = states.get(state);
+
+		end.best[0] = better(end.best[0], i);
+
+		if (reason > 0 && reason < REASON_SLOTS)
+			end.best[reason] = better(end.best[reason], i);
+	}
+
+	// breadth first so every failure target is complete before its dependents
+	Vector<int> queue(states.size(), 1);
+
+	for (int c = 0; c < classCount; ++c) {
+		int next = transitions.get(c);
+
+		if (next == -1) {
+			transitions.set(c, 0);
+		} else {
+			states.get(next).fail = 0;
+			queue.add(next);
+		}
+	}
+
+	for (int head = 0; head < queue.size(); ++head) {
+		int state = queue.get(head);
+		State& current = states.get(state);
+		const State& fail = states.get(current.fail);
+
+		for (int slot = 0; slot < REASON_SLOTS; ++slot)
+			current.best[slot] = better(current.best[slot], fail.best[slot]);
+
+		for (int c = 0; c < classCount; ++c) {
+			int column = state * classCount + c;
+			int next = transitions.get(column);
+			int failNext = transitions.get(current.fail * classCount + c);
+
+			if (next == -1) {
+				transitions.set(column, failNext);
+			} else {
+				states.get(next).fail = failNext;
+				queue.add(next);
+			}
+		}
+	}
+}
+
+int ReservedNameMatcher::match(const String& name, int resultType, int acceptedResult) const {
+	int first = -1;
+
+	if (resultType < REASON_SLOTS) {
+		int slot = resultType > 0 ? resultType : 0;
+		int state = 0;
+
+		for (int i = 0; i < name.length(); ++i) {
+			state = transitions.getUnsafe(state * classCount + characterClass[(uint8) name.charAt(i)]);
+
+			first = better(first, states.getUnsafe(state).best[slot]);
+		}
+	} else {
+		// reason codes without a slot are rare enough for a plain scan
+		for (int i = 0; i < patterns.size(); ++i) {
+			const String& pattern = patterns.getUnsafe(i);
+
+			if (reasons.getUnsafe(i) == resultType && isLiteral(pattern) && name.indexOf(pattern) != -1) {
+				first = i;
+				break;
+			}
+		}
+	}
+
+	for (int i = 0; i < regexPatterns.size(); ++i) {
+		int index = regexPatterns.getUnsafe(i);
+
+		if (first != -1 && index > first)
+			break;
+
+		if (resultType > 0 && resultType != reasons.getUnsafe(index))
+			continue;
+
+		if (std::regex_search(name.toCharArray(), regexes[i])) {
+			first = index;
+			break;
+		}
+	}
+
+	if (first == -1)
+		return acceptedResult;
+
+	return reasons.get(first);
+}
@@ -0,0 +1,102 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef RESERVEDNAMEMATCHER_H_
+#define RESERVEDNAMEMATCHER_H_
+
+#include "engine/engine.h"
+
+#include <regex>
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace name {
+
+/**
+ * All reserved name patterns compiled once. Plain substrings go into a single
+ * Aho-Corasick automaton, patterns using regex syntax are compiled to std::regex
+ * up front. match() reports the reason of the first pattern (in the order they
+ * were added) that matches, which is what the per call regex loop used to return.
+ */
+class ReservedNameMatcher : public Object {
+public:
+	// reasons are NameManagerResult codes, slot 0 holds the best match of any reason
+	static const int REASON_SLOTS = 8;
+
+protected:
+	class State {
+	public:
+		int fail;
+		int best[REASON_SLOTS];
+
+		State() : fail(0) {
+			for (int i = 0; i < REASON_SLOTS; ++i)
+				best[i] = -1;
+		}
+	};
+
+	Vector<String> patterns;
+	Vector<int> reasons;
+
+	uint8 characterClass[256];
+	int classCount;
+
+	Vector<State> states;
+	Vector<int> transitions;
+
+	std::vector<std::regex> regexes;
+	Vector<int> regexPatterns;
+
+	static bool isLiteral(const String& pattern);
+
+	int addState();
+
+	static int better(int current, int candidate) {
+		if (candidate == -1)
+			return current;
+
+		return (current == -1 || candidate < current) ? candidate : current;
+	}
+
+public:
+	ReservedNameMatcher();
+
+	/**
+	 * Patterns are checked in the order they are added
+	 */
+	void add(const String& pattern, int reason);
+
+	/**
+	 * Builds the automaton, must be called once after the last add()
+	 */
+	void compile();
+
+	/**
+	 * Returns the reason of the first matching pattern, or acceptedResult when
+	 * nothing matches. A resultType above 0 restricts the check to that reason.
+	 */
+	int match(const String& name, int resultType, int acceptedResult) const;
+
+	int size() const {
+		return patterns.size();
+	}
+
+	int getLiteralCount() const {
+		return patterns.size() - regexPatterns.size();
+	}
+
+	int getStateCount() const {
+		return states.size();
+	}
+};
+
+}
+}
+}
+}
+
+using namespace server::zone::managers::name;
+
+#endif /* RESERVEDNAMEMATCHER_H_ */
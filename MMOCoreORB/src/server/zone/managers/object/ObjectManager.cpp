@@ -64,6 +64,7 @@ ObjectManager::ObjectManager(bool initializeTemplates) : DOBObjectManager() {
 	databaseManager->loadObjectDatabase("resourcespawns", true);
 	databaseManager->loadObjectDatabase("playerbounties", true);
 	databaseManager->loadObjectDatabase("mail", true);
+	databaseManager->loadObjectDatabase("mailexpiry", true);
 	databaseManager->loadObjectDatabase("chatrooms", true);
 
 	ObjectDatabaseManager::instance()->commitLocalTransaction();
@@ -993,36 +994,86 @@ void ObjectManager::onUpdateModifiedObjectsToDatabase() {
 void ObjectManager::onCommitData() {
 	if (charactersSaved != nullptr) {
 		try {
-			StringBuffer query;
-			query << "REPLACE INTO characters (character_oid, account_id, galaxy_id, firstname, surname, race, gender, template) VALUES";
+			struct DirtyCharacter {
+				uint64 characterID;
+				int accountID;
+				int galaxyID;
+				String firstName;
+				String surName;
+				int race;
+				int gender;
+				String templateName;
+			};
+
+			// read first, so every batch binds exactly the rows its statement has
+			Vector<DirtyCharacter> characters;
 
-			StringBuffer deleteQuery;
-			deleteQuery << "DELETE FROM characters_dirty WHERE ";
+			while (charactersSaved->next()) {
+				DirtyCharacter character;
+				character.characterID = charactersSaved->getUnsignedLong(0);
+				character.accountID = charactersSaved->getInt(1);
+				character.galaxyID = charactersSaved->getInt(2);
+				character.firstName = charactersSaved->getString(3);
+				character.surName = charactersSaved->getString(4);
+				character.race = charactersSaved->getInt(5);
+				character.gender = charactersSaved->getInt(6);
+				character.templateName = charactersSaved->getString(7);
+
+				characters.add(character);
+			}
 
-			bool first = true;
+			// batches of prepared rows in a few fixed sizes, the connection keeps one prepared statement per size
+			const static int maxRows = ConfigManager::instance()->getInt("Core3.DBWriteBehind.MaxRows", 500);
+			const int batchSizes[] = { maxRows, 100, 10, 1 };
 
-			int count = 0;
+			int next = 0;
 
-			while (charactersSaved->next()) {
-				if (!first) {
-					query << ",";
-					deleteQuery << " OR ";
+			while (next < characters.size()) {
+				int remaining = characters.size() - next;
+				int rows = 1;
+
+				for (int size : batchSizes) {
+					if (size > 0 && size <= remaining) {
+						rows = size;
+						break;
+					}
 				}
 
-				query << "(" << charactersSaved->getUnsignedLong(0) << ", " << charactersSaved->getInt(1) << ", "
-						<< charactersSaved->getInt(2) << ", " << "\'" << String(charactersSaved->getString(3)).escapeString() << "\', "
-						<< "\'" << String(charactersSaved->getString(4)).escapeString() << "\', " << charactersSaved->getInt(5) << ", "
-						<< charactersSaved->getInt(6) << ", \'" << String(charactersSaved->getString(7)).escapeString() << "')";
+				StringBuffer replaceQuery;
+				StringBuffer deleteQuery;
 
-				deleteQuery << "character_oid = " << charactersSaved->getUnsignedLong(0) << " AND galaxy_id = " << galaxyId;
+				replaceQuery << "REPLACE INTO characters (character_oid, account_id, galaxy_id, firstname, surname, race, gender, template) VALUES ";
+				deleteQuery << "DELETE FROM characters_dirty WHERE galaxy_id = ? AND character_oid IN (";
 
-				first = false;
-				++count;
-			}
+				for (int i = 0; i < rows; ++i) {
+					replaceQuery << (i > 0 ? ", " : "") << "(?, ?, ?, ?, ?, ?, ?, ?)";
+					deleteQuery << (i > 0 ? ", " : "") << "?";
+				}
+
+				deleteQuery << ")";
+
+				server::db::mysql::PreparedStatement replaceStatement(replaceQuery.toString());
+				server::db::mysql::PreparedStatement deleteStatement(deleteQuery.toString());
+
+				deleteStatement.bindInt(galaxyId);
+
+				for (int i = 0; i < rows; ++i) {
+					const DirtyCharacter& character = characters.get(next++);
+
+					replaceStatement.bindUnsigned(character.characterID)
+						.bindInt(character.accountID)
+						.bindInt(character.galaxyID)
+						.bindString(character.firstName)
+						.bindString(character.surName)
+						.bindInt(character.race)
+						.bindInt(character.gender)
+						.bindString(character.templateName);
+
+					deleteStatement.bindUnsigned(character.characterID);
+				}
 
-			if (count > 0) {
-				ServerDatabase::instance()->executeStatement(query.toString());
-				ServerDatabase::instance()->executeStatement(deleteQuery.toString());
+				ServerDatabase::executePrepared(replaceStatement);
+				ServerDatabase::executePrepared(deleteStatement);
 			}
 		} catch (Exception& e) {
 			System::out << e.getMessage();
@@ -135,14 +135,22 @@ public:
 	bool loadSlashCommandsFile() {
 		info("Loading commands...");
 
+		Time start;
+
 		loadCommandData("datatables/command/command_tables_shared.iff");
 		loadCommandData("datatables/command/command_tables_shared_ground.iff");
 		//loadCommandData("datatables/command/command_tables_shared_space.iff"); disabled cause taunt is conflicting
+
+		uint64 tableTime = start.miliDifference();
+
 		bool res = runFile("scripts/commands/commands.lua");
 
 		if (!res)
 			ERROR_CODE = GENERAL_ERROR;
 
+		info(true) << "commands loaded in " << start.miliDifference() << "ms: datatables " << tableTime
+			<< "ms, scripts " << start.miliDifference() - tableTime << "ms";
+
 		return res;
 	}
 
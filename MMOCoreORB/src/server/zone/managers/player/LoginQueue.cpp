@@ -0,0 +1,204 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "LoginQueue.h"
+
+#include "conf/ConfigManager.h"
+#include "server/login/packets/ErrorMessage.h"
+
+const char* LoginQueue::AUTH_QUEUE = "LoginAuth";
+const char* LoginQueue::PREFETCH_QUEUE = "LoginPrefetch";
+
+LoginQueue::LoginQueue() : Logger("LoginQueue") {
+	insertsPerSecond = 0;
+	notifyInterval = 30000;
+	tokens = 0;
+}
+
+void LoginQueue::initialize() {
+	auto config = ConfigManager::instance();
+
+	int authThreads = Math::max(1, config->getInt("Core3.LoginPipeline.AuthThreads", 2));
+	int prefetchThreads = Math::max(1, config->getInt("Core3.LoginPipeline.PrefetchThreads", 4));
+
+	insertsPerSecond = config->getInt("Core3.LoginPipeline.InsertsPerSecond", 20);
+	notifyInterval = Math::max(1000, config->getInt("Core3.LoginPipeline.PositionUpdateInterval", 30000));
+
+	Core::getTaskManager()->initializeCustomQueue(AUTH_QUEUE, authThreads, false);
+	Core::getTaskManager()->initializeCustomQueue(PREFETCH_QUEUE, prefetchThreads, false);
+
+	tokens = Math::max(1, insertsPerSecond);
+	lastRefill.updateToCurrentTime();
+
+	info(true) << "auth threads: " << authThreads << " prefetch threads: " << prefetchThreads
+		<< " zone inserts/s: " << (insertsPerSecond > 0 ? String::valueOf(insertsPerSecond) : String("unlimited"));
+}
+
+void LoginQueue::refillTokens() {
+	uint64 elapsed = lastRefill.miliDifference();
+
+	lastRefill.updateToCurrentTime();
+
+	// at most one second worth of burst
+	tokens = Math::min((float) insertsPerSecond, tokens + insertsPerSecond * elapsed / 1000.f);
+}
+
+void LoginQueue::schedulePump() {
+	if (pumpTask == nullptr) {
+		pumpTask = new LambdaTask([this] () {
+			pump();
+		}, "LoginQueuePump");
+	}
+
+	if (!pumpTask->isScheduled())
+		pumpTask->schedule(100);
+}
+
+void LoginQueue::notifyPosition(Entry* entry, int position) {
+	StringBuffer msg;
+	msg << "The server is busy, you are number " << position << " in the login queue.";
+
+	if (insertsPerSecond > 0)
+		msg << "\n\nEstimated wait: " << position / insertsPerSecond + 1 << " seconds.";
+
+	entry->client->sendMessage(new ErrorMessage("Login Queue", msg.toString(), 0));
+	entry->lastNotified.updateToCurrentTime();
+}
+
+void LoginQueue::enqueue(ZoneClientSession* client, Task* admission, bool priority) {
+	Locker locker(&mutex);
+
+	if (insertsPerSecond <= 0) {
+		locker.release();
+
+		admitted.increment();
+		admission->execute();
+
+		return;
+	}
+
+	refillTokens();
+
+	// a client selecting again replaces its previous place in line
+	int position = -1;
+
+	for (int i = 0; i < pending.size(); ++i) {
+		if (pending.getUnsafe(i)->client == client) {
+			position = i;
+			pending.remove(i);
+			break;
+		}
+	}
+
+	if ((priority || pending.size() == 0) && tokens >= 1.f) {
+		tokens -= 1.f;
+
+		locker.release();
+
+		admitted.increment();
+		admission->execute();
+
+		return;
+	}
+
+	Reference<Entry*> entry = new Entry();
+	entry->client = client;
+	entry->admission = admission;
+
+	if (priority) {
+		pending.add(0, entry);
+	} else if (position != -1) {
+		pending.add(position, entry);
+	} else {
+		pending.add(entry);
+	}
+
+	if (pending.size() > maxQueueSize.get())
+		maxQueueSize.set(pending.size());
+
+	if (!priority)
+		notifyPosition(entry, pending.size());
+
+	schedulePump();
+}
+
+void LoginQueue::pump() {
+	Vector<Reference<Entry*> > ready;
+
+	Locker locker(&mutex);
+
+	refillTokens();
+
+	while (pending.size() > 0 && tokens >= 1.f) {
+		Reference<Entry*> entry = pending.remove(0);
+
+		if (entry->client == nullptr || entry->client->isDisconnecting()) {
+			dropped.increment();
+			continue;
+		}
+
+		tokens -= 1.f;
+		ready.add(entry);
+	}
+
+	for (int i = 0; i < pending.size(); ++i) {
+		Entry* entry = pending.getUnsafe(i);
+
+		if (entry->lastNotified.miliDifference() >= notifyInterval)
+			notifyPosition(entry, i + 1);
+	}
+
+	if (pending.size() > 0)
+		schedulePump();
+	else if (ready.size() > 0)
+		lastEmpty.updateToCurrentTime();
+
+	locker.release();
+
+	for (int i = 0; i < ready.size(); ++i) {
+		Entry* entry = ready.getUnsafe(i);
+		uint64 waited = entry->queuedTime.miliDifference();
+
+		totalWaitTime.add(waited);
+
+		if (waited > (uint64) maxWaitTime.get())
+			maxWaitTime.set(waited);
+
+		admitted.increment();
+
+		entry->admission->execute();
+	}
+}
+
+int LoginQueue::getQueueSize() {
+	Locker locker(&mutex);
+
+	return pending.size();
+}
+
+String LoginQueue::getInfo() {
+	Locker locker(&mutex);
+
+	int queued = pending.size();
+	uint64 oldest = queued > 0 ? pending.getUnsafe(0)->queuedTime.miliDifference() : 0;
+
+	locker.release();
+
+	uint64 count = admitted.get();
+
+	StringBuffer buf;
+	buf << "queued: " << queued
+		<< " oldest: " << oldest << "ms"
+		<< " admitted: " << count
+		<< " dropped: " << dropped.get()
+		<< " avg wait: " << (count > 0 ? totalWaitTime.get() / count : 0) << "ms"
+		<< " max wait: " << maxWaitTime.get() << "ms"
+		<< " max queued: " << maxQueueSize.get()
+		<< " inserts/s: " << insertsPerSecond;
+
+	if (queued == 0 && count > 0)
+		buf << " drained " << lastEmpty.miliDifference() / 1000 << "s ago";
+
+	return buf.toString();
+}
@@ -0,0 +1,90 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef LOGINQUEUE_H_
+#define LOGINQUEUE_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/ZoneClientSession.h"
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace player {
+
+/**
+ * Zone login pipeline. Session validation runs on the LoginAuth queue,
+ * character graphs load on the LoginPrefetch queue and zone insertion is
+ * admitted from here at a bounded rate, so a login storm after a restart
+ * neither starves the zone queues nor inserts thousands of players at once.
+ * Waiting clients are told their position in the queue.
+ */
+class LoginQueue : public Singleton<LoginQueue>, public Logger, public Object {
+public:
+	static const char* AUTH_QUEUE;
+	static const char* PREFETCH_QUEUE;
+
+protected:
+	class Entry : public Object {
+	public:
+		ManagedReference<ZoneClientSession*> client;
+		Reference<Task*> admission;
+		Time queuedTime;
+		Time lastNotified;
+	};
+
+	Mutex mutex;
+	Vector<Reference<Entry*> > pending;
+
+	int insertsPerSecond;
+	int notifyInterval;
+	float tokens;
+	Time lastRefill;
+
+	Reference<Task*> pumpTask;
+
+	AtomicLong admitted;
+	AtomicLong dropped;
+	AtomicLong totalWaitTime;
+	AtomicLong maxWaitTime;
+	AtomicInteger maxQueueSize;
+
+	Time lastEmpty;
+
+	void refillTokens();
+	void schedulePump();
+	void notifyPosition(Entry* entry, int position);
+
+public:
+	LoginQueue();
+
+	/**
+	 * Reads Core3.LoginPipeline and creates the stage queues, before the zone accepts connections
+	 */
+	void initialize();
+
+	/**
+	 * Runs admission once a slot is free. Admin characters skip the queue.
+	 */
+	void enqueue(ZoneClientSession* client, Task* admission, bool priority);
+
+	/**
+	 * Admits as many queued logins as the rate allows, called by the pump task
+	 */
+	void pump();
+
+	int getQueueSize();
+
+	String getInfo();
+};
+
+}
+}
+}
+}
+
+using namespace server::zone::managers::player;
+
+#endif /* LOGINQUEUE_H_ */
@@ -700,27 +700,6 @@ String PlayerManagerImplementation::getPlayerName(uint64 oid) {
 	return nameMap->get(oid);
 }
 
-bool PlayerManagerImplementation::checkExistentNameInDatabase(const String& name) {
-	if (name.isEmpty())
-		return false;
-
-	try {
-		String fname = name.toLowerCase();
-		Database::escapeString(fname);
-		String query = "SELECT * FROM characters WHERE lower(firstname) = \""
-				+ fname + "\"";
-
-		UniqueReference<ResultSet*> res(ServerDatabase::instance()->executeQuery(query));
-		bool nameExists = res->next();
-
-		return !nameExists;
-	} catch (DatabaseException& e) {
-		return false;
-	}
-
-	return false;
-}
-
 bool PlayerManagerImplementation::checkPlayerName(ClientCreateCharacterCallback* callback) {
 	auto client = callback->getClient();
 
@@ -5424,145 +5403,257 @@ void PlayerManagerImplementation::rescheduleCorpseDestruction(CreatureObject* pl
 }
 
 
-void PlayerManagerImplementation::getCleanupCharacterCount() {
-	info("**** GETTING CHARACTER CLEANUP INFORMATION ***",true);
+int PlayerManagerImplementation::findCleanupCharacters(SortedVector<uint64>* characters) {
+	ZoneServer* server = ServerCore::getZoneServer();
+
+	if (server == nullptr) {
+		error("nullptr ZoneServer in character cleanup");
+		return -1;
+	}
+
+	int galaxyID = server->getGalaxyID();
+
+	// One query for the characters of the galaxy instead of one per creature in the object database
+	HashSet<uint64> validCharacters;
+
+	server::db::mysql::PreparedStatement query("SELECT character_oid FROM characters WHERE galaxy_id = ?");
+	query.bindInt(galaxyID);
+
+	try {
+		UniqueReference<ResultSet*> result(ServerDatabase::executeQuery(query));
+
+		if (result == nullptr) {
+			error("ERROR WHILE LOADING CHARACTERS FROM SQL TABLE");
+			return -1;
+		}
+
+		while (result->next()) {
+			validCharacters.add(result->getUnsignedLong(0));
+		}
+	} catch (const DatabaseException& err) {
+		error() << "database error " << err.getMessage();
+		return -1;
+	}
+
+	if (validCharacters.size() == 0) {
+		error() << "no characters in the SQL table for galaxy " << galaxyID << ", refusing to clean up every character";
+		return -1;
+	}
 
 	ObjectDatabase* thisDatabase = ObjectDatabaseManager::instance()->loadObjectDatabase("sceneobjects", true, 0xFFFF, false);
 
 	if (thisDatabase == nullptr)
-		return;
+		return -1;
 
-	ObjectInputStream objectData(2000);
-	ObjectDatabaseIterator iterator(thisDatabase);
+	auto taskManager = Core::getTaskManager();
 
-	uint64 objectID;
+	const static int objectsPerTask = ConfigManager::instance()->getInt("Core3.PlayerCleanup.ObjectsPerTask", 2000);
+	static TaskQueue* customQueue = [taskManager] () { return taskManager->initializeCustomQueue("CharacterCleanupThreads", ConfigManager::instance()->getInt("Core3.PlayerCleanup.Threads", 4)); } (); //only once
 
-	String className;
-	uint64 deletedCount = 0;
-	uint64 playerCount = 0;
+	Mutex charactersMutex;
+	AtomicInteger playerCount;
 
-	ZoneServer* server = ServerCore::getZoneServer();
+	// Keys come off the cursor in order, each task reads the records of one key range
+	const auto dispatch = [&] (const Vector<uint64>& keys) {
+		taskManager->executeTask([keys, thisDatabase, &validCharacters, &charactersMutex, &playerCount, characters]() {
+			for (const auto& objectID : keys) {
+				try {
+					ObjectInputStream objectData(2000);
 
-	if (server == nullptr) {
-		error("nullptr ZoneServer in character cleanup");
-		return;
-	}
+					if (thisDatabase->getData(objectID, &objectData, berkeley::LockMode::READ_UNCOMMITED, false, true)) {
+						continue;
+					}
 
-	int galaxyID = server->getGalaxyID();
+					uint32 gameObjectType = 0;
 
-	while(iterator.getNextKeyAndValue(objectID, &objectData)) {
-		if (Serializable::getVariable<String>(STRING_HASHCODE("_className"), &className, &objectData)) {
-			if (className == "CreatureObject") {
-				playerCount++;
+					// The type field is enough to skip everything that isn't a player creature
+					if (!Serializable::getVariable<uint32>(STRING_HASHCODE("SceneObject.gameObjectType"), &gameObjectType, &objectData)
+							|| gameObjectType != SceneObjectType::PLAYERCREATURE) {
+						continue;
+					}
 
-				if (shouldDeleteCharacter(objectID, galaxyID)) {
-					deletedCount++;
-					info("DELETE CHARACTER " + String::valueOf(objectID),true);
-				}
+					playerCount.increment();
 
+					if (validCharacters.contains(objectID)) {
+						continue;
+					}
+
+					Locker locker(&charactersMutex);
+
+					characters->put(objectID);
+				} catch (...) {
+					Logger::console.error("unreported exception caught in CharacterCleanupTask");
+				}
 			}
+		}, "CharacterCleanupTask", "CharacterCleanupThreads");
+	};
+
+	ObjectDatabaseIterator iterator(thisDatabase);
+	Vector<uint64> keys(objectsPerTask, objectsPerTask);
+	uint64 objectID;
+
+	while (iterator.getNextKey(objectID)) {
+		keys.add(objectID);
+
+		if (keys.size() >= objectsPerTask) {
+			dispatch(keys);
+
+			keys.removeAll(objectsPerTask, objectsPerTask);
 		}
-		objectData.reset();
+	}
+
+	if (keys.size() > 0) {
+		dispatch(keys);
+	}
+
+	taskManager->waitForQueueToFinish("CharacterCleanupThreads");
+
+	return playerCount.get();
+}
+
+void PlayerManagerImplementation::getCleanupCharacterCount() {
+	info("**** GETTING CHARACTER CLEANUP INFORMATION ***",true);
+
+	SortedVector<uint64> characters;
+	characters.setNoDuplicateInsertPlan();
+
+	int playerCount = findCleanupCharacters(&characters);
+
+	if (playerCount < 0)
+		return;
+
+	for (int i = 0; i < characters.size(); ++i) {
+		info("DELETE CHARACTER " + String::valueOf(characters.get(i)),true);
 	}
 
 	StringBuffer deletedMessage;
-	deletedMessage << "TOTAL CHARACTERS " << " TO BE DELETED " << String::valueOf(deletedCount);
+	deletedMessage << "TOTAL CHARACTERS " << " TO BE DELETED " << String::valueOf(characters.size());
 	info("TOTAL CHARACTERS IN OBJECT DB: " + String::valueOf(playerCount),true);
 	info(deletedMessage.toString(),true);
 }
 
-void PlayerManagerImplementation::cleanupCharacters() {
+int PlayerManagerImplementation::removeCommittedCharacters(SortedVector<uint64>* characters) {
+	const static int batchSize = 100;
 
-	info("**** PERFORMING CHARACTER CLEANUP ***",true);
+	Vector<uint64> candidates(characters->size(), 1);
 
-	ObjectDatabase* thisDatabase = ObjectDatabaseManager::instance()->loadObjectDatabase("sceneobjects", true, 0xFFFF, false);
+	for (int i = 0; i < characters->size(); ++i)
+		candidates.add(characters->get(i));
 
-	if (thisDatabase == nullptr)
-		return;
+	int removed = 0;
 
-	ObjectInputStream objectData(2000);
-	ObjectDatabaseIterator iterator(thisDatabase);
+	for (int next = 0; next < candidates.size();) {
+		int rows = Math::min(batchSize, candidates.size() - next);
 
-	uint64 objectID;
+		StringBuffer placeholders;
 
-	String className;
-	uint64 deletedCount = 0;
-	uint64 playerCount = 0;
+		for (int i = 0; i < rows; ++i)
+			placeholders << (i > 0 ? ", " : "") << "?";
 
-	ZoneServer* server = ServerCore::getZoneServer();
+		StringBuffer queryString;
+		queryString << "SELECT character_oid FROM characters WHERE character_oid IN (" << placeholders.toString() << ")"
+			<< " UNION SELECT character_oid FROM characters_dirty WHERE character_oid IN (" << placeholders.toString() << ")";
 
-	if (server == nullptr) {
-		error("nullptr ZoneServer in character cleanup");
-		return;
-	}
+		server::db::mysql::PreparedStatement query(queryString.toString());
 
-	int galaxyID = server->getGalaxyID();
+		for (int pass = 0; pass < 2; ++pass) {
+			for (int i = 0; i < rows; ++i)
+				query.bindUnsigned(candidates.get(next + i));
+		}
 
-	while(iterator.getNextKeyAndValue(objectID, &objectData) && deletedCount < 400) {
-		if (Serializable::getVariable<String>(STRING_HASHCODE("_className"), &className, &objectData)) {
-			if (className == "CreatureObject") {
-				playerCount++;
+		next += rows;
 
-				if (shouldDeleteCharacter(objectID, galaxyID)) {
+		try {
+			UniqueReference<ResultSet*> result(ServerDatabase::executeQuery(query));
 
-					ManagedReference<CreatureObject*> object = Core::getObjectBroker()->lookUp(objectID).castTo<CreatureObject*>();
+			if (result == nullptr) {
+				error("ERROR WHILE CONFIRMING CLEANUP CHARACTERS");
+				return -1;
+			}
 
-					if (object == nullptr) {
-						info("OBJECT nullptr when getting object " + String::valueOf(objectID),true);
-					}else if (object->isPlayerCreature()) {
+			while (result->next()) {
+				uint64 objectID = result->getUnsignedLong(0);
 
-						deletedCount++;
-						info("DELETING CHARACTER: " + String::valueOf(objectID)+ " NAME: " +  object->getFirstName() + " " + object->getLastName() ,true);
-						Locker _lock(object);
+				if (characters->drop(objectID)) {
+					info() << "CHARACTER " << objectID << " EXISTS NOW, NOT DELETING";
 
-						ManagedReference<ZoneClientSession*> client = object->getClient();
+					++removed;
+				}
+			}
+		} catch (const DatabaseException& err) {
+			error() << "database error " << err.getMessage();
+			return -1;
+		}
+	}
 
-						if (client != nullptr)
-							client->disconnect();
+	return removed;
+}
 
-						object->destroyObjectFromWorld(false); //Don't need to send destroy to the player - they are being disconnected.
-						object->destroyPlayerCreatureFromDatabase(true);
+void PlayerManagerImplementation::cleanupCharacters(bool confirm) {
+	if (!confirm) {
+		getCleanupCharacterCount();
 
-					}
+		info("run \"playercleanup confirm\" to delete the characters listed above", true);
+		return;
+	}
 
-				}
+	info("**** PERFORMING CHARACTER CLEANUP ***",true);
 
-			}
+	SortedVector<uint64> characters;
+	characters.setNoDuplicateInsertPlan();
 
-		}
+	int playerCount = findCleanupCharacters(&characters);
 
-		objectData.reset();
+	if (playerCount < 0)
+		return;
+
+	const static int maxDeletes = ConfigManager::instance()->getInt("Core3.PlayerCleanup.MaxDeletes", 400);
+	const static int maxPercent = ConfigManager::instance()->getInt("Core3.PlayerCleanup.MaxPercent", 25);
+
+	// the scan reads a characters snapshot taken minutes ago, drop anything created or committed since
+	if (removeCommittedCharacters(&characters) < 0) {
+		error("could not confirm the cleanup characters, not deleting anything");
+		return;
 	}
 
-	StringBuffer deletedMessage;
-	deletedMessage << "TOTAL CHARACTERS";
-	deletedMessage << " DELETED FROM OBJECTDB: " << String::valueOf(deletedCount);
-	info(deletedMessage.toString(),true);
+	info() << "TOTAL CHARACTERS IN OBJECT DB: " << playerCount << " NOT IN SQL TABLE: " << characters.size() << " WILL DELETE: " << Math::min(characters.size(), maxDeletes);
 
-}
+	if (characters.size() > 0 && characters.size() * 100 > (int64) playerCount * maxPercent) {
+		error() << characters.size() << " of " << playerCount << " characters are missing from the SQL table, more than Core3.PlayerCleanup.MaxPercent (" << maxPercent << "%), not deleting anything";
+		return;
+	}
 
-bool PlayerManagerImplementation::shouldDeleteCharacter(uint64 characterID, int galaxyID) {
-	const String query = "SELECT * FROM characters WHERE character_oid = " + String::valueOf(characterID) + " AND galaxy_id = " + String::valueOf(galaxyID);
+	uint64 deletedCount = 0;
 
-	try {
-		UniqueReference<ResultSet*> result(ServerDatabase::instance()->executeQuery(query));
+	for (int i = 0; i < characters.size() && deletedCount < maxDeletes; ++i) {
+		uint64 objectID = characters.get(i);
 
-		if (result == nullptr) {
-			error("ERROR WHILE LOOKING UP CHARACTER IN SQL TABLE");
-		} else if (result->getRowsAffected() > 1) {
+		ManagedReference<CreatureObject*> object = Core::getObjectBroker()->lookUp(objectID).castTo<CreatureObject*>();
 
-			error("More than one character with oid = " + String::valueOf(characterID) + " in galaxy " + String::valueOf(galaxyID));
-			return false;
+		if (object == nullptr) {
+			info("OBJECT nullptr when getting object " + String::valueOf(objectID),true);
+		}else if (object->isPlayerCreature()) {
 
-		} else if (result->getRowsAffected() == 0) {
-			return true;
-		}
+			deletedCount++;
+			info("DELETING CHARACTER: " + String::valueOf(objectID)+ " NAME: " +  object->getFirstName() + " " + object->getLastName() ,true);
+			Locker _lock(object);
 
-		return false;
-	} catch (const DatabaseException& err) {
-		error() << "database error " << err.getMessage();
-		return false;
+			ManagedReference<ZoneClientSession*> client = object->getClient();
+
+			if (client != nullptr)
+				client->disconnect();
+
+			object->destroyObjectFromWorld(false); //Don't need to send destroy to the player - they are being disconnected.
+			object->destroyPlayerCreatureFromDatabase(true);
+
+		}
 	}
+
+	StringBuffer deletedMessage;
+	deletedMessage << "TOTAL CHARACTERS";
+	deletedMessage << " DELETED FROM OBJECTDB: " << String::valueOf(deletedCount);
+	info(deletedMessage.toString(),true);
+
 }
 
 bool PlayerManagerImplementation::doBurstRun(CreatureObject* player, float hamModifier, float cooldownModifier) {
@@ -443,6 +443,10 @@ String ResourceManagerImplementation::ghDump() {
 	return resourceSpawner->ghDump();
 }
 
+String ResourceManagerImplementation::exportDensityHeatmap(const String& resourceName, const String& zoneName, int cellSize) {
+	return resourceSpawner->exportDensityHeatmap(resourceName, zoneName, cellSize);
+}
+
 String ResourceManagerImplementation::despawnResource(String& resourceName) {
 
 	ManagedReference<ResourceSpawn*> spawn = getResourceSpawn(resourceName);
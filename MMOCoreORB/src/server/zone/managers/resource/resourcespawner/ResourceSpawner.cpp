@@ -919,6 +919,94 @@ void ResourceSpawner::sendResourceListForSurvey(CreatureObject* player,
 	 }*/
 }
 
+String ResourceSpawner::exportDensityHeatmap(const String& resname, const String& zoneName, int cellSize) const {
+	ManagedReference<ResourceSpawn*> spawn = resourceMap->get(resname.toLowerCase());
+
+	if (spawn == nullptr)
+		return "Spawn not Found";
+
+	cellSize = Math::max(cellSize, 8);
+
+	Vector<String> zones;
+
+	for (int i = 0; i < spawn->getSpawnMapSize(); ++i) {
+		String zone = spawn->getSpawnMapZone(i);
+
+		if (zone != "" && (zoneName == "" || zone == zoneName))
+			zones.add(zone);
+	}
+
+	if (zones.size() == 0)
+		return spawn->getName() + " is not spawned on " + (zoneName == "" ? String("any zone") : zoneName);
+
+	StringBuffer result;
+
+	for (int z = 0; z < zones.size(); ++z) {
+		const String& zone = zones.get(z);
+
+		Vector<float> bounds;
+
+		if (!spawn->getSpawnMapBounds(zone, bounds))
+			continue;
+
+		float minX = bounds.get(0), maxX = bounds.get(1), minY = bounds.get(2), maxY = bounds.get(3);
+
+		int columns = Math::min((int) ((maxX - minX) / cellSize) + 1, 4096);
+		int rows = Math::min((int) ((maxY - minY) / cellSize) + 1, 4096);
+
+		String fileName = "log/heatmap_" + spawn->getName() + "_" + zone + ".csv";
+
+		File* file = new File(fileName);
+		FileWriter* writer = nullptr;
+
+		float bestDensity = -1, bestX = 0, bestY = 0;
+
+		try {
+			writer = new FileWriter(file);
+
+			writer->writeLine("# " + spawn->getName() + " on " + zone + ", cell " + String::valueOf(cellSize)
+					+ "m, first row y=" + String::valueOf(maxY) + ", first column x=" + String::valueOf(minX));
+
+			Vector<float> densities(columns, 1);
+
+			// one row per batch keeps the buffer small on 16km planets
+			for (int r = 0; r < rows; ++r) {
+				float y = maxY - r * cellSize;
+
+				spawn->getDensityGrid(zone, minX, y, cellSize, columns, 1, densities);
+
+				StringBuffer line;
+
+				for (int c = 0; c < columns; ++c) {
+					float density = densities.get(c);
+
+					if (density > bestDensity) {
+						bestDensity = density;
+						bestX = minX + c * cellSize;
+						bestY = y;
+					}
+
+					line << (c == 0 ? "" : ",") << (int) (density * 100.f);
+				}
+
+				writer->writeLine(line.toString());
+			}
+
+			writer->close();
+		} catch (Exception& e) {
+			error("Error writing " + fileName);
+		}
+
+		delete writer;
+		delete file;
+
+		result << zone << ": " << columns << "x" << rows << " written to " << fileName << ", best " << (int) (bestDensity * 100.f)
+				<< "% at " << (int) bestX << " " << (int) bestY << "\n";
+	}
+
+	return result.toString();
+}
+
 void ResourceSpawner::sendSurvey(CreatureObject* player, const String& resname) const {
 
 	/*if (player->getHAM(CreatureAttribute::MIND) < 100) {
@@ -964,24 +1052,25 @@ void ResourceSpawner::sendSurvey(CreatureObject* player, const String& resname)
 	float maxDensity = -1;
 	float maxX = 0, maxY = 0;
 
+	ManagedReference<ResourceSpawn*> resourceSpawn = resourceMap->get(resname.toLowerCase());
+
+	Vector<float> densities(points * points, 1);
+	resourceSpawn->getDensityGrid(zoneName, posX, posY, spacer, points, points, densities);
+
 	for (int i = 0; i < points; i++) {
 		for (int j = 0; j < points; j++) {
-
-			float density = resourceMap->getDensityAt(resname, zoneName, posX, posY);
+			float pointX = posX + j * spacer;
+			float pointY = posY - i * spacer;
+			float density = densities.get(i * points + j);
 
 			if (density > maxDensity) {
 				maxDensity = density;
-				maxX = posX;
-				maxY = posY;
+				maxX = pointX;
+				maxY = pointY;
 			}
 
-			surveyMessage->add(posX, posY, density);
-
-			posX += spacer;
+			surveyMessage->add(pointX, pointY, density);
 		}
-
-		posY -= spacer;
-		posX -= (points * spacer);
 	}
 
 	ManagedReference<WaypointObject*> waypoint = nullptr;
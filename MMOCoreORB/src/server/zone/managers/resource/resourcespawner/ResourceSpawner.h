@@ -96,6 +96,8 @@ public:
 	bool writeAllSpawnsToScript();
 	bool ghDumpAll();
 
+	String exportDensityHeatmap(const String& resname, const String& zoneName, int cellSize) const;
+
 	void start();
 	void shiftResources();
 
@@ -0,0 +1,424 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "TaskProfiler.h"
+#include "conf/ConfigManager.h"
+
+#include <algorithm>
+
+void TaskProfileEntry::reset() {
+	samples.set(0);
+	totalRunTime.set(0);
+	maxRunTime.set(0);
+	waitSamples.set(0);
+	totalWaitTime.set(0);
+	maxWaitTime.set(0);
+	totalLockWaitTime.set(0);
+	maxLockWaitTime.set(0);
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+		runHistogram[i].set(0);
+		waitHistogram[i].set(0);
+	}
+}
+
+uint64 TaskProfileEntry::getPercentile(const AtomicLong* histogram, float percentile) const {
+	uint64 total = 0;
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; ++i)
+		total += histogram[i].get();
+
+	if (total == 0)
+		return 0;
+
+	uint64 target = (uint64) (total * percentile);
+	uint64 accumulated = 0;
+
+	for (int i = 0; i < HISTOGRAM_BUCKETS; ++i) {
+		accumulated += histogram[i].get();
+
+		if (accumulated > target)
+			return 1ULL << (i + 1);
+	}
+
+	return 1ULL << HISTOGRAM_BUCKETS;
+}
+
+TaskProfiler::Scope::Scope(Task* task, int64 waitTimeMs, const char* name) : entry(nullptr), startTime(0), lockWaitStart(0), lockWaitTime(0) {
+	entry = TaskProfiler::instance()->sample(task, name);
+
+	if (entry == nullptr)
+		return;
+
+	entry->running.increment();
+
+	if (waitTimeMs >= 0)
+		TaskProfiler::instance()->recordWait(entry, waitTimeMs * 1000);
+
+	startTime = System::getMikroTime();
+}
+
+TaskProfiler::Scope::~Scope() {
+	if (entry == nullptr)
+		return;
+
+	stopLockWait();
+
+	TaskProfiler::instance()->record(entry, System::getMikroTime() - startTime, lockWaitTime);
+
+	entry->running.decrement();
+}
+
+TaskProfiler::TaskProfiler() : Logger("TaskProfiler") {
+	for (int i = 0; i < MAX_ENTRIES; ++i)
+		entries[i] = nullptr;
+
+	memset(recentSamples, 0, sizeof(recentSamples));
+
+	entryIndexes.setNullValue(-1);
+
+	sampleRate.set(16);
+	enabled.set(true);
+}
+
+TaskProfiler::~TaskProfiler() {
+	for (int i = 0; i < MAX_ENTRIES; ++i) {
+		delete entries[i];
+		entries[i] = nullptr;
+	}
+}
+
+void TaskProfiler::loadConfig() {
+	auto config = ConfigManager::instance();
+
+	setEnabled(config->getBool("Core3.TaskProfiler.Enabled", true));
+	setSampleRate(config->getInt("Core3.TaskProfiler.SampleRate", 16));
+
+	info() << "enabled: " << isEnabled() << " sample rate: 1/" << getSampleRate();
+}
+
+TaskProfileEntry* TaskProfiler::sample(Task* task, const char* name) {
+	if (!enabled.get())
+		return nullptr;
+
+	static thread_local uint32 sampleCounter = 0;
+
+	if ((++sampleCounter % (uint32) sampleRate.get()) != 0)
+		return nullptr;
+
+	const String& queue = task->getCustomTaskQueue();
+
+	return getEntry(queue.isEmpty() ? String("default") : queue, name != nullptr ? name : task->getTaskName());
+}
+
+TaskProfileEntry* TaskProfiler::getEntry(const String& queueName, const String& taskName) {
+	String key = queueName + ";" + taskName;
+
+	ReadLocker readLocker(&entriesGuard);
+
+	int index = entryIndexes.get(key);
+
+	if (index >= 0)
+		return entries[index];
+
+	readLocker.release();
+
+	Locker locker(&entriesGuard);
+
+	index = entryIndexes.get(key);
+
+	if (index >= 0)
+		return entries[index];
+
+	index = entryCount.get();
+
+	// the last slot collects everything once the table is full, screenplay tasks can have many names
+	if (index >= MAX_ENTRIES - 1) {
+		if (entries[MAX_ENTRIES - 1] == nullptr) {
+			entries[MAX_ENTRIES - 1] = new TaskProfileEntry(MAX_ENTRIES - 1, "overflow", "overflow");
+			entryCount.increment();
+		}
+
+		// so the next lookup of this key takes the read path
+		entryIndexes.put(key, MAX_ENTRIES - 1);
+
+		return entries[MAX_ENTRIES - 1];
+	}
+
+	entries[index] = new TaskProfileEntry(index, queueName, taskName);
+	entryIndexes.put(key, index);
+
+	entryCount.increment();
+
+	return entries[index];
+}
+
+TaskProfileEntry* TaskProfiler::getEntry(int index) const {
+	if (index < 0 || index >= entryCount.get())
+		return nullptr;
+
+	return entries[index];
+}
+
+void TaskProfiler::recordWait(TaskProfileEntry* entry, uint64 waitTime) {
+	entry->waitSamples.increment();
+	entry->totalWaitTime.add(waitTime);
+	entry->waitHistogram[TaskProfileEntry::getHistogramBucket(waitTime)].increment();
+
+	TaskProfileEntry::updateMax(entry->maxWaitTime, waitTime);
+}
+
+void TaskProfiler::record(TaskProfileEntry* entry, uint64 runTime, uint64 lockWaitTime) {
+	entry->samples.increment();
+	entry->totalRunTime.add(runTime);
+	entry->runHistogram[TaskProfileEntry::getHistogramBucket(runTime)].increment();
+
+	TaskProfileEntry::updateMax(entry->maxRunTime, runTime);
+
+	if (lockWaitTime > 0) {
+		entry->totalLockWaitTime.add(lockWaitTime);
+
+		TaskProfileEntry::updateMax(entry->maxLockWaitTime, lockWaitTime);
+	}
+
+	uint32 slot = ((uint32) recentSampleIndex.increment()) % RECENT_SAMPLES;
+
+	RecentSample& recent = recentSamples[slot];
+	recent.timestamp = System::getMikroTime() / 1000;
+	recent.entryIndex = entry->index;
+	recent.runTime = (uint32) Math::min(runTime, (uint64) 0xFFFFFFFF);
+}
+
+void TaskProfiler::reset() {
+	Locker locker(&entriesGuard);
+
+	for (int i = 0; i < entryCount.get(); ++i)
+		entries[i]->reset();
+
+	memset(recentSamples, 0, sizeof(recentSamples));
+
+	startTime.updateToCurrentTime();
+}
+
+void TaskProfiler::getSortedEntries(int limit, Vector<TaskProfileEntry*>& sorted) const {
+	int count = entryCount.get();
+
+	for (int i = 0; i < count; ++i) {
+		TaskProfileEntry* entry = getEntry(i);
+
+		if (entry != nullptr && entry->samples.get() > 0)
+			sorted.add(entry);
+	}
+
+	std::sort(sorted.begin(), sorted.end(), [](TaskProfileEntry* a, TaskProfileEntry* b) {
+		return a->totalRunTime.get() > b->totalRunTime.get();
+	});
+
+	while (limit > 0 && sorted.size() > limit)
+		sorted.remove(sorted.size() - 1);
+}
+
+int TaskProfiler::getTopEntries(int seconds, int limit, Vector<int>& top, Vector<uint64>& runTimes, Vector<uint32>& counts) const {
+	int count = entryCount.get();
+
+	for (int i = 0; i < count; ++i) {
+		runTimes.add(0);
+		counts.add(0);
+	}
+
+	uint64 since = System::getMikroTime() / 1000 - (uint64) seconds * 1000;
+	int totalSamples = 0;
+
+	for (int i = 0; i < RECENT_SAMPLES; ++i) {
+		const RecentSample& recent = recentSamples[i];
+
+		if (recent.timestamp < since || (int) recent.entryIndex >= count)
+			continue;
+
+		runTimes.elementAt(recent.entryIndex) += recent.runTime;
+		counts.elementAt(recent.entryIndex) += 1;
+
+		++totalSamples;
+	}
+
+	for (int i = 0; i < count; ++i) {
+		if (counts.get(i) > 0)
+			top.add(i);
+	}
+
+	std::sort(top.begin(), top.end(), [&runTimes](int a, int b) {
+		return runTimes.get(a) > runTimes.get(b);
+	});
+
+	while (limit > 0 && top.size() > limit)
+		top.remove(top.size() - 1);
+
+	return totalSamples;
+}
+
+String TaskProfiler::getSummary(int limit) {
+	Vector<TaskProfileEntry*> sorted;
+	getSortedEntries(limit, sorted);
+
+	int rate = getSampleRate();
+
+	StringBuffer buf;
+	buf << "Task profiler " << (isEnabled() ? "enabled" : "disabled") << ", sample rate 1/" << rate
+		<< ", collecting for " << startTime.miliDifference() / 1000 << "s" << endl;
+
+	for (int i = 0; i < sorted.size(); ++i) {
+		TaskProfileEntry* entry = sorted.get(i);
+
+		uint64 samples = entry->samples.get();
+		uint64 waitSamples = entry->waitSamples.get();
+
+		buf << "[" << entry->queueName << "] " << entry->taskName
+			<< " est.count: " << samples * rate
+			<< " run avg: " << entry->totalRunTime.get() / samples << "us"
+			<< " p99: " << entry->getPercentile(entry->runHistogram, 0.99f) << "us"
+			<< " max: " << entry->maxRunTime.get() << "us"
+			<< " wait avg: " << (waitSamples > 0 ? entry->totalWaitTime.get() / waitSamples : 0) << "us"
+			<< " max: " << entry->maxWaitTime.get() << "us"
+			<< " lock avg: " << entry->totalLockWaitTime.get() / samples << "us"
+			<< " running: " << entry->running.get() << endl;
+	}
+
+	return buf.toString();
+}
+
+String TaskProfiler::getTopTasks(int seconds, int limit) {
+	Vector<int> top;
+	Vector<uint64> runTimes;
+	Vector<uint32> counts;
+
+	int totalSamples = getTopEntries(seconds, limit, top, runTimes, counts);
+	int rate = getSampleRate();
+
+	StringBuffer buf;
+	buf << "Top tasks in the last " << seconds << "s (" << totalSamples << " samples, 1/" << rate << ")" << endl;
+
+	for (int i = 0; i < top.size(); ++i) {
+		int index = top.get(i);
+		TaskProfileEntry* entry = getEntry(index);
+
+		buf << "[" << entry->queueName << "] " << entry->taskName
+			<< " est.count: " << (uint64) counts.get(index) * rate
+			<< " est.time: " << runTimes.get(index) * rate / 1000 << "ms"
+			<< " avg: " << runTimes.get(index) / counts.get(index) << "us" << endl;
+	}
+
+	return buf.toString();
+}
+
+void TaskProfiler::getAsJSON(JSONSerializationType& jsonData, int limit) {
+	Vector<TaskProfileEntry*> sorted;
+	getSortedEntries(limit, sorted);
+
+	jsonData["enabled"] = isEnabled();
+	jsonData["sampleRate"] = getSampleRate();
+	jsonData["collectingSeconds"] = startTime.miliDifference() / 1000;
+
+	JSONSerializationType tasks = JSONSerializationType::array();
+
+	for (int i = 0; i < sorted.size(); ++i) {
+		TaskProfileEntry* entry = sorted.get(i);
+
+		JSONSerializationType task;
+
+		task["queue"] = entry->queueName;
+		task["task"] = entry->taskName;
+		task["samples"] = entry->samples.get();
+		task["totalRunTimeUs"] = entry->totalRunTime.get();
+		task["maxRunTimeUs"] = entry->maxRunTime.get();
+		task["waitSamples"] = entry->waitSamples.get();
+		task["totalWaitTimeUs"] = entry->totalWaitTime.get();
+		task["maxWaitTimeUs"] = entry->maxWaitTime.get();
+		task["totalLockWaitTimeUs"] = entry->totalLockWaitTime.get();
+		task["maxLockWaitTimeUs"] = entry->maxLockWaitTime.get();
+		task["running"] = entry->running.get();
+
+		JSONSerializationType runHistogram = JSONSerializationType::array();
+		JSONSerializationType waitHistogram = JSONSerializationType::array();
+
+		for (int j = 0; j < TaskProfileEntry::HISTOGRAM_BUCKETS; ++j) {
+			runHistogram.push_back(entry->runHistogram[j].get());
+			waitHistogram.push_back(entry->waitHistogram[j].get());
+		}
+
+		task["runHistogram"] = runHistogram;
+		task["waitHistogram"] = waitHistogram;
+
+		tasks.push_back(task);
+	}
+
+	jsonData["tasks"] = tasks;
+}
+
+void TaskProfiler::getTopTasksAsJSON(JSONSerializationType& jsonData, int seconds, int limit) {
+	Vector<int> top;
+	Vector<uint64> runTimes;
+	Vector<uint32> counts;
+
+	jsonData["seconds"] = seconds;
+	jsonData["sampleRate"] = getSampleRate();
+	jsonData["samples"] = getTopEntries(seconds, limit, top, runTimes, counts);
+
+	JSONSerializationType tasks = JSONSerializationType::array();
+
+	for (int i = 0; i < top.size(); ++i) {
+		int index = top.get(i);
+		TaskProfileEntry* entry = getEntry(index);
+
+		JSONSerializationType task;
+
+		task["queue"] = entry->queueName;
+		task["task"] = entry->taskName;
+		task["samples"] = counts.get(index);
+		task["totalRunTimeUs"] = runTimes.get(index);
+
+		tasks.push_back(task);
+	}
+
+	jsonData["tasks"] = tasks;
+}
+
+bool TaskProfiler::dumpToFile(const String& fileName) {
+	Vector<TaskProfileEntry*> sorted;
+	getSortedEntries(0, sorted);
+
+	File* file = new File(fileName);
+	FileWriter* writer = nullptr;
+
+	try {
+		writer = new FileWriter(file);
+
+		for (int i = 0; i < sorted.size(); ++i) {
+			TaskProfileEntry* entry = sorted.get(i);
+
+			String taskName = entry->taskName.replaceAll(" ", "_").replaceAll(";", ":");
+
+			// collapsed stacks: queue;task;phase weight, weights in microseconds
+			writer->writeLine(entry->queueName + ";" + taskName + ";run " + String::valueOf(entry->totalRunTime.get() - entry->totalLockWaitTime.get()));
+
+			if (entry->totalLockWaitTime.get() > 0)
+				writer->writeLine(entry->queueName + ";" + taskName + ";lockwait " + String::valueOf(entry->totalLockWaitTime.get()));
+		}
+
+		writer->close();
+	} catch (Exception& e) {
+		error() << "could not write profile to " << fileName << ": " << e.getMessage();
+
+		delete writer;
+		delete file;
+
+		return false;
+	}
+
+	delete writer;
+	delete file;
+
+	info(true) << "wrote " << sorted.size() << " task profiles to " << fileName;
+
+	return true;
+}
@@ -0,0 +1,167 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef TASKPROFILER_H_
+#define TASKPROFILER_H_
+
+#include "engine/engine.h"
+
+/**
+ * Counters for one (task queue, task type) pair. Histograms use log2 microsecond buckets,
+ * bucket i holds samples in [2^i, 2^(i+1)) us and the last bucket everything above.
+ */
+class TaskProfileEntry {
+public:
+	static const int HISTOGRAM_BUCKETS = 24;
+
+	const int index;
+	const String queueName;
+	const String taskName;
+
+	AtomicLong samples;
+	AtomicLong totalRunTime;
+	AtomicLong maxRunTime;
+	AtomicLong waitSamples;
+	AtomicLong totalWaitTime;
+	AtomicLong maxWaitTime;
+	AtomicLong totalLockWaitTime;
+	AtomicLong maxLockWaitTime;
+	AtomicInteger running;
+
+	AtomicLong runHistogram[HISTOGRAM_BUCKETS];
+	AtomicLong waitHistogram[HISTOGRAM_BUCKETS];
+
+	TaskProfileEntry(int idx, const String& queue, const String& task) : index(idx), queueName(queue), taskName(task) {
+	}
+
+	static int getHistogramBucket(uint64 micros) {
+		int bucket = 0;
+
+		while (micros > 1 && bucket < HISTOGRAM_BUCKETS - 1) {
+			micros >>= 1;
+			++bucket;
+		}
+
+		return bucket;
+	}
+
+	static void updateMax(AtomicLong& max, uint64 value) {
+		// racy by design, a lost update only affects a reporting value
+		if (value > (uint64) max.get())
+			max.set(value);
+	}
+
+	void reset();
+
+	uint64 getPercentile(const AtomicLong* histogram, float percentile) const;
+};
+
+/**
+ * Always on, sampling profiler for zone task queues. Tasks opt in by creating a
+ * TaskProfiler::Scope at the top of their run(), only one in sampleRate executions
+ * per worker thread is timed.
+ */
+class TaskProfiler : public Singleton<TaskProfiler>, public Logger, public Object {
+public:
+	static const int MAX_ENTRIES = 4096;
+	static const int RECENT_SAMPLES = 65536;
+
+	class Scope {
+		TaskProfileEntry* entry;
+		uint64 startTime;
+		uint64 lockWaitStart;
+		uint64 lockWaitTime;
+
+	public:
+		/**
+		 * @param waitTimeMs time the task spent queued past its due time, negative if unknown
+		 * @param name overrides Task::getTaskName() for tasks with per instance names
+		 */
+		Scope(Task* task, int64 waitTimeMs = -1, const char* name = nullptr);
+		~Scope();
+
+		inline void startLockWait() {
+			if (entry != nullptr)
+				lockWaitStart = System::getMikroTime();
+		}
+
+		inline void stopLockWait() {
+			if (entry != nullptr && lockWaitStart != 0) {
+				lockWaitTime += System::getMikroTime() - lockWaitStart;
+				lockWaitStart = 0;
+			}
+		}
+
+		inline bool isSampled() const {
+			return entry != nullptr;
+		}
+	};
+
+private:
+	struct RecentSample {
+		uint64 timestamp;
+		uint32 entryIndex;
+		uint32 runTime;
+	};
+
+	TaskProfileEntry* entries[MAX_ENTRIES];
+	AtomicInteger entryCount;
+	HashTable<String, int> entryIndexes;
+	ReadWriteLock entriesGuard;
+
+	RecentSample recentSamples[RECENT_SAMPLES];
+	AtomicInteger recentSampleIndex;
+
+	AtomicInteger sampleRate;
+	AtomicBoolean enabled;
+	Time startTime;
+
+	TaskProfileEntry* getEntry(const String& queueName, const String& taskName);
+	TaskProfileEntry* getEntry(int index) const;
+
+	void recordWait(TaskProfileEntry* entry, uint64 waitTime);
+	void record(TaskProfileEntry* entry, uint64 runTime, uint64 lockWaitTime);
+
+	int getTopEntries(int seconds, int limit, Vector<int>& top, Vector<uint64>& runTimes, Vector<uint32>& counts) const;
+	void getSortedEntries(int limit, Vector<TaskProfileEntry*>& sorted) const;
+
+public:
+	TaskProfiler();
+	~TaskProfiler();
+
+	void loadConfig();
+
+	TaskProfileEntry* sample(Task* task, const char* name);
+
+	void reset();
+
+	inline void setEnabled(bool val) {
+		enabled.set(val);
+	}
+
+	inline bool isEnabled() const {
+		return enabled.get();
+	}
+
+	inline void setSampleRate(int rate) {
+		sampleRate.set(Math::max(1, rate));
+	}
+
+	inline int getSampleRate() const {
+		return sampleRate.get();
+	}
+
+	String getSummary(int limit = 25);
+	String getTopTasks(int seconds, int limit = 25);
+
+	void getAsJSON(JSONSerializationType& jsonData, int limit);
+	void getTopTasksAsJSON(JSONSerializationType& jsonData, int seconds, int limit);
+
+	/**
+	 * Writes run time per queue;task in the collapsed stack format used by flamegraph.pl
+	 */
+	bool dumpToFile(const String& fileName);
+};
+
+#endif /* TASKPROFILER_H_ */
@@ -0,0 +1,184 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "ZoneTrafficRecorder.h"
+#include "conf/ConfigManager.h"
+
+#include "server/zone/ZoneClientSession.h"
+#include "server/zone/objects/creature/CreatureObject.h"
+
+ZoneTrafficRecorder::ZoneTrafficRecorder() : Logger("ZoneTrafficRecorder"), file(nullptr), output(nullptr) {
+	recording.set(false);
+}
+
+ZoneTrafficRecorder::~ZoneTrafficRecorder() {
+	stop();
+}
+
+void ZoneTrafficRecorder::loadConfig() {
+	auto config = ConfigManager::instance();
+
+	if (config->getBool("Core3.TrafficCapture.Enabled", false))
+		start(config->getString("Core3.TrafficCapture.File", "log/zonetraffic-" + String::valueOf(Time().getTime()) + ".trace"));
+}
+
+bool ZoneTrafficRecorder::isTraced(Message* pack) {
+	int offset = pack->getOffset();
+	int length = pack->size() - offset;
+
+	if (length < 6)
+		return false;
+
+	uint32 opcode = pack->parseInt(offset + 2);
+
+	switch (opcode) {
+	case OBJECTCONTROLLER: {
+		if (length < 14)
+			return false;
+
+		uint32 type = pack->parseInt(offset + 10);
+
+		return type == DATATRANSFORM || type == DATATRANSFORMWITHPARENT || type == COMMANDQUEUEENQUEUE;
+	}
+	case CHATINSTANTMESSAGETOCHARACTER:
+	case CHATSENDTOROOM:
+	case CHATPERSISTENTMESSAGETOSERVER:
+	case SUIEVENTNOTIFICATION:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool ZoneTrafficRecorder::start(const String& traceFile) {
+	Locker locker(&writeMutex);
+
+	if (recording.get()) {
+		error() << "already recording to " << fileName;
+
+		return false;
+	}
+
+	try {
+		file = new File(traceFile);
+		output = new FileOutputStream(file);
+	} catch (Exception& e) {
+		error() << "could not open " << traceFile << ": " << e.getMessage();
+
+		delete output;
+		delete file;
+
+		output = nullptr;
+		file = nullptr;
+
+		return false;
+	}
+
+	fileName = traceFile;
+	startTime.updateToCurrentTime();
+
+	records.set(0);
+	bytes.set(0);
+
+	buffer.clear();
+	buffer.insertInt(MAGIC);
+	buffer.insertShort(VERSION);
+	buffer.insertLong(startTime.getMiliTime());
+
+	recording.set(true);
+
+	info(true) << "recording zone traffic to " << fileName;
+
+	return true;
+}
+
+void ZoneTrafficRecorder::stop() {
+	Locker locker(&writeMutex);
+
+	if (!recording.get())
+		return;
+
+	recording.set(false);
+
+	try {
+		flushBuffer();
+
+		output->close();
+	} catch (Exception& e) {
+		error() << "could not close " << fileName << ": " << e.getMessage();
+	}
+
+	delete output;
+	delete file;
+
+	output = nullptr;
+	file = nullptr;
+
+	info(true) << "wrote " << records.get() << " messages, " << bytes.get() << " bytes to " << fileName;
+}
+
+void ZoneTrafficRecorder::flushBuffer() {
+	if (buffer.size() == 0)
+		return;
+
+	output->write((byte*) buffer.getBuffer(), buffer.size());
+
+	buffer.clear();
+}
+
+void ZoneTrafficRecorder::record(ZoneClientSession* client, Message* pack) {
+	if (!isTraced(pack))
+		return;
+
+	ManagedReference<CreatureObject*> player = client->getPlayer();
+
+	if (player == nullptr)
+		return;
+
+	int offset = pack->getOffset();
+	int length = pack->size() - offset;
+
+	if (length > 0xFFFF)
+		return;
+
+	Locker locker(&writeMutex);
+
+	if (!recording.get())
+		return;
+
+	buffer.insertInt((uint32) startTime.miliDifference());
+	buffer.insertInt(client->getAccountID());
+	buffer.insertLong(player->getObjectID());
+	buffer.insertShort((uint16) length);
+	buffer.insertStream(pack->getBuffer() + offset, length);
+
+	records.increment();
+	bytes.add(RECORDHEADERSIZE + length);
+
+	if (buffer.size() < FLUSHSIZE)
+		return;
+
+	try {
+		flushBuffer();
+	} catch (Exception& e) {
+		error() << "could not write to " << fileName << ", stopping: " << e.getMessage();
+
+		locker.release();
+
+		stop();
+	}
+}
+
+String ZoneTrafficRecorder::getStatus() {
+	StringBuffer buf;
+
+	if (recording.get()) {
+		buf << "recording to " << fileName << " for " << startTime.miliDifference() / 1000 << "s, "
+			<< records.get() << " messages, " << bytes.get() << " bytes";
+	} else {
+		buf << "not recording";
+	}
+
+	return buf.toString();
+}
@@ -0,0 +1,90 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef ZONETRAFFICRECORDER_H_
+#define ZONETRAFFICRECORDER_H_
+
+#include "engine/engine.h"
+
+namespace server {
+namespace zone {
+	class ZoneClientSession;
+}
+}
+
+using namespace server::zone;
+
+/**
+ * Writes inbound movement, command, chat and sui messages to a binary trace that
+ * ZoneTrafficReplay can feed back into a zone server.
+ *
+ * Trace layout, little endian:
+ *  header: uint32 magic, uint16 version, uint64 capture start in ms since epoch
+ *  record: uint32 ms since capture start, uint32 account id, uint64 character id,
+ *          uint16 length, length bytes of the message starting at the opcount
+ */
+class ZoneTrafficRecorder : public Singleton<ZoneTrafficRecorder>, public Logger, public Object {
+public:
+	static const uint32 MAGIC = 0x5254335A; // "Z3TR"
+	static const uint16 VERSION = 1;
+
+	static const int HEADERSIZE = 14;
+	static const int RECORDHEADERSIZE = 18;
+	static const int FLUSHSIZE = 64 * 1024;
+
+	static const uint32 OBJECTCONTROLLER = 0x80CE5E46;
+
+	static const uint32 DATATRANSFORM = 0x71;
+	static const uint32 DATATRANSFORMWITHPARENT = 0xF1;
+	static const uint32 COMMANDQUEUEENQUEUE = 0x116;
+
+	static const uint32 CHATINSTANTMESSAGETOCHARACTER = 0x84BB21F7;
+	static const uint32 CHATSENDTOROOM = 0x20E4DBE3;
+	static const uint32 CHATPERSISTENTMESSAGETOSERVER = 0x25A29FA6;
+	static const uint32 SUIEVENTNOTIFICATION = 0x092D3564;
+
+private:
+	Mutex writeMutex;
+	AtomicBoolean recording;
+
+	File* file;
+	FileOutputStream* output;
+	Packet buffer;
+
+	Time startTime;
+	String fileName;
+
+	AtomicLong records;
+	AtomicLong bytes;
+
+	void flushBuffer();
+
+public:
+	ZoneTrafficRecorder();
+	~ZoneTrafficRecorder();
+
+	void loadConfig();
+
+	/**
+	 * Checks the opcode, and the object controller type, of a message at its current offset
+	 */
+	static bool isTraced(Message* pack);
+
+	bool start(const String& traceFile);
+	void stop();
+
+	/**
+	 * Appends pack to the trace if it is one of the traced messages from a client with a
+	 * player attached, the message offset is left untouched
+	 */
+	void record(ZoneClientSession* client, Message* pack);
+
+	inline bool isRecording() const {
+		return recording.get();
+	}
+
+	String getStatus();
+};
+
+#endif /* ZONETRAFFICRECORDER_H_ */
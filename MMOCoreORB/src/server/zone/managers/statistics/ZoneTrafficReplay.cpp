@@ -0,0 +1,285 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "ZoneTrafficReplay.h"
+#include "ZoneTrafficRecorder.h"
+
+#include "server/zone/ZoneServer.h"
+#include "server/zone/ZoneClientSession.h"
+#include "server/zone/ZoneProcessServer.h"
+#include "server/zone/ZonePacketHandler.h"
+#include "server/zone/Zone.h"
+#include "server/zone/objects/creature/CreatureObject.h"
+#include "server/zone/packets/zone/SelectCharacterCallback.h"
+
+AtomicLong ZoneTrafficReplay::outboundMessages;
+AtomicLong ZoneTrafficReplay::outboundBytes;
+
+class ZoneTrafficReplayTask : public Task {
+	Reference<ZoneTrafficReplay*> replay;
+	Reference<Task*> task;
+	Reference<ZoneClientSession*> client;
+
+public:
+	ZoneTrafficReplayTask(ZoneTrafficReplay* replay, Task* task, ZoneClientSession* client) : replay(replay), task(task), client(client) {
+		setCustomTaskQueue(task->getCustomTaskQueue());
+	}
+
+	void run() {
+		uint64 lockWaitTime = 0;
+
+		ManagedReference<CreatureObject*> player = client->getPlayer();
+		ManagedReference<Zone*> zone = player != nullptr ? player->getZone() : nullptr;
+
+		// moves no longer hold the zone lock, so probe how long anything needing it would wait
+		if (zone != nullptr) {
+			uint64 lockStart = System::getMikroTime();
+
+			zone->rlock();
+
+			lockWaitTime = System::getMikroTime() - lockStart;
+
+			zone->runlock();
+		}
+
+		uint64 start = System::getMikroTime();
+
+		try {
+			task->run();
+		} catch (const Exception& e) {
+			replay->error() << "exception replaying " << task->getTaskName() << ": " << e.getMessage();
+		}
+
+		replay->recordHandler(task->getTaskName(), System::getMikroTime() - start, lockWaitTime);
+	}
+};
+
+ZoneTrafficReplay::ZoneTrafficReplay(const String& traceFile, ZoneServer* server, bool realTime) : Logger("ZoneTrafficReplay") {
+	fileName = traceFile;
+	zoneServer = server;
+	ZoneTrafficReplay::realTime = realTime;
+
+	sessions.setNoDuplicateInsertPlan();
+	handlerStats.setNoDuplicateInsertPlan();
+
+	maxLockWaitTime = 0;
+	elapsed = 0;
+
+	finished.set(false);
+}
+
+void ZoneTrafficReplay::run() {
+	outboundMessages.set(0);
+	outboundBytes.set(0);
+
+	startTime.updateToCurrentTime();
+
+	File* file = new File(fileName);
+	FileInputStream* input = nullptr;
+
+	try {
+		input = new FileInputStream(file);
+
+		replayRecords(input);
+
+		input->close();
+	} catch (Exception& e) {
+		error() << "could not replay " << fileName << ": " << e.getMessage();
+	}
+
+	delete input;
+	delete file;
+
+	while (pendingTasks.get() > 0 && !zoneServer->isServerShuttingDown())
+		Thread::sleep(10);
+
+	elapsed = startTime.miliDifference();
+
+	closeSessions();
+
+	finished.set(true);
+
+	info(true) << getReport();
+}
+
+void ZoneTrafficReplay::replayRecords(FileInputStream* input) {
+	byte header[ZoneTrafficRecorder::RECORDHEADERSIZE];
+	byte payload[0xFFFF];
+
+	if (input->read(header, ZoneTrafficRecorder::HEADERSIZE) != ZoneTrafficRecorder::HEADERSIZE
+			|| *(uint32*) header != ZoneTrafficRecorder::MAGIC || *(uint16*) (header + 4) != ZoneTrafficRecorder::VERSION) {
+		error() << fileName << " is not a zone traffic trace";
+
+		return;
+	}
+
+	info(true) << "replaying " << fileName << (realTime ? " in real time" : " at max speed");
+
+	while (input->read(header, ZoneTrafficRecorder::RECORDHEADERSIZE) == ZoneTrafficRecorder::RECORDHEADERSIZE) {
+		uint32 timestamp = *(uint32*) header;
+		uint32 accountID = *(uint32*) (header + 4);
+		uint64 characterID = *(uint64*) (header + 8);
+		uint16 length = *(uint16*) (header + 16);
+
+		if (input->read(payload, length) != length) {
+			error() << "truncated record in " << fileName;
+
+			return;
+		}
+
+		if (zoneServer->isServerShuttingDown())
+			return;
+
+		if (realTime) {
+			int64 delay = (int64) timestamp - startTime.miliDifference();
+
+			if (delay > 0)
+				Thread::sleep(delay);
+		}
+
+		while (pendingTasks.get() >= MAXPENDINGTASKS)
+			Thread::sleep(1);
+
+		ZoneClientSession* client = getSession(accountID, characterID);
+
+		if (client == nullptr) {
+			skipped.increment();
+
+			continue;
+		}
+
+		ManagedReference<CreatureObject*> player = client->getPlayer();
+
+		if (player == nullptr) {
+			skipped.increment();
+
+			continue;
+		}
+
+		Message* message = new Message();
+		message->insertStream((char*) payload, length);
+		message->reset();
+
+		Reference<Task*> task = player->getZoneProcessServer()->getPacketHandler()->generateMessageTask(client, message);
+
+		delete message;
+
+		if (task == nullptr) {
+			skipped.increment();
+
+			continue;
+		}
+
+		pendingTasks.increment();
+		replayed.increment();
+
+		Core::getTaskManager()->executeTask(new ZoneTrafficReplayTask(this, task, client));
+	}
+}
+
+ZoneClientSession* ZoneTrafficReplay::getSession(uint32 accountID, uint64 characterID) {
+	int index = sessions.find(characterID);
+
+	if (index != -1)
+		return sessions.elementAt(index).getValue();
+
+	Reference<ZoneClientSession*> client;
+
+	ManagedReference<SceneObject*> object = zoneServer->getObject(characterID);
+
+	if (object != nullptr && object->isPlayerCreature()) {
+		CreatureObject* player = object->asCreatureObject();
+
+		Locker locker(player);
+
+		ManagedReference<ZoneClientSession*> oldClient = player->getClient();
+
+		if (oldClient == nullptr) {
+			client = new ZoneClientSession(nullptr);
+			client->setAccountID(accountID);
+
+#ifdef WITH_SESSION_API
+			SelectCharacterCallback::connectApprovedPlayer(player, characterID, player, client, zoneServer);
+#else
+			SelectCharacterCallback::connectPlayer(player, characterID, player, client, zoneServer);
+#endif
+		} else if (oldClient->getSession() == nullptr) {
+			// connected by a replay that is still running
+			client = oldClient.get();
+		} else {
+			warning() << "character " << characterID << " is online, skipping its messages";
+		}
+
+		if (client != nullptr && client->getPlayer() == nullptr)
+			client = nullptr;
+	} else {
+		warning() << "could not load character " << characterID << " from the trace";
+	}
+
+	sessions.put(characterID, client);
+
+	return client;
+}
+
+void ZoneTrafficReplay::closeSessions() {
+	for (int i = 0; i < sessions.size(); ++i) {
+		Reference<ZoneClientSession*> client = sessions.elementAt(i).getValue();
+
+		if (client != nullptr)
+			client->closeConnection(true, true);
+	}
+}
+
+void ZoneTrafficReplay::recordHandler(const String& name, uint64 runTime, uint64 lockWaitTime) {
+	Locker locker(&statsMutex);
+
+	int index = handlerStats.find(name);
+
+	if (index == -1)
+		index = handlerStats.put(name, ZoneTrafficReplayStats());
+
+	ZoneTrafficReplayStats& stats = handlerStats.elementAt(index).getValue();
+
+	++stats.count;
+	stats.totalRunTime += runTime;
+	stats.totalLockWaitTime += lockWaitTime;
+
+	if (runTime > stats.maxRunTime)
+		stats.maxRunTime = runTime;
+
+	if (lockWaitTime > maxLockWaitTime)
+		maxLockWaitTime = lockWaitTime;
+
+	locker.release();
+
+	pendingTasks.decrement();
+}
+
+String ZoneTrafficReplay::getReport() {
+	Locker locker(&statsMutex);
+
+	uint64 duration = finished.get() ? elapsed : startTime.miliDifference();
+	uint64 totalLockWaitTime = 0;
+
+	StringBuffer buf;
+	buf << "Replay of " << fileName << (realTime ? " (real time) " : " (max speed) ") << (finished.get() ? "finished" : "running")
+		<< " after " << duration << "ms: " << replayed.get() << " messages replayed, " << skipped.get() << " skipped, "
+		<< sessions.size() << " sessions" << endl;
+
+	for (int i = 0; i < handlerStats.size(); ++i) {
+		const ZoneTrafficReplayStats& stats = handlerStats.elementAt(i).getValue();
+
+		totalLockWaitTime += stats.totalLockWaitTime;
+
+		buf << handlerStats.elementAt(i).getKey() << " count: " << stats.count
+			<< " avg: " << stats.totalRunTime / stats.count << "us"
+			<< " max: " << stats.maxRunTime << "us"
+			<< " zone lock wait avg: " << stats.totalLockWaitTime / stats.count << "us" << endl;
+	}
+
+	buf << "zone lock wait total: " << totalLockWaitTime << "us max: " << maxLockWaitTime << "us" << endl;
+	buf << "outbound: " << outboundMessages.get() << " messages, " << outboundBytes.get() << " bytes" << endl;
+
+	return buf.toString();
+}
@@ -0,0 +1,98 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef ZONETRAFFICREPLAY_H_
+#define ZONETRAFFICREPLAY_H_
+
+#include "engine/engine.h"
+
+namespace server {
+namespace zone {
+	class ZoneServer;
+	class ZoneClientSession;
+}
+}
+
+using namespace server::zone;
+
+class ZoneTrafficReplayStats {
+public:
+	uint64 count;
+	uint64 totalRunTime;
+	uint64 maxRunTime;
+	uint64 totalLockWaitTime;
+
+	ZoneTrafficReplayStats() : count(0), totalRunTime(0), maxRunTime(0), totalLockWaitTime(0) {
+	}
+};
+
+/**
+ * Feeds a trace written by ZoneTrafficRecorder into this zone server. Every character
+ * in the trace is connected through a session without a network connection, then each
+ * message goes through the packet handler and runs on its usual task queue, either at
+ * the recorded pace or as fast as the queues drain.
+ *
+ * Meant for a server started on a copy of the databases the trace was captured against.
+ */
+class ZoneTrafficReplay : public Thread, public Logger, public Object {
+public:
+	static const int MAXPENDINGTASKS = 2048;
+
+protected:
+	String fileName;
+	ManagedReference<ZoneServer*> zoneServer;
+	bool realTime;
+
+	VectorMap<uint64, Reference<ZoneClientSession*> > sessions;
+
+	VectorMap<String, ZoneTrafficReplayStats> handlerStats;
+	Mutex statsMutex;
+	uint64 maxLockWaitTime;
+
+	AtomicInteger pendingTasks;
+	AtomicLong replayed;
+	AtomicLong skipped;
+	AtomicBoolean finished;
+
+	Time startTime;
+	uint64 elapsed;
+
+	static AtomicLong outboundMessages;
+	static AtomicLong outboundBytes;
+
+	ZoneClientSession* getSession(uint32 accountID, uint64 characterID);
+
+	void replayRecords(FileInputStream* input);
+
+	/**
+	 * Logs out every character the replay connected
+	 */
+	void closeSessions();
+
+public:
+	ZoneTrafficReplay(const String& traceFile, ZoneServer* server, bool realTime);
+
+	void run();
+
+	/**
+	 * Called from the task threads once a replayed message has been handled
+	 */
+	void recordHandler(const String& name, uint64 runTime, uint64 lockWaitTime);
+
+	String getReport();
+
+	inline bool isFinished() const {
+		return finished.get();
+	}
+
+	/**
+	 * Counts a message sent to a session without a network connection
+	 */
+	static inline void countOutbound(int size) {
+		outboundMessages.increment();
+		outboundBytes.add(size);
+	}
+};
+
+#endif /* ZONETRAFFICREPLAY_H_ */
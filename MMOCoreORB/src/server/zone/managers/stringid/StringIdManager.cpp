@@ -12,6 +12,8 @@
 #include "templates/manager/DataArchiveStore.h"
 #include "tre3/TreeArchive.h"
 
+const UnicodeString StringIdTable::emptyString;
+
 void StringIdManager::populateDatabase() {
 	int count = 0;
 
@@ -83,7 +85,89 @@ void StringIdManager::populateDatabase() {
 	info(true) << "writing to the db " << count  << " strings";
 }
 
-StringIdManager::StringIdManager() : Logger("StringIdManager") {
+void StringIdManager::loadTable() {
+	Time start;
+
+	Vector<uint32> keys(100000, 50000);
+	Vector<UnicodeString> values(100000, 50000);
+
+	LocalDatabaseIterator iterator(stringsDatabase);
+	ObjectInputStream key;
+	ObjectInputStream data;
+
+	databaseBytes = 0;
+
+	while (iterator.getNextKeyAndValue(&key, &data)) {
+		uint64 longKey = 0;
+		UnicodeString value;
+
+		databaseBytes += key.size() + data.size();
+
+		TypeInfo<uint64>::parseFromBinaryStream(&longKey, &key);
+		value.parseFromBinaryStream(&data);
+
+		keys.add((uint32) longKey);
+		values.add(value);
+
+		key.clear();
+		data.clear();
+	}
+
+	table.build(keys, values);
+
+	info(true) << "loaded " << table.size() << " strings in " << start.miliDifference() << "ms, " << getTableInfo();
+}
+
+String StringIdManager::getTableInfo() const {
+	StringBuffer buf;
+	buf << "table " << table.size() << " strings " << table.getCharacterCount() << " chars "
+		<< table.getMemoryUsage() / 1024 << "KB resident, database payload " << databaseBytes / 1024 << "KB";
+
+	return buf.toString();
+}
+
+String StringIdManager::runBenchmark(int iterations) {
+	if (table.size() == 0)
+		return "string table is empty";
+
+	Vector<uint32> keys(iterations, 1);
+
+	// deterministic mix, one in eight lookups is a miss
+	uint32 seed = 0x9E3779B9;
+
+	for (int i = 0; i < iterations; ++i) {
+		seed = seed * 1664525 + 1013904223;
+
+		if (i % 8 == 0)
+			keys.add(seed);
+		else
+			keys.add(table.getKeyAt((seed >> 8) % table.size()));
+	}
+
+	uint64 databaseChars = 0;
+	Time start;
+
+	for (int i = 0; i < iterations; ++i)
+		databaseChars += getStringIdFromDatabase(keys.getUnsafe(i)).length();
+
+	uint64 databaseTime = start.miliDifference();
+	uint64 tableChars = 0;
+
+	start.updateToCurrentTime();
+
+	for (int i = 0; i < iterations; ++i)
+		tableChars += table.get(keys.getUnsafe(i)).length();
+
+	uint64 tableTime = start.miliDifference();
+
+	StringBuffer buf;
+	buf << iterations << " lookups: database " << databaseTime << "ms, table " << tableTime << "ms"
+		<< (databaseChars == tableChars ? "" : " (results differ!)") << endl << getTableInfo();
+
+	return buf.toString();
+}
+
+StringIdManager::StringIdManager() : Logger("StringIdManager"), databaseBytes(0) {
 	databaseManager = ObjectDatabaseManager::instance();
 	bool fill = databaseManager->getDatabaseID("strings") == 0xFFFF;
 
@@ -93,11 +177,27 @@ StringIdManager::StringIdManager() : Logger("StringIdManager") {
 		populateDatabase();
 
 	ObjectDatabaseManager::instance()->commitLocalTransaction();
+
+	loadTable();
 }
 
 StringIdManager::~StringIdManager() {}
 
 UnicodeString StringIdManager::getStringId(uint32 crc) {
+	if (table.size() > 0)
+		return table.get(crc);
+
+	return getStringIdFromDatabase(crc);
+}
+
+String StringIdManager::getStringIdAsString(uint32 crc) {
+	if (table.size() > 0)
+		return table.get(crc).toString();
+
+	return getStringIdFromDatabase(crc).toString();
+}
+
+UnicodeString StringIdManager::getStringIdFromDatabase(uint32 crc) {
 	ObjectInputStream data;
 	UnicodeString str = "";
 
@@ -9,6 +9,7 @@
 #define STRINGIDMANAGER_H_
 
 #include "server/zone/objects/scene/variables/StringId.h"
+#include "StringIdTable.h"
 
 namespace server {
 namespace zone {
@@ -20,9 +21,17 @@ class StringIdManager : public Logger, public Singleton<StringIdManager>, public
 
 	LocalDatabase* stringsDatabase;
 
+	StringIdTable table;
+	uint64 databaseBytes;
+
 protected:
 	void populateDatabase();
 
+	/**
+	 * Copies the strings database into the in memory table
+	 */
+	void loadTable();
+
 public:
 	StringIdManager();
 
@@ -31,6 +40,21 @@ public:
 	UnicodeString getStringId(uint32 crc);
 
 	UnicodeString getStringId(const StringId& id);
+
+	/**
+	 * getStringId(crc).toString() without the intermediate UnicodeString copy when the
+	 * table is loaded, falls back to the database like getStringId otherwise
+	 */
+	String getStringIdAsString(uint32 crc);
+
+	/**
+	 * Reads straight from the strings database, bypassing the table
+	 */
+	UnicodeString getStringIdFromDatabase(uint32 crc);
+
+	String getTableInfo() const;
+
+	String runBenchmark(int iterations);
 };
 
 }
@@ -0,0 +1,127 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef STRINGIDTABLE_H_
+#define STRINGIDTABLE_H_
+
+#include "engine/engine.h"
+
+#include <algorithm>
+
+namespace server {
+namespace zone {
+namespace managers {
+namespace stringid {
+
+/**
+ * Immutable crc -> string table. Built once at startup from sorted parallel
+ * arrays, lookups are a binary search over the crc array and return a
+ * reference into the table, so they need neither locks nor allocations.
+ */
+class StringIdTable {
+	Vector<uint32> crcs;
+	Vector<UnicodeString> values;
+
+	uint64 characterCount;
+
+	const static UnicodeString emptyString;
+
+public:
+	StringIdTable() : crcs(1, 1), values(1, 1), characterCount(0) {
+	}
+
+	/**
+	 * Replaces the table contents, keys must be unique
+	 */
+	void build(const Vector<uint32>& keys, const Vector<UnicodeString>& strings) {
+		int count = keys.size();
+
+		Vector<int> order(count, 1);
+
+		for (int i = 0; i < count; ++i)
+			order.add(i);
+
+		std::sort(order.begin(), order.end(), [&keys](int a, int b) {
+			return keys.getUnsafe(a) < keys.getUnsafe(b);
+		});
+
+		crcs.removeAll(count, 1);
+		values.removeAll(count, 1);
+		characterCount = 0;
+
+		for (int i = 0; i < count; ++i) {
+			int index = order.getUnsafe(i);
+
+			const UnicodeString& value = strings.getUnsafe(index);
+
+			crcs.add(keys.getUnsafe(index));
+			values.add(value);
+
+			characterCount += value.length();
+		}
+	}
+
+	int find(uint32 crc) const {
+		int low = 0;
+		int high = crcs.size() - 1;
+
+		while (low <= high) {
+			int mid = (low + high) >> 1;
+			uint32 key = crcs.getUnsafe(mid);
+
+			if (key < crc)
+				low = mid + 1;
+			else if (key > crc)
+				high = mid - 1;
+			else
+				return mid;
+		}
+
+		return -1;
+	}
+
+	bool contains(uint32 crc) const {
+		return find(crc) != -1;
+	}
+
+	/**
+	 * Returns an empty string when crc is not in the table
+	 */
+	const UnicodeString& get(uint32 crc) const {
+		int index = find(crc);
+
+		if (index == -1)
+			return emptyString;
+
+		return values.getUnsafe(index);
+	}
+
+	int size() const {
+		return crcs.size();
+	}
+
+	uint32 getKeyAt(int index) const {
+		return crcs.get(index);
+	}
+
+	uint64 getCharacterCount() const {
+		return characterCount;
+	}
+
+	/**
+	 * Approximate resident size: crc array, string objects and their UTF-16 buffers
+	 */
+	uint64 getMemoryUsage() const {
+		return (uint64) crcs.size() * (sizeof(uint32) + sizeof(UnicodeString)) + characterCount * 2;
+	}
+};
+
+}
+}
+}
+}
+
+using namespace server::zone::managers::stringid;
+
+#endif /* STRINGIDTABLE_H_ */
@@ -33,6 +33,13 @@ void SpawnAreaImplementation::buildSpawnList(Vector<uint32>* groupCRCs) {
 			totalWeighting += spawn->getWeighting();
 		}
 	}
+
+	Vector<int> weights(possibleSpawns.size(), 1);
+
+	for (int i = 0; i < possibleSpawns.size(); i++)
+		weights.add(possibleSpawns.getUnsafe(i)->getWeighting());
+
+	spawnSampler.build(weights);
 }
 
 Vector3 SpawnAreaImplementation::getRandomPosition(SceneObject* player) {
@@ -126,21 +133,12 @@ void SpawnAreaImplementation::tryToSpawn(SceneObject* object) {
 	if (lastSpawn.miliDifference() < MINSPAWNINTERVAL)
 		return;
 
-	int choice = System::random(totalWeighting - 1);
-	int counter = 0;
-
-	LairSpawn* finalSpawn = nullptr;
+	int choice = spawnSampler.sample();
 
-	for (int i = 0; i < possibleSpawns.size(); i++) {
-		LairSpawn* spawn = possibleSpawns.get(i);
-
-		counter += spawn->getWeighting();
+	if (choice == -1)
+		return;
 
-		if (choice < counter) {
-			finalSpawn = spawn;
-			break;
-		}
-	}
+	LairSpawn* finalSpawn = possibleSpawns.get(choice);
 
 	if (finalSpawn == nullptr)
 		return;
@@ -36,6 +36,7 @@
 #include "server/zone/objects/building/components/GCWBaseContainerComponent.h"
 #include "server/zone/objects/building/components/EnclaveContainerComponent.h"
 #include "server/zone/objects/transaction/TransactionLog.h"
+#include "server/zone/objects/scene/BaselineCache.h"
 
 void BuildingObjectImplementation::initializeTransientMembers() {
 	StructureObjectImplementation::initializeTransientMembers();
@@ -377,10 +378,13 @@ void BuildingObjectImplementation::sendBaselinesTo(SceneObject* player) {
 	//send buios here
 	debug("sending building baselines");
 
-	BaseMessage* buio3 = new TangibleObjectMessage3(asBuildingObject());
+	BuildingObject* building = asBuildingObject();
+	BaselineCache* baselineCache = BaselineCache::instance();
+
+	BasePacket* buio3 = baselineCache->get(asSceneObject(), 3, [building] () { return new TangibleObjectMessage3(building); });
 	player->sendMessage(buio3);
 
-	BaseMessage* buio6 = new TangibleObjectMessage6(asBuildingObject());
+	BasePacket* buio6 = baselineCache->get(asSceneObject(), 6, [building] () { return new TangibleObjectMessage6(building); });
 	player->sendMessage(buio6);
 }
 
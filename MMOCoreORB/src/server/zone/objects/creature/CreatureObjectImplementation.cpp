@@ -14,6 +14,7 @@
 #include "server/zone/managers/combat/CombatManager.h"
 #include "server/zone/managers/mission/MissionManager.h"
 #include "server/zone/managers/creature/PetManager.h"
+#include "server/zone/DeltaFlushQueue.h"
 #include "server/zone/managers/reaction/ReactionManager.h"
 #include "server/zone/ZoneClientSession.h"
 #include "server/zone/packets/creature/CreatureObjectMessage1.h"
@@ -596,7 +597,7 @@ void CreatureObjectImplementation::setShockWounds(int newShock,
 
 	shockWounds = newShock;
 
-	if (notifyClient) {
+	if (notifyClient && !deferDeltaField(3, 15)) {
 		CreatureObjectDeltaMessage3* dcreo3 = new CreatureObjectDeltaMessage3(
 				asCreatureObject());
 		dcreo3->updateShockWounds();
@@ -851,7 +852,7 @@ bool CreatureObjectImplementation::setState(uint64 state, bool notifyClient) {
 					delete dcreo3;
 #endif
 				}
-			} else {
+			} else if (!deferDeltaField(3, 0x10)) {
 				CreatureObjectDeltaMessage3* dcreo3 = new CreatureObjectDeltaMessage3(asCreatureObject());
 				dcreo3->updateState();
 				dcreo3->close();
@@ -938,7 +939,7 @@ bool CreatureObjectImplementation::clearState(uint64 state, bool notifyClient) {
 	if (stateBitmask & state) {
 		stateBitmask &= ~state;
 
-		if (notifyClient) {
+		if (notifyClient && !deferDeltaField(3, 0x10)) {
 			CreatureObjectDeltaMessage3* dcreo3 =
 					new CreatureObjectDeltaMessage3(asCreatureObject());
 			dcreo3->updateState();
@@ -1010,7 +1011,7 @@ void CreatureObjectImplementation::setHAM(int type, int value,
 
 	debug() << "setting ham type " << type << " to " << value;
 
-	if (notifyClient) {
+	if (notifyClient && !deferDeltaField(6, 0x0D, type)) {
 		CreatureObjectDeltaMessage6* msg = new CreatureObjectDeltaMessage6(
 				asCreatureObject());
 		msg->startUpdate(0x0D);
@@ -1161,6 +1162,42 @@ int CreatureObjectImplementation::healWound(TangibleObject* healer,
 	return returnValue;
 }
 
+void CreatureObjectImplementation::flushDirtyDeltas() {
+	if (dirtyDeltaFields.isBaselineDirty(3)) {
+		CreatureObjectDeltaMessage3* dcreo3 = new CreatureObjectDeltaMessage3(asCreatureObject());
+
+		if (dirtyDeltaFields.isFieldDirty(3, 15))
+			dcreo3->updateShockWounds();
+
+		if (dirtyDeltaFields.isFieldDirty(3, 0x10))
+			dcreo3->updateState();
+
+		dirtyDeltaFields.writeListUpdate(dcreo3, 3, 0x11, wounds);
+
+		dcreo3->close();
+
+		broadcastMessage(dcreo3, true);
+
+		DeltaFlushQueue::flushedMessages.increment();
+	}
+
+	if (dirtyDeltaFields.isBaselineDirty(6)) {
+		CreatureObjectDeltaMessage6* dcreo6 = new CreatureObjectDeltaMessage6(asCreatureObject());
+
+		dirtyDeltaFields.writeListUpdate(dcreo6, 6, 0x0D, hamList);
+		dirtyDeltaFields.writeListUpdate(dcreo6, 6, 0x0E, maxHamList);
+
+		dcreo6->close();
+
+		broadcastMessage(dcreo6, true);
+
+		DeltaFlushQueue::flushedMessages.increment();
+	}
+
+	// condition damage of vehicles still goes out as a tangible delta, this clears the bitmaps
+	TangibleObjectImplementation::flushDirtyDeltas();
+}
+
 void CreatureObjectImplementation::setBaseHAM(int type, int value,
 		bool notifyClient) {
 	if (baseHAM.get(type) == value)
@@ -1192,7 +1229,7 @@ void CreatureObjectImplementation::setWounds(int type, int value,
 	if (wounds.get(type) == value)
 		return;
 
-	if (notifyClient) {
+	if (notifyClient && !deferDeltaField(3, 0x11, type)) {
 		CreatureObjectDeltaMessage3* msg = new CreatureObjectDeltaMessage3(
 				asCreatureObject());
 		msg->startUpdate(0x11);
@@ -1249,7 +1286,7 @@ void CreatureObjectImplementation::setMaxHAM(int type, int value,
 
 	debug() << "setting maxham type " << type << " to " << value;
 
-	if (notifyClient) {
+	if (notifyClient && !deferDeltaField(6, 0x0E, type)) {
 		CreatureObjectDeltaMessage6* msg = new CreatureObjectDeltaMessage6(
 				asCreatureObject());
 		msg->startUpdate(0x0E);
@@ -42,6 +42,7 @@
 #include "server/zone/managers/components/ComponentManager.h"
 #include "server/zone/managers/conversation/ConversationManager.h"
 #include "server/zone/managers/creature/AiMap.h"
+#include "server/zone/managers/creature/ZoneAwarenessPass.h"
 #include "server/zone/managers/creature/CreatureTemplateManager.h"
 #include "server/zone/managers/faction/FactionManager.h"
 #include "server/zone/managers/gcw/GCWManager.h"
@@ -271,7 +272,7 @@ void AiAgentImplementation::loadTemplateData(CreatureTemplate* templateData) {
 			if (objectName == "")
 				newName += templateData->getCustomName();
 			else
-				newName += StringIdManager::instance()->getStringId(objectName.getFullPath().hashCode()).toString();
+				newName += StringIdManager::instance()->getStringIdAsString(objectName.getFullPath().hashCode());
 
 			newName += ")";
 			setCustomObjectName(newName, false);
@@ -499,6 +500,12 @@ void AiAgentImplementation::notifyPositionUpdate(QuadTreeEntry* entry) {
 	CreatureObject* creo = object->asCreatureObject();
 
 	if (creo != nullptr && creo->isPlayerCreature() && !creo->isInvisible()) {
+		// the zone awareness pass wakes us once the player is actually close enough, doAwarenessCheck polls from there
+		if (ZoneAwarenessPass::isEnabled()) {
+			AiMap::instance()->awarenessMoveWakeupsSkipped.increment();
+			return;
+		}
+
 		activateAwarenessEvent();
 	}
 }
@@ -825,6 +832,41 @@ void AiAgentImplementation::doAwarenessCheck() {
 		activateAwarenessEvent();
 }
 
+void AiAgentImplementation::checkAwarenessCandidate(CreatureObject* target) {
+	if (target == nullptr || target == asAiAgent())
+		return;
+
+	if (target->isVehicleObject() || target->hasRidingCreature())
+		return;
+
+	Behavior* current = behaviors.get(currentBehaviorID);
+
+	if (current != nullptr && current->doAwarenessCheck(target)) {
+		interrupt(target, ObserverEventType::OBJECTINRANGEMOVED);
+	}
+}
+
+void AiAgentImplementation::queueAwarenessCandidate(CreatureObject* candidate) {
+	if (getCloseObjects() == nullptr)
+		return;
+
+	Locker locker(&awarenessEventMutex);
+
+	if (awarenessEvent == nullptr) {
+		awarenessEvent = new AiAwarenessEvent(asAiAgent());
+		auto zone = getZone();
+
+		if (zone != nullptr) {
+			awarenessEvent->setCustomTaskQueue(zone->getZoneName());
+		}
+	}
+
+	awarenessEvent->addCandidate(candidate);
+
+	if (!awarenessEvent->isScheduled())
+		awarenessEvent->schedule(0);
+}
+
 void AiAgentImplementation::doRecovery(int latency) {
 	if (isDead() || getZoneUnsafe() == nullptr)
 		return;
@@ -25,11 +25,15 @@ class AiAwarenessEvent : public Task {
 
 	Mutex guard;
 
+	// players the zone awareness pass found in range since the last run
+	VectorMap<uint64, ManagedWeakReference<CreatureObject*> > candidates;
+
 public:
 	AiAwarenessEvent(AiAgent* pl) : Task(1000) {
 		creature = pl;
 		mtime = 0;
 		avgSpeed = 0.f;
+		candidates.setNoDuplicateInsertPlan();
 		AiMap::instance()->activeAwarenessEvents.increment();
 	}
 
@@ -45,9 +49,47 @@ public:
 		if (strongRef == nullptr)
 			return;
 
+		VectorMap<uint64, ManagedWeakReference<CreatureObject*> > queued;
+
+		{
+			Locker guardLocker(&guard);
+
+			queued = candidates;
+			candidates.removeAll();
+		}
+
 		Locker locker(strongRef);
 
-		strongRef->doAwarenessCheck();
+		if (queued.size() == 0) {
+			strongRef->doAwarenessCheck();
+			return;
+		}
+
+		for (int i = 0; i < queued.size(); ++i) {
+			ManagedReference<CreatureObject*> target = queued.elementAt(i).getValue().get();
+
+			if (target != nullptr)
+				strongRef->checkAwarenessCandidate(target);
+		}
+
+		// from here on the full check polls while players stay in range, moving or not
+		strongRef->activateAwarenessEvent();
+	}
+
+	/**
+	 * Returns true if the candidate was not queued yet
+	 */
+	bool addCandidate(CreatureObject* candidate) {
+		Locker locker(&guard);
+
+		uint64 oid = candidate->getObjectID();
+
+		if (candidates.contains(oid))
+			return false;
+
+		candidates.put(oid, candidate);
+
+		return true;
 	}
 
 	void schedule(uint64 delay = 0) {
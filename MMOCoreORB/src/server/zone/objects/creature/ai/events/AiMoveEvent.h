@@ -10,6 +10,7 @@
 
 #include "server/zone/objects/creature/ai/AiAgent.h"
 #include "server/zone/managers/creature/AiMap.h"
+#include "server/zone/managers/statistics/TaskProfiler.h"
 
 namespace server {
 namespace zone {
@@ -45,6 +46,8 @@ public:
 	}
 
 	void run() {
+		TaskProfiler::Scope profile(this, getNextExecutionTime().miliDifference());
+
 		AiMap::instance()->scheduledMoveEvents.decrement();
 
 		if (hasFollowObject) {
@@ -64,8 +67,12 @@ public:
 		if (strongRef == nullptr)
 			return;
 
+		profile.startLockWait();
+
 		Locker locker(strongRef);
 
+		profile.stopLockWait();
+
 		strongRef->doMovement();
 	}
 
@@ -11,6 +11,7 @@
 
 #include "server/zone/objects/creature/ai/AiAgent.h"
 #include "server/zone/managers/creature/AiMap.h"
+#include "server/zone/managers/statistics/TaskProfiler.h"
 
 namespace server {
 namespace zone {
@@ -35,12 +36,18 @@ public:
 	}
 
 	void run() {
+		TaskProfiler::Scope profile(this, getNextExecutionTime().miliDifference());
+
 		ManagedReference<AiAgent*> strongRef = creature.get();
 
 		if (strongRef == nullptr)
 			return;
 
+		profile.startLockWait();
+
 		Locker locker(strongRef);
+
+		profile.stopLockWait();
 		strongRef->doRecovery(startTime.miliDifference());
 	}
 
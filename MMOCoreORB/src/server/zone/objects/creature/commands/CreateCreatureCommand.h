@@ -54,6 +54,10 @@ public:
 				creature->sendSystemMessage("Current number of scheduled AiMoveEvents retreating: " + String::valueOf(AiMap::instance()->moveEventsRetreating.get()));
 				creature->sendSystemMessage("Current number of AiAwarenessEvents: " + String::valueOf(AiMap::instance()->activeAwarenessEvents.get()));
 				creature->sendSystemMessage("Current number of scheduled AiAwarenessEvents: " + String::valueOf(AiMap::instance()->scheduledAwarenessEvents.get()));
+				creature->sendSystemMessage("Zone awareness passes run: " + String::valueOf(AiMap::instance()->awarenessPasses.get()));
+				creature->sendSystemMessage("Awareness candidate wakeups: " + String::valueOf(AiMap::instance()->awarenessCandidateWakeups.get()));
+				creature->sendSystemMessage("Awareness wakeups avoided by radius: " + String::valueOf(AiMap::instance()->awarenessWakeupsAvoided.get()));
+				creature->sendSystemMessage("Per move awareness wakeups skipped: " + String::valueOf(AiMap::instance()->awarenessMoveWakeupsSkipped.get()));
 				creature->sendSystemMessage("Current number of AiRecoveryEvents: " + String::valueOf(AiMap::instance()->activeRecoveryEvents.get()));
 				creature->sendSystemMessage("Current number of AiWaitEvents: " + String::valueOf(AiMap::instance()->activeWaitEvents.get()));
 
@@ -6,6 +6,7 @@
 #define GETATTRIBUTESBATCHCOMMAND_H_
 
 #include "server/zone/objects/scene/SceneObject.h"
+#include "server/zone/objects/scene/AttributeListCache.h"
 #include "server/zone/packets/scene/AttributeListMessage.h"
 #include "server/zone/Zone.h"
 
@@ -90,7 +91,7 @@ public:
 	}
 
 	void sendAttributes(CreatureObject* creature, SceneObject* object, int incr) const {
-		object->sendAttributeListTo(creature);
+		AttributeListCache::instance()->sendAttributeListTo(object, creature);
 
 		creature->notifyObservers(ObserverEventType::GETATTRIBUTESBATCHCOMMAND, object, incr);
 	}
@@ -59,6 +59,9 @@ public:
 			} else if(command == "ghdump") {
 				ghDump(creature, &args);
 
+			} else if(command == "heatmap") {
+				exportHeatmap(creature, &args);
+
 			} else {
 				throw Exception();
 			}
@@ -73,6 +76,7 @@ public:
 			creature->sendSystemMessage("		find <class> <attribute> <gt|lt> <value> [<and|or> <attribute> <gt|lt> <value> [...]]");
 			creature->sendSystemMessage("		create <name> [quantity] : Spawns resource in inventory");
 			creature->sendSystemMessage("       ghdump : Updates the Galaxy Harvester output file");
+			creature->sendSystemMessage("		heatmap <resource name> [planet] [cell size] : Writes density heatmaps to log/heatmap_<resource>_<planet>.csv");
 		}
 
 		return SUCCESS;
@@ -120,6 +124,31 @@ public:
 		creature->sendSystemMessage(resMan->ghDump());
 	}
 
+	void exportHeatmap(CreatureObject* creature, StringTokenizer* args) const {
+		if(creature->getZoneServer() == nullptr)
+			return;
+
+		String resourceName = "";
+		String planet = "";
+		int cellSize = 64;
+
+		if(args->hasMoreTokens())
+			args->getStringToken(resourceName);
+
+		if(resourceName.isEmpty())
+			throw Exception();
+
+		if(args->hasMoreTokens())
+			args->getStringToken(planet);
+
+		if(args->hasMoreTokens())
+			cellSize = args->getIntToken();
+
+		ResourceManager* resMan = creature->getZoneServer()->getResourceManager();
+
+		creature->sendSystemMessage(resMan->exportDensityHeatmap(resourceName, planet, cellSize));
+	}
+
 	void despawnResource(CreatureObject* creature, StringTokenizer* args) const {
 		if(creature->getZoneServer() == nullptr)
 			return;
@@ -27,7 +27,7 @@ int LuaSkill::_setObject(lua_State* L) {
 }
 
 int LuaSkill::getName(lua_State* L) {
-	String text = realObject->getSkillName();
+	const String& text = realObject->getSkillName();
 	lua_pushstring(L, text.toCharArray());
 	return 1;
 }
@@ -63,7 +63,7 @@ int LuaSkill::getSkillsRequired(lua_State* L) {
 }
 
 int LuaSkill::getXpType(lua_State* L) {
-	String text = realObject->getXpType();
+	const String& text = realObject->getXpType();
 	lua_pushstring(L, text.toCharArray());
 	return 1;
 }
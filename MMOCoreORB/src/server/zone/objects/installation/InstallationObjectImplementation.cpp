@@ -29,6 +29,7 @@
 #include "templates/params/OptionBitmask.h"
 #include "templates/params/creature/CreatureFlag.h"
 #include "server/zone/objects/creature/ai/AiAgent.h"
+#include "server/zone/objects/scene/BaselineCache.h"
 
 void InstallationObjectImplementation::loadTemplateData(SharedObjectTemplate* templateData) {
 	StructureObjectImplementation::loadTemplateData(templateData);
@@ -45,10 +46,13 @@ void InstallationObjectImplementation::loadTemplateData(SharedObjectTemplate* te
 void InstallationObjectImplementation::sendBaselinesTo(SceneObject* player) {
 	//send buios here
 
-	BaseMessage* buio3 = new InstallationObjectMessage3(_this.getReferenceUnsafeStaticCast());
+	InstallationObject* installation = _this.getReferenceUnsafeStaticCast();
+	BaselineCache* baselineCache = BaselineCache::instance();
+
+	BasePacket* buio3 = baselineCache->get(asSceneObject(), 3, [installation] () { return new InstallationObjectMessage3(installation); });
 	player->sendMessage(buio3);
 
-	BaseMessage* buio6 = new InstallationObjectMessage6(_this.getReferenceUnsafeStaticCast());
+	BasePacket* buio6 = baselineCache->get(asSceneObject(), 6, [installation] () { return new InstallationObjectMessage6(installation); });
 	player->sendMessage(buio6);
 
 
@@ -91,7 +95,7 @@ void InstallationObjectImplementation::setOperating(bool value, bool notifyClien
 		if(currentSpawn == nullptr)
 			return;
 
-		spawnDensity = currentSpawn->getDensityAt(getZone()->getZoneName(), getPositionX(), getPositionY());
+		spawnDensity = getResourceDensity(currentSpawn);
 
 		if(spawnDensity < .10) {
 			return;
@@ -155,6 +159,38 @@ void InstallationObjectImplementation::setOperating(bool value, bool notifyClien
 	broadcastToOperators(inso7);
 }
 
+float InstallationObjectImplementation::getResourceDensity(ResourceSpawn* spawn) {
+	Zone* zone = getZone();
+
+	if (spawn == nullptr || zone == nullptr)
+		return 0;
+
+	uint64 spawnID = spawn->getObjectID();
+
+	Locker locker(&resourceDensityMutex);
+
+	if (!spawn->inShift()) {
+		resourceDensityCache.drop(spawnID);
+
+		return 0;
+	}
+
+	int index = resourceDensityCache.find(spawnID);
+
+	if (index != -1)
+		return resourceDensityCache.elementAt(index).getValue();
+
+	// a harvester only ever sees the few dozen spawns of its type, old shifts age out here
+	if (resourceDensityCache.size() > 64)
+		resourceDensityCache.removeAll();
+
+	float density = spawn->getDensityAt(zone->getZoneName(), getPositionX(), getPositionY());
+
+	resourceDensityCache.put(spawnID, density);
+
+	return density;
+}
+
 void InstallationObjectImplementation::setActiveResource(ResourceContainer* container) {
 
 	Time timeToWorkTill;
@@ -163,7 +199,7 @@ void InstallationObjectImplementation::setActiveResource(ResourceContainer* cont
 		addResourceToHopper(container);
 		currentSpawn = container->getSpawnObject();
 
-		spawnDensity = currentSpawn->getDensityAt(getZone()->getZoneName(), getPositionX(), getPositionY());
+		spawnDensity = getResourceDensity(currentSpawn);
 
 		return;
 	}
@@ -192,7 +228,7 @@ void InstallationObjectImplementation::setActiveResource(ResourceContainer* cont
 				resourceHopper.remove(i, inso7, 0);
 
 			currentSpawn = container->getSpawnObject();
-			spawnDensity = currentSpawn->getDensityAt(getZone()->getZoneName(), getPositionX(), getPositionY());
+			spawnDensity = getResourceDensity(currentSpawn);
 
 			inso7->updateHopperSize(getHopperSize());
 			inso7->updateExtractionRate(getActualRate());
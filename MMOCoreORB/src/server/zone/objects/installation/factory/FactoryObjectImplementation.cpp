@@ -7,6 +7,7 @@
 
 #include "server/zone/objects/installation/factory/FactoryObject.h"
 #include "server/zone/objects/installation/factory/FactoryHopperObserver.h"
+#include "server/zone/objects/installation/factory/FactoryProductionModel.h"
 #include "sui/InsertSchematicSuiCallback.h"
 #include "tasks/CreateFactoryObjectTask.h"
 #include "server/zone/ZoneProcessServer.h"
@@ -25,6 +26,8 @@
 #include "templates/installation/FactoryObjectTemplate.h"
 #include "server/zone/objects/transaction/TransactionLog.h"
 
+#include <limits>
+
 void FactoryObjectImplementation::loadTemplateData(SharedObjectTemplate* templateData) {
 	InstallationObjectImplementation::loadTemplateData(templateData);
 
@@ -41,8 +44,9 @@ void FactoryObjectImplementation::notifyLoadFromDatabase() {
 
 	setLoggingName("FactoryObject");
 
+	// resume from the persisted production time so output made before the restart is settled on the first run
 	if (operating) {
-		startFactory();
+		startFactory(true);
 	}
 
 	hopperObserver = new FactoryHopperObserver(_this.getReferenceUnsafeStaticCast());
@@ -251,6 +255,12 @@ void FactoryObjectImplementation::sendOutputHopper(CreatureObject* player) {
 		return;
 	}
 
+	if (operating) {
+		Locker clocker(_this.getReferenceUnsafeStaticCast(), player);
+
+		updateProduction();
+	}
+
 	outputHopper->sendWithoutContainerObjectsTo(player);
 	outputHopper->openContainerTo(player);
 	outputHopper->notifyObservers(ObserverEventType::OPENCONTAINER, player);
@@ -404,14 +414,17 @@ void FactoryObjectImplementation::handleOperateToggle(CreatureObject* player) {
 
 		}
 	} else {
+		updateProduction();
+
+		if (operating)
+			stopFactory("manf_done", getDisplayedName(), "", currentRunCount);
 
-		stopFactory("manf_done", getDisplayedName(), "", currentRunCount);
 		player->sendSystemMessage("@manf_station:deactivated"); //Station deactivated
 		currentUserName = "";
 	}
 }
 
-bool FactoryObjectImplementation::startFactory() {
+bool FactoryObjectImplementation::startFactory(bool resume) {
 	if (getContainerObjectsSize() == 0) {
 		return false;
 	}
@@ -441,7 +454,12 @@ bool FactoryObjectImplementation::startFactory() {
 	if(!populateSchematicBlueprint(schematic))
 		return false;
 
-	// Add sampletask
+	if (!resume) {
+		lastProductionTime.updateToCurrentTime();
+		productionOffset = 0;
+	}
+
+	// Output is settled lazily, the task only wakes up for the first item and then for stops and full crates
 	Reference<CreateFactoryObjectTask* > createFactoryObjectTask = new CreateFactoryObjectTask(_this.getReferenceUnsafeStaticCast());
 	addPendingTask("createFactoryObject", createFactoryObjectTask, timer * 1000);
 
@@ -521,8 +539,15 @@ void FactoryObjectImplementation::stopFactory(String &type, String &displayedNam
 }
 
 void FactoryObjectImplementation::createNewObject() {
+	updateProduction();
+}
+
+void FactoryObjectImplementation::updateProduction() {
 
 	/// Pre: _this.getReferenceUnsafeStaticCast() locked
+	if (!operating)
+		return;
+
 	if (getContainerObjectsSize() == 0) {
 		stopFactory("manf_error", "", "", -1);
 		return;
@@ -544,94 +569,172 @@ void FactoryObjectImplementation::createNewObject() {
 		return;
 	}
 
-	/// Shutdown when out of power or maint
-	Time timeToWorkTill;
-	bool shutdownAfterWork = updateMaintenance(timeToWorkTill);
+	ManagedReference<SceneObject*> outputHopper = getSlottedObject("output_hopper");
 
-	if(shutdownAfterWork) {
+	if (outputHopper == nullptr) {
+		stopFactory("manf_error_6", "", "", -1);
+		return;
+	}
 
-		Time currentTime;
+	verifyOperators();
 
-		float elapsedTime = (currentTime.getTime() - lastMaintenanceTime.getTime());
+	Time currentTime;
 
-		float energyAmount = (elapsedTime / 3600.0) * getBasePowerRate();
-		if (energyAmount > surplusPower) {
-			stopFactory("manf_no_power", getDisplayedName(), "", -1);
-			return;
-		}
+	FactoryProductionModel model;
+	model.cycleTime = timer;
+	model.cycleOffset = productionOffset;
+	model.elapsed = currentTime.getTime() - lastProductionTime.getTime();
+	model.chargeStart = lastMaintenanceTime.getTime() - lastProductionTime.getTime();
+	model.surplusPower = surplusPower;
+	model.powerRate = getBasePowerRate();
+	model.surplusMaintenance = surplusMaintenance;
+	model.maintenanceRate = getMaintenanceRate();
+	model.ingredientRuns = schematic->getAvailableRuns();
+	model.manufactureLimit = schematic->getManufactureLimit();
+	model.crateSize = CRATESIZE;
 
-		stopFactory("manf_done_sub", "", "", -1);
-		return;
-	}
+	// room in crates of this item plus a crate per free slot
+	int freeSlots = Math::max(0, (int) outputHopper->getContainerVolumeLimit() - outputHopper->getContainerObjectsSize());
+	int outputCapacity = 0;
 
-	verifyOperators();
+	if (CRATESIZE > 1) {
+		FactoryCrate* openCrate = locateCrateInOutputHopper(prototype);
 
-	String type = "";
-	String displayedName = "";
+		if (openCrate != nullptr)
+			model.crateSpace = openCrate->getMaxCapacity() - openCrate->getUseCount();
 
-	schematic->canManufactureItem(type, displayedName);
+		for (int i = 0; i < outputHopper->getContainerObjectsSize(); ++i) {
+			ManagedReference<SceneObject*> object = outputHopper->getContainerObject(i);
 
-	if (displayedName != "") {
-		stopFactory(type, displayedName);
-		return;
-	}
+			if (object == nullptr || !object->isFactoryCrate())
+				continue;
 
-	//int crateSize = schematic->getFactoryCrateSize();
-	int crateSize = 1000;
+			FactoryCrate* crate = cast<FactoryCrate*>(object.get());
 
-	if (crateSize <= 0) {
-		stopFactory("manf_error", "", "", -1);
-		return;
+			if (crate->getPrototype() != nullptr && crate->getPrototype()->getSerialNumber() == prototype->getSerialNumber())
+				outputCapacity += Math::max(0, crate->getMaxCapacity() - crate->getUseCount());
+		}
+
+		outputCapacity += Math::min(freeSlots, (std::numeric_limits<int>::max() - outputCapacity) / CRATESIZE) * CRATESIZE;
+	} else {
+		outputCapacity = freeSlots;
 	}
 
-	if (crateSize > 1) {
-		String crateType = schematic->getFactoryCrateType();
+	model.outputCapacity = outputCapacity;
 
-		ManagedReference<FactoryCrate*> crate = locateCrateInOutputHopper(prototype);
+	model.run();
 
-		if (crate == nullptr)
-			crate = createNewFactoryCrate(prototype, crateSize, crateType);
-		else {
-			Locker clocker(crate, _this.getReferenceUnsafeStaticCast());
-			crate->setUseCount(crate->getUseCount() + 1, false);
+	/// Pay upkeep for the whole period like every cycle used to
+	Time timeToWorkTill;
+	updateMaintenance(timeToWorkTill);
 
-			FactoryCrateObjectDeltaMessage3* dfcty3 = new FactoryCrateObjectDeltaMessage3(crate);
-			dfcty3->setQuantity(crate->getUseCount());
-			dfcty3->close();
+	int produced = model.getProduced();
 
-			broadcastToOperators(dfcty3);
-		}
+	if (produced > 0) {
+		produced = storeProducedItems(prototype, schematic->getFactoryCrateType(), produced);
 
-		if (crate == nullptr) {
-			return;
+		if (produced > 0) {
+			Locker clocker(schematic, _this.getReferenceUnsafeStaticCast());
+
+			schematic->manufactureItem(_this.getReferenceUnsafeStaticCast(), produced);
+			currentRunCount += produced;
 		}
-	} else {
-		ManagedReference<TangibleObject*> newItem = createNewUncratedItem(prototype);
 
-		if (newItem == nullptr)
+		// storing stops the factory itself when the hopper turned out to be full
+		if (!operating)
 			return;
 	}
 
-	Locker clocker(schematic, _this.getReferenceUnsafeStaticCast());
+	switch (model.getStopReason()) {
+	case FactoryProductionModel::LIMIT_REACHED: {
+		Locker clocker(schematic, _this.getReferenceUnsafeStaticCast());
 
-	schematic->manufactureItem(_this.getReferenceUnsafeStaticCast());
-	currentRunCount++;
-
-	if (schematic->getManufactureLimit() < 1) {
 		schematic->destroyObjectFromWorld(true);
 		schematic->destroyObjectFromDatabase(true);
 		stopFactory("manf_done", getDisplayedName(), "", currentRunCount);
 		return;
 	}
+	case FactoryProductionModel::OUT_OF_POWER:
+		stopFactory("manf_no_power", getDisplayedName(), "", -1);
+		return;
+	case FactoryProductionModel::OUT_OF_MAINTENANCE:
+		stopFactory("manf_done_sub", "", "", -1);
+		return;
+	case FactoryProductionModel::OUT_OF_INGREDIENTS: {
+		String type = "";
+		String displayedName = "";
+
+		schematic->canManufactureItem(type, displayedName);
+		stopFactory(type, displayedName);
+		return;
+	}
+	case FactoryProductionModel::OUTPUT_FULL:
+		stopFactory("manf_output_hopper_full", getDisplayedName(), "", -1);
+		return;
+	default:
+		break;
+	}
+
+	lastProductionTime = currentTime;
+	productionOffset = model.getNextOffset();
 
 	Reference<Task*> pending = getPendingTask("createFactoryObject");
 
 	if (pending != nullptr)
-		pending->reschedule(timer * 1000);
+		pending->reschedule(Math::max(1, model.getNextEvent()) * 1000);
 	else
 		stopFactory("manf_error", "", "", -1);
 }
 
+int FactoryObjectImplementation::storeProducedItems(TangibleObject* prototype, const String& crateType, int count) {
+	int stored = 0;
+
+	if (CRATESIZE <= 1) {
+		for (; stored < count; ++stored) {
+			ManagedReference<TangibleObject*> newItem = createNewUncratedItem(prototype);
+
+			if (newItem == nullptr)
+				break;
+		}
+
+		return stored;
+	}
+
+	String type = crateType;
+
+	while (stored < count) {
+		ManagedReference<FactoryCrate*> crate = locateCrateInOutputHopper(prototype);
+
+		if (crate == nullptr) {
+			crate = createNewFactoryCrate(prototype, CRATESIZE, type);
+
+			if (crate == nullptr)
+				break;
+
+			// a new crate already holds one item
+			++stored;
+		}
+
+		Locker clocker(crate, _this.getReferenceUnsafeStaticCast());
+
+		int amount = Math::min(count - stored, crate->getMaxCapacity() - crate->getUseCount());
+
+		if (amount <= 0)
+			continue;
+
+		crate->setUseCount(crate->getUseCount() + amount, false);
+		stored += amount;
+
+		FactoryCrateObjectDeltaMessage3* dfcty3 = new FactoryCrateObjectDeltaMessage3(crate);
+		dfcty3->setQuantity(crate->getUseCount());
+		dfcty3->close();
+
+		broadcastToOperators(dfcty3);
+	}
+
+	return stored;
+}
+
 FactoryCrate* FactoryObjectImplementation::locateCrateInOutputHopper(TangibleObject* prototype) {
 
 	ManagedReference<SceneObject*> outputHopper = getSlottedObject("output_hopper");
@@ -0,0 +1,208 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef FACTORYPRODUCTIONMODEL_H_
+#define FACTORYPRODUCTIONMODEL_H_
+
+#include "system/lang.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace installation {
+namespace factory {
+
+/**
+ * Closed form of the factory manufacturing loop. A running factory finishes
+ * one item every cycleTime seconds; every cycle used to be a task run that
+ * paid upkeep, checked ingredients and output space and bumped a crate. Given
+ * the state at the last settlement this computes how many of those cycles
+ * would have completed by now, and if the factory would have stopped, when
+ * and why. The checks run in the same order as the old per cycle code.
+ *
+ * All times are seconds relative to the last settlement.
+ */
+class FactoryProductionModel {
+public:
+	enum StopReason {
+		RUNNING,
+		OUT_OF_POWER,
+		OUT_OF_MAINTENANCE,
+		OUT_OF_INGREDIENTS,
+		OUTPUT_FULL,
+		LIMIT_REACHED
+	};
+
+	int cycleTime;
+
+	// seconds of the current cycle already worked at the last settlement
+	int cycleOffset;
+
+	int elapsed;
+
+	// upkeep is paid up to this time, usually at or before 0
+	int chargeStart;
+
+	float surplusPower;
+	float powerRate;
+	float surplusMaintenance;
+	float maintenanceRate;
+
+	int ingredientRuns;
+	int manufactureLimit;
+	int outputCapacity;
+
+	// items the open crate still takes, 0 when a new crate is needed
+	int crateSpace;
+	int crateSize;
+
+protected:
+	int produced;
+	int stopReason;
+	int stopTime;
+	int nextOffset;
+	int nextEvent;
+
+	int getTickTime(int tick) const {
+		return tick * cycleTime - cycleOffset;
+	}
+
+	static bool canPay(int seconds, float rate, float surplus) {
+		float amount = (seconds / 3600.0) * rate;
+
+		return !(amount > surplus);
+	}
+
+	bool isPowerFunded(int tick) const {
+		if (powerRate == 0)
+			return true;
+
+		return canPay(Math::max(0, getTickTime(tick) - chargeStart), powerRate, surplusPower);
+	}
+
+	bool isMaintenanceFunded(int tick) const {
+		return canPay(Math::max(0, getTickTime(tick) - chargeStart), maintenanceRate, surplusMaintenance);
+	}
+
+	bool isFunded(int tick) const {
+		return isPowerFunded(tick) && isMaintenanceFunded(tick);
+	}
+
+	/**
+	 * Last tick in [0, limit] upkeep still covers, upkeep only grows with time
+	 */
+	int getFundedTicks(int limit) const {
+		int low = 0;
+		int high = limit;
+
+		while (low < high) {
+			int mid = low + (high - low + 1) / 2;
+
+			if (isFunded(mid))
+				low = mid;
+			else
+				high = mid - 1;
+		}
+
+		return low;
+	}
+
+public:
+	FactoryProductionModel() : cycleTime(1), cycleOffset(0), elapsed(0), chargeStart(0),
+		surplusPower(0), powerRate(0), surplusMaintenance(0), maintenanceRate(0),
+		ingredientRuns(0), manufactureLimit(0), outputCapacity(0), crateSpace(0), crateSize(1),
+		produced(0), stopReason(RUNNING), stopTime(0), nextOffset(0), nextEvent(0) {
+	}
+
+	void run() {
+		if (cycleTime < 1)
+			cycleTime = 1;
+
+		// the limit is checked after an item is made, so a spent schematic still makes one
+		int limit = Math::max(manufactureLimit, 1);
+		int stock = Math::min(Math::max(ingredientRuns, 0), Math::max(outputCapacity, 0));
+		int ticksDue = (Math::max(elapsed, 0) + cycleOffset) / cycleTime;
+
+		// first tick that fails its checks, and the tick the factory stops at
+		int funded = getFundedTicks(stock < limit ? stock + 1 : limit);
+		int failTick = Math::min(funded, stock) + 1;
+		int stopTick = Math::min(limit, failTick);
+
+		if (stopTick <= ticksDue) {
+			stopTime = getTickTime(stopTick);
+
+			if (limit < failTick) {
+				produced = limit;
+				stopReason = LIMIT_REACHED;
+			} else {
+				produced = failTick - 1;
+
+				if (!isFunded(failTick))
+					stopReason = isPowerFunded(failTick) ? OUT_OF_MAINTENANCE : OUT_OF_POWER;
+				else if (failTick > ingredientRuns)
+					stopReason = OUT_OF_INGREDIENTS;
+				else
+					stopReason = OUTPUT_FULL;
+			}
+
+			nextOffset = 0;
+			nextEvent = 0;
+
+			return;
+		}
+
+		produced = ticksDue;
+		stopReason = RUNNING;
+		stopTime = 0;
+		nextOffset = (Math::max(elapsed, 0) + cycleOffset) % cycleTime;
+
+		// wake up for the stop, or to hand out the next full crate, whichever comes first
+		int eventTick = stopTick;
+
+		if (crateSize > 1) {
+			int fillTick = crateSpace > ticksDue ? crateSpace : crateSpace + ((ticksDue - crateSpace) / crateSize + 1) * crateSize;
+
+			eventTick = Math::min(eventTick, fillTick);
+		}
+
+		nextEvent = getTickTime(eventTick) - elapsed;
+	}
+
+	int getProduced() const {
+		return produced;
+	}
+
+	int getStopReason() const {
+		return stopReason;
+	}
+
+	bool isStopped() const {
+		return stopReason != RUNNING;
+	}
+
+	int getStopTime() const {
+		return stopTime;
+	}
+
+	int getNextOffset() const {
+		return nextOffset;
+	}
+
+	/**
+	 * Seconds from now until the next tick that changes what the factory shows
+	 */
+	int getNextEvent() const {
+		return nextEvent;
+	}
+};
+
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::installation::factory;
+
+#endif /* FACTORYPRODUCTIONMODEL_H_ */
@@ -110,6 +110,14 @@ bool BlueprintEntry::hasEnoughResources() {
 	if(inputHopper == nullptr)
 		return false;
 
+	return getAvailableQuantity() >= quantity;
+}
+
+int BlueprintEntry::getAvailableQuantity() {
+
+	if(inputHopper == nullptr)
+		return 0;
+
 	int count = 0;
 
 	for(int i = 0; i < matchingHopperItems.size(); ++i) {
@@ -129,14 +137,12 @@ bool BlueprintEntry::hasEnoughResources() {
 		count += (useCount == 0 ? 1 : useCount);
 	}
 
-	if(count >= quantity)
-		return true;
-
-	return false;
+	return count;
 }
 
-void BlueprintEntry::removeResources(FactoryObject* factory) {
+void BlueprintEntry::removeResources(FactoryObject* factory, int runs) {
 	int count = 0;
+	int totalNeeded = quantity * runs;
 
 	while(matchingHopperItems.size() > 0) {
 		TangibleObject* object = matchingHopperItems.get(0);
@@ -148,7 +154,7 @@ void BlueprintEntry::removeResources(FactoryObject* factory) {
 		if(useCount == 0)
 			useCount = 1;
 
-		int amountNeeded = quantity - count;
+		int amountNeeded = totalNeeded - count;
 
 		if(useCount < amountNeeded) {
 			count += useCount;
@@ -94,8 +94,11 @@ public:
 	/// See if this entry has enough resources to continue
 	bool hasEnoughResources();
 
-	/// Remove resources from vector
-	void removeResources(FactoryObject* factory);
+	/// Units of this entry in the input hopper
+	int getAvailableQuantity();
+
+	/// Remove resources for a number of runs from vector
+	void removeResources(FactoryObject* factory, int runs = 1);
 
 	/// Print internal state
 	void print();
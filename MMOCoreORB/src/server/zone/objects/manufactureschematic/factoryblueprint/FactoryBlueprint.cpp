@@ -8,6 +8,8 @@
 #include "FactoryBlueprint.h"
 #include "server/zone/objects/installation/factory/FactoryObject.h"
 
+#include <limits>
+
 FactoryBlueprint::FactoryBlueprint() :  Serializable() {
 
 	addSerializableVariables();
@@ -121,15 +123,33 @@ void FactoryBlueprint::canManufactureItem(String &type, String &displayedName) {
 	}
 }
 
-void FactoryBlueprint::manufactureItem(FactoryObject* factory) {
+void FactoryBlueprint::manufactureItem(FactoryObject* factory, int count) {
 
 	for(int i = 0; i < consolidatedEntries.size(); ++i) {
 		BlueprintEntry* entry = &consolidatedEntries.get(i);
 
-		entry->removeResources(factory);
+		entry->removeResources(factory, count);
 	}
 }
 
+int FactoryBlueprint::getAvailableRuns() {
+	int runs = std::numeric_limits<int>::max();
+
+	for(int i = 0; i < consolidatedEntries.size(); ++i) {
+		BlueprintEntry* entry = &consolidatedEntries.get(i);
+
+		if(entry->getQuantity() <= 0)
+			continue;
+
+		if(!entry->hasEnoughResources())
+			return 0;
+
+		runs = Math::min(runs, entry->getAvailableQuantity() / entry->getQuantity());
+	}
+
+	return runs;
+}
+
 void FactoryBlueprint::addSerializableVariables() {
 	addSerializableVariable("completeEntries", &completeEntries);
 	addSerializableVariable("consolidatedEntries", &consolidatedEntries);
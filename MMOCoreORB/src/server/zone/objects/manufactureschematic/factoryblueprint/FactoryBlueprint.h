@@ -38,7 +38,10 @@ public:
 
 	void canManufactureItem(String &type, String &displayedName);
 
-	void manufactureItem(FactoryObject* factory);
+	void manufactureItem(FactoryObject* factory, int count = 1);
+
+	/// Items the input hopper has ingredients for
+	int getAvailableRuns();
 
 	void addSerializableVariables();
 
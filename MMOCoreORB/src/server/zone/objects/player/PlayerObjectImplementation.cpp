@@ -74,6 +74,7 @@
 #include "server/chat/PendingMessageList.h"
 #include "server/zone/managers/director/DirectorManager.h"
 #include "server/db/ServerDatabase.h"
+#include "server/db/WriteBehindBatcher.h"
 #include "server/ServerCore.h"
 #ifdef WITH_SESSION_API
 #include "server/login/SessionAPIClient.h"
@@ -124,12 +125,16 @@ void PlayerObjectImplementation::checkPendingMessages() {
 		for (uint64 messageID : pendingMessages) {
 			ManagedReference<PersistentMessage*> mail = Core::getObjectBroker()->lookUp(messageID).castTo<PersistentMessage*>();
 
-			if (mail != nullptr && isIgnoring(mail->getSenderName())) {
+			if (mail == nullptr)
+				continue;
+
+			if (isIgnoring(mail->getSenderName())) {
 				objectManager->destroyObjectFromDatabase(mail->getObjectID());
 				continue;
 			}
 
-			persistentMessages.put(messageID);
+			MailHeader header(mail);
+			addPersistentMessage(messageID, header);
 		}
 
 		messageList->clearPendingMessages();
@@ -1572,37 +1577,49 @@ void PlayerObjectImplementation::logSessionStats(bool isSessionEnd) {
 
 	// Need the session_stats table to log to database
 	if (ServerCore::getSchemaVersion() >= 1003) {
-		StringBuffer query;
-
-		query << "INSERT INTO `session_stats` ("
-			<< "`uptime`, `account_id`, `galaxy_id`, `character_oid`, `ip`, `session_end`"
-			<< ", `session_seconds`, `delta_seconds`, `delta_credits`, `delta_skillpoints`"
-			<< ", `activity_xp`, `activity_movement`, `current_credits`, `ip_account_count`"
-			<< ") VALUES"
-			<< " (" << (int)(uptime / 1000.0f)
-			<< ", " << getAccountID()
-			<< ", " << galaxyID
-			<< ", " << objectID
-			<< ", '" << sessionStatsIPAddress << "'"
-			<< ", " << isSessionEnd
-			<< ", " << (int)(miliSecsSession / 1000.0f)
-			<< ", " << (int)(sessionStatsMiliSecs / 1000.0f)
-			<< ", " << creditsDelta
-			<< ", " << skillPointDelta
-			<< ", " << sessionStatsActivityXP
-			<< ", " << sessionStatsActivityMovement
-			<< ", " << currentCredits
-			<< ", " << ipAccountCount
-			<< ");"
-			;
+		const static String prefix = "INSERT INTO `session_stats` ("
+			"`uptime`, `account_id`, `galaxy_id`, `character_oid`, `ip`, `session_end`"
+			", `session_seconds`, `delta_seconds`, `delta_credits`, `delta_skillpoints`"
+			", `activity_xp`, `activity_movement`, `current_credits`, `ip_account_count`"
+			") VALUES";
+
+		PreparedStatement row("(?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)");
+
+		row.bindInt((int)(uptime / 1000.0f))
+			.bindUnsigned(getAccountID())
+			.bindInt(galaxyID)
+			.bindUnsigned(objectID)
+			.bindString(sessionStatsIPAddress)
+			.bindInt(isSessionEnd)
+			.bindInt((int)(miliSecsSession / 1000.0f))
+			.bindInt((int)(sessionStatsMiliSecs / 1000.0f))
+			.bindInt(creditsDelta)
+			.bindInt(skillPointDelta)
+			.bindInt(sessionStatsActivityXP)
+			.bindInt(sessionStatsActivityMovement)
+			.bindInt(currentCredits)
+			.bindInt(ipAccountCount);
+
+		bool writeThrough = false;
 
-		Core::getTaskManager()->executeTask([=] () {
-			try {
-				ServerDatabase::instance()->executeStatement(query);
-			} catch(DatabaseException& e) {
-				error(e.getMessage());
-			}
-		}, "logSessionStats");
+#ifdef WITH_SESSION_API
+		// the session api reads the row back right after login and logout
+		writeThrough = isSessionEnd || miliSecsSession == 0;
+#endif // WITH_SESSION_API
+
+		if (writeThrough) {
+			String query = prefix + " " + row.toString() + ";";
+
+			Core::getTaskManager()->executeTask([=] () {
+				try {
+					ServerDatabase::instance()->executeStatement(query);
+				} catch(DatabaseException& e) {
+					error(e.getMessage());
+				}
+			}, "logSessionStats");
+		} else {
+			WriteBehindBatcher::instance()->add(prefix, row);
+		}
 	} else {
 		StringBuffer logMsg;
 
@@ -2622,6 +2639,23 @@ void PlayerObjectImplementation::destroyObjectFromDatabase(bool destroyContained
 	}
 }
 
+void PlayerObjectImplementation::addPersistentMessage(uint64 id, MailHeader& header) {
+	persistentMessages.put(id);
+	mailHeaders.put(id, header);
+}
+
+void PlayerObjectImplementation::setMailHeader(uint64 id, MailHeader& header) {
+	if (persistentMessages.contains(id))
+		mailHeaders.put(id, header);
+}
+
+void PlayerObjectImplementation::setPersistentMessageStatus(uint64 id, byte status) {
+	int pos = mailHeaders.find(id);
+
+	if (pos != -1)
+		mailHeaders.elementAt(pos).getValue().setStatus(status);
+}
+
 void PlayerObjectImplementation::deleteAllPersistentMessages() {
 	for (int i = persistentMessages.size() - 1; i >= 0; --i) {
 		uint64 messageObjectID = persistentMessages.get(i);
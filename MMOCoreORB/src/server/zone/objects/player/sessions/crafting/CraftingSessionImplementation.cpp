@@ -736,6 +736,7 @@ void CraftingSessionImplementation::initialAssembly(int clientCounter) {
 
 	// Update the prototype with new values
 	prototype->updateCraftingValues(craftingValues, true);
+	prototype->incrementAttributeListVersion();
 
 	addSkillMods();
 
@@ -961,6 +962,7 @@ void CraftingSessionImplementation::experiment(int rowsAttempted, const String&
 
 	// Update the Tano with new values
 	prototype->updateCraftingValues(manufactureSchematic->getCraftingValues(), false);
+	prototype->incrementAttributeListVersion();
 
 	// Sets the result for display
 	experimentationResult = lowestExpSuccess;
@@ -1057,6 +1059,7 @@ void CraftingSessionImplementation::customization(const String& name, byte templ
 
 				prototype->loadTemplateData(newTemplate);
 				prototype->updateCraftingValues(manufactureSchematic->getCraftingValues(), false);
+				prototype->incrementAttributeListVersion();
 
 				prototype->sendDestroyTo(crafter);
 				prototype->sendTo(crafter, true);
@@ -650,7 +650,7 @@ String CityRegionImplementation::getRegionDisplayedName() {
 	if(!customRegionName.isEmpty())
 		return customRegionName;
 
-	return StringIdManager::instance()->getStringId(regionName.getFullPath().hashCode()).toString();
+	return StringIdManager::instance()->getStringIdAsString(regionName.getFullPath().hashCode());
 }
 
 bool CityRegionImplementation::hasUniqueStructure(uint32 crc) {
@@ -202,6 +202,36 @@ float ResourceSpawnImplementation::getDensityAt(const String& zoneName, float x,
 	return map.getDensityAt(x, y);
 }
 
+void ResourceSpawnImplementation::getDensityGrid(const String& zoneName, float startX, float startY, float spacing, int columns, int rows, Vector<float>& densities) const {
+	densities.removeAll(columns * rows, 1);
+
+	if (inShift() && spawnMaps.contains(zoneName)) {
+		const SpawnDensityMap map = spawnMaps.get(zoneName);
+
+		map.getDensityGrid(startX, startY, spacing, columns, rows, densities);
+
+		return;
+	}
+
+	for (int i = 0; i < columns * rows; ++i)
+		densities.add(0);
+}
+
+bool ResourceSpawnImplementation::getSpawnMapBounds(const String& zoneName, Vector<float>& bounds) const {
+	if (!spawnMaps.contains(zoneName))
+		return false;
+
+	const SpawnDensityMap map = spawnMaps.get(zoneName);
+
+	bounds.removeAll(4, 1);
+	bounds.add(map.getMinX());
+	bounds.add(map.getMaxX());
+	bounds.add(map.getMinY());
+	bounds.add(map.getMaxY());
+
+	return true;
+}
+
 String ResourceSpawnImplementation::getSpawnMapZone(int i) const {
 	if (spawnMaps.size() > i)
 		return spawnMaps.getKey(i);
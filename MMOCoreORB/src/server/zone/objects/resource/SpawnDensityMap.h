@@ -114,6 +114,42 @@ public:
 		return value * density;
 	}
 
+	/**
+	 * Densities for a grid of columns x rows points, row r and column c sit at
+	 * (startX + c * spacing, startY - r * spacing), the survey tool layout.
+	 * Values are appended row by row to densities.
+	 */
+	void getDensityGrid(float startX, float startY, float spacing, int columns, int rows, Vector<float>& densities) const {
+		float z = seed * modifier;
+
+		for (int r = 0; r < rows; ++r) {
+			float y = (maxY - (startY - r * spacing)) * modifier;
+
+			for (int c = 0; c < columns; ++c) {
+				float x = ((startX + c * spacing) - minX) * modifier;
+				float value = SimplexNoise::noise(x, y, z);
+
+				densities.add(value < 0 ? 0 : value * density);
+			}
+		}
+	}
+
+	inline float getMinX() const {
+		return minX;
+	}
+
+	inline float getMaxX() const {
+		return maxX;
+	}
+
+	inline float getMinY() const {
+		return minY;
+	}
+
+	inline float getMaxY() const {
+		return maxY;
+	}
+
 	void print() const {
 		System::out << "Seed: " << seed << " Modifier: "
 				<< modifier << " Density: " << density << endl;
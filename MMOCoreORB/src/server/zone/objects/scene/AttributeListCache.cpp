@@ -0,0 +1,191 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "AttributeListCache.h"
+
+#include "conf/ConfigManager.h"
+#include "server/zone/objects/creature/CreatureObject.h"
+#include "server/zone/packets/scene/AttributeListMessage.h"
+
+AttributeListCache::Entry::Entry(int listVersion) {
+	version = listVersion;
+	nextVariant = 0;
+
+	for (int i = 0; i < MAX_VARIANTS; ++i) {
+		keys[i] = -1;
+		packets[i] = nullptr;
+	}
+}
+
+AttributeListCache::Entry::~Entry() {
+#ifndef LOCKFREE_BCLIENT_BUFFERS
+	for (int i = 0; i < MAX_VARIANTS; ++i)
+		delete packets[i];
+#endif
+}
+
+AttributeListCache::AttributeListCache() : Logger("AttributeListCache"), entries(4096) {
+	enabled = true;
+	maxAge = 300000;
+	maxEntries = 200000;
+}
+
+void AttributeListCache::loadConfig() {
+	auto config = ConfigManager::instance();
+
+	enabled = config->getInt("Core3.AttributeListCache.Enabled", 1) != 0;
+	maxAge = config->getInt("Core3.AttributeListCache.MaxAge", 300000);
+	maxEntries = Math::max(1, config->getInt("Core3.AttributeListCache.MaxEntries", 200000));
+
+	info() << (enabled ? "enabled" : "disabled") << ", max age " << maxAge << "ms, max entries " << maxEntries;
+}
+
+BasePacket* AttributeListCache::copy(BasePacket* packet) {
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+	return packet;
+#else
+	return packet->clone();
+#endif
+}
+
+void AttributeListCache::sendAttributeListTo(SceneObject* object, CreatureObject* viewer) {
+	BasePacket* packet = getAttributeList(object, viewer);
+
+	if (packet != nullptr)
+		viewer->sendMessage(packet);
+}
+
+BasePacket* AttributeListCache::getAttributeList(SceneObject* object, CreatureObject* viewer) {
+	if (!enabled)
+		return object->createAttributeListMessage(viewer);
+
+	int key = object->getAttributeListViewerKey(viewer);
+
+	if (key < 0) {
+		uncached.increment();
+
+		return object->createAttributeListMessage(viewer);
+	}
+
+	uint64 oid = object->getObjectID();
+
+	// read before building, a change made while the list is built leaves the entry behind the object
+	int version = object->getAttributeListVersion();
+
+	BasePacket* cached = find(oid, version, key);
+
+	if (cached != nullptr) {
+		hits.increment();
+		bytesSaved.add(cached->size());
+
+		return cached;
+	}
+
+	misses.increment();
+
+	BasePacket* packet = object->createAttributeListMessage(viewer);
+
+	if (packet != nullptr)
+		store(oid, version, key, copy(packet));
+
+	return packet;
+}
+
+BasePacket* AttributeListCache::find(uint64 oid, int version, int key) {
+	ReadLocker locker(&lock);
+
+	Entry* entry = entries.get(oid);
+
+	if (entry == nullptr || entry->version != version)
+		return nullptr;
+
+	if (maxAge > 0 && entry->created.miliDifference() > maxAge)
+		return nullptr;
+
+	for (int i = 0; i < MAX_VARIANTS; ++i) {
+		if (entry->keys[i] == key && entry->packets[i] != nullptr)
+			return copy(entry->packets[i]);
+	}
+
+	return nullptr;
+}
+
+void AttributeListCache::store(uint64 oid, int version, int key, BasePacket* packet) {
+	Locker locker(&lock);
+
+	Reference<Entry*> entry = entries.get(oid);
+
+	if (entry == nullptr || entry->version != version || (maxAge > 0 && entry->created.miliDifference() > maxAge)) {
+		if (entry == nullptr && entries.size() >= maxEntries) {
+			info() << "reached " << maxEntries << " entries, clearing";
+
+			entries.removeAll();
+		}
+
+		entry = new Entry(version);
+		entries.put(oid, entry);
+	}
+
+	int slot = -1;
+
+	for (int i = 0; i < MAX_VARIANTS && slot == -1; ++i) {
+		if (entry->keys[i] == key || entry->packets[i] == nullptr)
+			slot = i;
+	}
+
+	if (slot == -1) {
+		slot = entry->nextVariant;
+		entry->nextVariant = (entry->nextVariant + 1) % MAX_VARIANTS;
+	}
+
+#ifndef LOCKFREE_BCLIENT_BUFFERS
+	delete entry->packets[slot];
+#endif
+
+	entry->keys[slot] = key;
+	entry->packets[slot] = packet;
+}
+
+void AttributeListCache::invalidate(uint64 oid) {
+	ReadLocker readLocker(&lock);
+
+	if (!entries.containsKey(oid))
+		return;
+
+	readLocker.release();
+
+	Locker locker(&lock);
+
+	if (entries.remove(oid) != nullptr)
+		invalidations.increment();
+}
+
+void AttributeListCache::clear() {
+	Locker locker(&lock);
+
+	entries.removeAll();
+}
+
+int AttributeListCache::size() {
+	ReadLocker locker(&lock);
+
+	return entries.size();
+}
+
+String AttributeListCache::getInfo() {
+	uint64 hitCount = hits.get();
+	uint64 total = hitCount + misses.get();
+
+	StringBuffer buf;
+	buf << (enabled ? "enabled" : "disabled")
+		<< " objects: " << size()
+		<< " hits: " << hitCount
+		<< " misses: " << misses.get()
+		<< " hit rate: " << (total > 0 ? hitCount * 100 / total : 0) << "%"
+		<< " uncached: " << uncached.get()
+		<< " invalidations: " << invalidations.get()
+		<< " bytes saved: " << bytesSaved.get();
+
+	return buf.toString();
+}
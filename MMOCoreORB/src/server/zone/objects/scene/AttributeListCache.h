@@ -0,0 +1,115 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef ATTRIBUTELISTCACHE_H_
+#define ATTRIBUTELISTCACHE_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/objects/scene/SceneObject.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace scene {
+
+/**
+ * Serialized attribute lists sent for GetAttributesBatchCommand, per object and
+ * viewer key (see SceneObject::getAttributeListViewerKey).
+ * Entries are valid for the attribute list version of the object they were
+ * built at, broadcasts, container changes and explicit sendAttributeListTo calls
+ * bump it. Entries older than MaxAge are rebuilt so state changed without any
+ * of those cannot go stale for long. Viewers get a copy of the cached bytes,
+ * or the shared buffer itself with LOCKFREE_BCLIENT_BUFFERS.
+ */
+class AttributeListCache : public Singleton<AttributeListCache>, public Logger, public Object {
+public:
+	// viewer variants kept per object, certified/uncertified, jedi/privileged
+	static const int MAX_VARIANTS = 4;
+
+protected:
+	class Entry : public Object {
+	public:
+		int version;
+		int keys[MAX_VARIANTS];
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+		Reference<BasePacket*> packets[MAX_VARIANTS];
+#else
+		BasePacket* packets[MAX_VARIANTS];
+#endif
+		int nextVariant;
+		Time created;
+
+		Entry(int listVersion);
+		~Entry();
+	};
+
+	ReadWriteLock lock;
+	HashTable<uint64, Reference<Entry*> > entries;
+
+	bool enabled;
+	int maxAge;
+	int maxEntries;
+
+	AtomicLong hits;
+	AtomicLong misses;
+	AtomicLong uncached;
+	AtomicLong invalidations;
+	AtomicLong bytesSaved;
+
+	BasePacket* find(uint64 oid, int version, int key);
+	void store(uint64 oid, int version, int key, BasePacket* packet);
+
+	static BasePacket* copy(BasePacket* packet);
+
+public:
+	AttributeListCache();
+
+	void loadConfig();
+
+	/**
+	 * Sends what object->sendAttributeListTo(viewer) would, from the cache when the
+	 * object did not change since the list was built for the same viewer key
+	 */
+	void sendAttributeListTo(SceneObject* object, CreatureObject* viewer);
+
+	/**
+	 * Returns a message the caller sends or deletes, nullptr when the list
+	 * could not be filled
+	 */
+	BasePacket* getAttributeList(SceneObject* object, CreatureObject* viewer);
+
+	void invalidate(uint64 oid);
+
+	void clear();
+
+	int size();
+
+	String getInfo();
+
+	void setEnabled(bool val) {
+		enabled = val;
+	}
+
+	uint64 getHits() const {
+		return hits.get();
+	}
+
+	uint64 getMisses() const {
+		return misses.get();
+	}
+
+	uint64 getUncached() const {
+		return uncached.get();
+	}
+};
+
+}
+}
+}
+}
+
+using namespace server::zone::objects::scene;
+
+#endif /* ATTRIBUTELISTCACHE_H_ */
@@ -0,0 +1,143 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#include "BaselineCache.h"
+
+#include "conf/ConfigManager.h"
+
+BaselineCache::Entry::Entry() {
+	version = 0;
+
+	for (int i = 0; i < MAX_TYPES; ++i)
+		packets[i] = nullptr;
+}
+
+BaselineCache::Entry::~Entry() {
+#ifndef LOCKFREE_BCLIENT_BUFFERS
+	for (int i = 0; i < MAX_TYPES; ++i)
+		delete packets[i];
+#endif
+}
+
+BaselineCache::BaselineCache() : Logger("BaselineCache"), entries(4096) {
+	enabled = true;
+	maxEntries = 100000;
+}
+
+void BaselineCache::loadConfig() {
+	auto config = ConfigManager::instance();
+
+	enabled = config->getInt("Core3.BaselineCache.Enabled", 1) != 0;
+	maxEntries = Math::max(1, config->getInt("Core3.BaselineCache.MaxEntries", 100000));
+
+	info() << (enabled ? "enabled" : "disabled") << ", max entries " << maxEntries;
+}
+
+bool BaselineCache::isCacheable(SceneObject* object) const {
+	if (object->isCreatureObject())
+		return false;
+
+	if (object->isBuildingObject() || object->isTerminal() || object->isInstallationObject() || object->isStaticObjectClass())
+		return true;
+
+	// decorations, the parent pointer is only read to check the container type
+	ManagedReference<SceneObject*> parent = object->getParent().get();
+
+	return parent != nullptr && parent->isCellObject();
+}
+
+BasePacket* BaselineCache::copy(BasePacket* packet) {
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+	return packet;
+#else
+	return packet->clone();
+#endif
+}
+
+BasePacket* BaselineCache::find(uint64 oid, int version, int type) {
+	ReadLocker locker(&lock);
+
+	Entry* entry = entries.get(oid);
+
+	if (entry == nullptr || entry->version != version || entry->packets[type] == nullptr)
+		return nullptr;
+
+	return copy(entry->packets[type]);
+}
+
+void BaselineCache::store(uint64 oid, int version, int type, BasePacket* packet) {
+	Locker locker(&lock);
+
+	Reference<Entry*> entry = entries.get(oid);
+
+	// built before a change another build already stored, the difference keeps it wrap safe
+	if (entry != nullptr && (int) ((uint32) entry->version - (uint32) version) > 0) {
+#ifndef LOCKFREE_BCLIENT_BUFFERS
+		delete packet;
+#endif
+		return;
+	}
+
+	if (entry == nullptr || entry->version != version) {
+		if (entry == nullptr && entries.size() >= maxEntries) {
+			info() << "reached " << maxEntries << " entries, clearing";
+
+			entries.removeAll();
+		}
+
+		entry = new Entry();
+		entry->version = version;
+
+		entries.put(oid, entry);
+	}
+
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+	entry->packets[type] = packet;
+#else
+	delete entry->packets[type];
+	entry->packets[type] = packet;
+#endif
+}
+
+void BaselineCache::invalidate(uint64 oid) {
+	ReadLocker readLocker(&lock);
+
+	if (!entries.containsKey(oid))
+		return;
+
+	readLocker.release();
+
+	Locker locker(&lock);
+
+	if (entries.remove(oid) != nullptr)
+		invalidations.increment();
+}
+
+void BaselineCache::clear() {
+	Locker locker(&lock);
+
+	entries.removeAll();
+}
+
+int BaselineCache::size() {
+	ReadLocker locker(&lock);
+
+	return entries.size();
+}
+
+String BaselineCache::getInfo() {
+	uint64 hitCount = hits.get();
+	uint64 total = hitCount + misses.get();
+
+	StringBuffer buf;
+	buf << (enabled ? "enabled" : "disabled")
+		<< " objects: " << size()
+		<< " hits: " << hitCount
+		<< " misses: " << misses.get()
+		<< " hit rate: " << (total > 0 ? hitCount * 100 / total : 0) << "%"
+		<< " invalidations: " << invalidations.get()
+		<< " bytes saved: " << bytesSaved.get();
+
+	return buf.toString();
+}
@@ -0,0 +1,131 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef BASELINECACHE_H_
+#define BASELINECACHE_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/objects/scene/SceneObject.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace scene {
+
+/**
+ * Serialized baselines of objects that rarely change (buildings, terminals,
+ * installations, static objects and items placed in cells), per object and
+ * baseline type.
+ * Entries are keyed on SceneObject::getBaselineVersion(), which deltas and the
+ * baseline setters bump after a change, so a mismatching version is rebuilt and
+ * a packet built against an older version than the stored one is dropped.
+ * Recipients get a copy of the cached bytes, or the shared buffer itself with
+ * LOCKFREE_BCLIENT_BUFFERS.
+ */
+class BaselineCache : public Singleton<BaselineCache>, public Logger, public Object {
+public:
+	static const int MAX_TYPES = 10;
+
+protected:
+	class Entry : public Object {
+	public:
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+		Reference<BasePacket*> packets[MAX_TYPES];
+#else
+		BasePacket* packets[MAX_TYPES];
+#endif
+		int version;
+
+		Entry();
+		~Entry();
+	};
+
+	ReadWriteLock lock;
+	HashTable<uint64, Reference<Entry*> > entries;
+
+	bool enabled;
+	int maxEntries;
+
+	AtomicLong hits;
+	AtomicLong misses;
+	AtomicLong invalidations;
+	AtomicLong bytesSaved;
+
+	BasePacket* find(uint64 oid, int version, int type);
+	void store(uint64 oid, int version, int type, BasePacket* packet);
+
+	static BasePacket* copy(BasePacket* packet);
+
+public:
+	BaselineCache();
+
+	void loadConfig();
+
+	bool isCacheable(SceneObject* object) const;
+
+	/**
+	 * Returns a packet the caller sends like a freshly built one, builder() is
+	 * only called on a miss
+	 */
+	template<class B>
+	BasePacket* get(SceneObject* object, int type, B builder);
+
+	void invalidate(uint64 oid);
+
+	void clear();
+
+	int size();
+
+	String getInfo();
+
+	void setEnabled(bool val) {
+		enabled = val;
+	}
+
+	uint64 getHits() const {
+		return hits.get();
+	}
+
+	uint64 getMisses() const {
+		return misses.get();
+	}
+};
+
+}
+}
+}
+}
+
+using namespace server::zone::objects::scene;
+
+template<class B>
+BasePacket* BaselineCache::get(SceneObject* object, int type, B builder) {
+	if (!enabled || type < 0 || type >= MAX_TYPES || !isCacheable(object))
+		return builder();
+
+	uint64 oid = object->getObjectID();
+
+	// read before building, a change made while building leaves the entry stale
+	int version = object->getBaselineVersion();
+
+	BasePacket* cached = find(oid, version, type);
+
+	if (cached != nullptr) {
+		hits.increment();
+		bytesSaved.add(cached->size());
+
+		return cached;
+	}
+
+	misses.increment();
+
+	BasePacket* packet = builder();
+
+	store(oid, version, type, copy(packet));
+
+	return packet;
+}
+
+#endif /* BASELINECACHE_H_ */
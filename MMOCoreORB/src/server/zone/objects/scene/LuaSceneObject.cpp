@@ -142,7 +142,7 @@ int LuaSceneObject::setCustomObjectName(lua_State* L) {
 		String file = lua_tostring(L, -2);
 		String key = lua_tostring(L, -1);
 		String fullPath = "@" + file + ":" + key;
-		value = StringIdManager::instance()->getStringId(fullPath.hashCode()).toString();
+		value = StringIdManager::instance()->getStringIdAsString(fullPath.hashCode());
 	} else {
 		value = lua_tostring(L, -1);
 	}
@@ -168,7 +168,7 @@ int LuaSceneObject::switchZone(lua_State* L) {
 
 int LuaSceneObject::getTemplateObjectPath(lua_State* L) {
 	if (realObject != nullptr) {
-		String tempPath = realObject->getObjectTemplate()->getFullTemplateString();
+		const String& tempPath = realObject->getObjectTemplate()->getFullTemplateString();
 
 		lua_pushstring(L, tempPath.toCharArray());
 	} else {
@@ -619,7 +619,7 @@ int LuaSceneObject::getDisplayedName(lua_State* L) {
 }
 
 int LuaSceneObject::getObjectName(lua_State* L) {
-	String objname = realObject->getObjectName()->getStringID();
+	const String& objname = realObject->getObjectName()->getStringID();
 
 	lua_pushstring(L, objname.toCharArray());
 
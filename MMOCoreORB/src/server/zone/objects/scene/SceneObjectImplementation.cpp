@@ -3,12 +3,15 @@
 		See file COPYING for copying conditions. */
 
 #include "server/zone/objects/scene/SceneObject.h"
+#include "server/zone/objects/scene/BaselineCache.h"
+#include "server/zone/objects/scene/AttributeListCache.h"
 
 #include "server/zone/packets/scene/SceneObjectCreateMessage.h"
 #include "server/zone/packets/scene/SceneObjectDestroyMessage.h"
 #include "server/zone/packets/scene/SceneObjectCloseMessage.h"
 #include "server/zone/packets/scene/UpdateContainmentMessage.h"
 #include "server/zone/packets/scene/AttributeListMessage.h"
+#include "server/zone/packets/DeltaMessage.h"
 #include "server/zone/packets/scene/ClientOpenContainerMessage.h"
 #include "server/zone/packets/object/DataTransform.h"
 #include "server/zone/packets/object/DataTransformWithParent.h"
@@ -251,6 +254,9 @@ void SceneObjectImplementation::destroyObjectFromDatabase(bool destroyContainedO
 
 	containerObjects.cancelUnloadTask();
 
+	BaselineCache::instance()->invalidate(getObjectID());
+	AttributeListCache::instance()->invalidate(getObjectID());
+
 	if(dataObjectComponent != nullptr) {
 		dataObjectComponent->notifyObjectDestroyingFromDatabase();
 	}
@@ -434,6 +440,16 @@ void SceneObjectImplementation::setObjectMenuComponent(const String& name) {
 	}
 }
 
+void SceneObjectImplementation::setAttributeListComponent(const String& name) {
+	if (name.isEmpty())
+		return;
+
+	attributeListComponent = ComponentManager::instance()->getComponent<AttributeListComponent*>(name);
+
+	if (attributeListComponent == nullptr)
+		error() << "AttributeListComponent not found: '" << name << "'";
+}
+
 void SceneObjectImplementation::setContainerComponent(const String& name) {
 	if (name.isEmpty())
 		return;
@@ -508,6 +524,16 @@ void SceneObjectImplementation::sendDestroyTo(SceneObject* player) {
 }
 
 void SceneObjectImplementation::sendAttributeListTo(CreatureObject* object) {
+	// explicit sends follow a change the cached lists do not know about
+	incrementAttributeListVersion();
+
+	AttributeListMessage* alm = createAttributeListMessage(object);
+
+	if (alm != nullptr)
+		object->sendMessage(alm);
+}
+
+AttributeListMessage* SceneObjectImplementation::createAttributeListMessage(CreatureObject* object) {
 	AttributeListMessage* alm = new AttributeListMessage(asSceneObject());
 
 	try {
@@ -530,8 +556,7 @@ void SceneObjectImplementation::sendAttributeListTo(CreatureObject* object) {
 		throw;
 	}
 
-	if (alm != nullptr)
-		object->sendMessage(alm);
+	return alm;
 }
 
 void SceneObjectImplementation::broadcastObjectPrivate(SceneObject* object, SceneObject* selfObject) {
@@ -716,6 +741,12 @@ void SceneObjectImplementation::broadcastMessagePrivate(BasePacket* message, Sce
 void SceneObjectImplementation::broadcastMessage(BasePacket* message, bool sendSelf, bool lockZone) {
 	SceneObject* selfObject = sendSelf ? nullptr : asSceneObject();
 
+	// deltas are built before the change they carry is applied
+	if (dynamic_cast<DeltaMessage*>(message) != nullptr)
+		incrementBaselineVersion();
+
+	incrementAttributeListVersion();
+
 	broadcastMessagePrivate(message, selfObject, lockZone);
 }
 
@@ -809,6 +840,15 @@ void SceneObjectImplementation::broadcastMessagesPrivate(Vector<BasePacket*>* me
 void SceneObjectImplementation::broadcastMessages(Vector<BasePacket*>* messages, bool sendSelf) {
 	SceneObject* selfObject = sendSelf ? nullptr : asSceneObject();
 
+	for (int i = 0; i < messages->size(); ++i) {
+		if (dynamic_cast<DeltaMessage*>(messages->get(i)) != nullptr) {
+			incrementBaselineVersion();
+			break;
+		}
+	}
+
+	incrementAttributeListVersion();
+
 	broadcastMessagesPrivate(messages, selfObject);
 }
 
@@ -947,10 +987,15 @@ int SceneObjectImplementation::canAddObject(SceneObject* object, int containment
 }
 
 bool SceneObjectImplementation::transferObject(SceneObject* object, int containmentType, bool notifyClient, bool allowOverflow, bool notifyRoot) {
+	// container contents show in the list (volume, no trade)
+	incrementAttributeListVersion();
+
 	return containerComponent->transferObject(asSceneObject(), object, containmentType, notifyClient, allowOverflow, notifyRoot);
 }
 
 bool SceneObjectImplementation::removeObject(SceneObject* object, SceneObject* destination, bool notifyClient) {
+	incrementAttributeListVersion();
+
 	return containerComponent->removeObject(asSceneObject(), object, destination, notifyClient);
 }
 
@@ -1225,6 +1270,8 @@ int SceneObjectImplementation::handleObjectMenuSelect(CreatureObject* player, by
 
 void SceneObjectImplementation::setObjectName(const StringId& stringID, bool notifyClient) {
 	objectName = stringID;
+
+	incrementBaselineVersion();
 }
 
 Vector3 SceneObjectImplementation::getWorldPosition() {
@@ -1626,7 +1673,7 @@ String SceneObjectImplementation::getDisplayedName() const {
 	if (!customName.isEmpty())
 		return customName.toString();
 
-	return StringIdManager::instance()->getStringId(objectName.getFullPath().hashCode()).toString();
+	return StringIdManager::instance()->getStringIdAsString(objectName.getFullPath().hashCode());
 }
 
 bool SceneObjectImplementation::setTransformForCollisionMatrixIfNull(Matrix4* mat) {
@@ -48,6 +48,13 @@ public:
 	 */
 	virtual void fillAttributeList(AttributeListMessage* alm, CreatureObject* creature, SceneObject* object) const;
 
+	/**
+	 * False when the list depends on the viewer or the time, see AttributeListCache
+	 */
+	virtual bool isCacheable() const {
+		return true;
+	}
+
 };
 
 #endif /* ATTIBUTELISTCOMPONENT_H_ */
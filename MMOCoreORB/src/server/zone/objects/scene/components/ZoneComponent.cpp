@@ -8,6 +8,7 @@
 #include "server/zone/objects/area/ActiveArea.h"
 #include "server/zone/objects/building/BuildingObject.h"
 #include "server/zone/Zone.h"
+#include "server/zone/managers/creature/ZoneAwarenessPass.h"
 #include "server/zone/packets/object/DataTransform.h"
 #include "server/zone/packets/object/DataTransformWithParent.h"
 #include "server/zone/packets/scene/UpdateTransformMessage.h"
@@ -100,9 +101,8 @@ void ZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate, bool
 	if (parent != nullptr && (parent->isVehicleObject() || parent->isMount()))
 		sceneObject->updateVehiclePosition(sendPackets);
 
-	Locker _locker(zone);
-
-	bool zoneUnlocked = false;
+	// the object tree locks its own sectors, the zone lock is only needed to leave a cell
+	bool zoneLocked = zone->isLockedByCurrentThread();
 
 	if (parent != nullptr && parent->isCellObject()) {
 		SceneObject* rootParent = parent->getRootParent();
@@ -110,19 +110,21 @@ void ZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate, bool
 		if (rootParent == nullptr)
 			return;
 
+		if (zoneLocked)
+			zone->unlock();
+
 		zone = rootParent->getZone();
 
-		zone->transferObject(sceneObject, -1, false);
+		Locker _locker(zone);
 
-		zone->unlock();
-		zoneUnlocked = true;
+		zone->transferObject(sceneObject, -1, false);
 	} else {
+		if (zoneLocked)
+			zone->unlock();
+
 		if (sceneObject->getLocalZone() != nullptr) {
 			zone->update(sceneObject);
 
-			zone->unlock();
-			zoneUnlocked = true;
-
 			try {
 				zone->inRange(sceneObject, ZoneServer::CLOSEOBJECTRANGE);
 			} catch (Exception& e) {
@@ -160,12 +162,19 @@ void ZoneComponent::updateZone(SceneObject* sceneObject, bool lightUpdate, bool
 			sceneObject->error("Exception caught while calling notifySelfPositionUpdate(sceneObject) in ZoneComponent::updateZone");
 			sceneObject->error(e.getMessage());
 		}
+
+		if (!isInvis && sceneObject->isCreatureObject()) {
+			auto awarenessPass = zone->getAwarenessPass();
+
+			if (awarenessPass != nullptr)
+				awarenessPass->notifyCreatureMoved(sceneObject->asCreatureObject());
+		}
 	} catch (Exception& e) {
 		sceneObject->error(e.getMessage());
 		e.printStackTrace();
 	}
 
-	if (zoneUnlocked)
+	if (zoneLocked)
 		zone->wlock();
 }
 
@@ -179,30 +188,25 @@ void ZoneComponent::updateZoneWithParent(SceneObject* sceneObject, SceneObject*
 	if (zone == nullptr)
 		zone = newParent->getRootParent()->getZone();
 
-	Locker _locker(zone);
-
-	if (oldParent == nullptr) { // we are in zone, enter cell
-		newParent->transferObject(sceneObject, -1, true);
+	bool zoneLocked = zone->isLockedByCurrentThread();
 
+	if (zoneLocked)
 		zone->unlock();
-	} else { // we are in cell already
-		if (oldParent != newParent) {
-			newParent->transferObject(sceneObject, -1, true);
 
-			zone->unlock();
-		} else {
-			zone->unlock();
+	if (oldParent == nullptr || oldParent != newParent) { // entering a cell or moving to another one
+		Locker _locker(zone);
 
-			try {
-				TangibleObject* tano = sceneObject->asTangibleObject();
+		newParent->transferObject(sceneObject, -1, true);
+	} else { // we are in cell already
+		try {
+			TangibleObject* tano = sceneObject->asTangibleObject();
 
-				if (tano != nullptr) {
-					zone->updateActiveAreas(tano);
-				}
-			} catch (Exception& e) {
-				sceneObject->error(e.getMessage());
-				e.printStackTrace();
+			if (tano != nullptr) {
+				zone->updateActiveAreas(tano);
 			}
+		} catch (Exception& e) {
+			sceneObject->error(e.getMessage());
+			e.printStackTrace();
 		}
 	}
 
@@ -250,12 +254,20 @@ void ZoneComponent::updateZoneWithParent(SceneObject* sceneObject, SceneObject*
 			sceneObject->error("Exception caught while calling notifySelfPositionUpdate(sceneObject) in ZoneComponent::updateZoneWithParent");
 			sceneObject->error(e.getMessage());
 		}
+
+		if (!isInvis && sceneObject->isCreatureObject()) {
+			auto awarenessPass = zone->getAwarenessPass();
+
+			if (awarenessPass != nullptr)
+				awarenessPass->notifyCreatureMoved(sceneObject->asCreatureObject());
+		}
 	} catch (Exception& e) {
 		sceneObject->error(e.getMessage());
 		e.printStackTrace();
 	}
 
-	zone->wlock();
+	if (zoneLocked)
+		zone->wlock();
 }
 
 void ZoneComponent::switchZone(SceneObject* sceneObject, const String& newTerrainName, float newPostionX, float newPositionZ, float newPositionY, uint64 parentID, bool toggleInvisibility) const {
@@ -440,6 +452,9 @@ void ZoneComponent::removeObjectFromZone(SceneObject* sceneObject, Zone* zone, S
 
 			area->enqueueExitEvent(sceneObject);
 		}
+
+		// the next zone insert has to enter the covering areas again
+		tano->setActiveAreaCell(nullptr);
 	} else if (sceneObject->isStaticObjectClass()) {
 		// hack to get around notifyEnter/Exit only working with tangible objects
 		Vector3 worldPos = sceneObject->getWorldPosition();
@@ -0,0 +1,153 @@
+/*
+				Copyright <SWGEmu>
+		See file COPYING for copying conditions.*/
+
+#ifndef DIRTYDELTAFIELDS_H_
+#define DIRTYDELTAFIELDS_H_
+
+#include "engine/engine.h"
+
+#include "server/zone/packets/DeltaMessage.h"
+#include "server/zone/objects/scene/variables/DeltaVector.h"
+
+namespace server {
+namespace zone {
+namespace objects {
+namespace scene {
+namespace variables {
+
+/**
+ * Delta fields of one object that changed since its last flush, one bitmap
+ * of field indexes per baseline type, plus a bitmap of changed elements for
+ * list fields. The values are read back from the object when the merged
+ * delta is written, so a field that changes five times goes out once.
+ *
+ * Guarded by the object lock.
+ */
+class DirtyDeltaFields {
+public:
+	static const int MAXBASELINE = 9;
+
+protected:
+	uint32 fields[MAXBASELINE + 1];
+
+	// (baseline << 16 | field) -> changed list elements
+	VectorMap<uint32, uint32> listElements;
+
+	bool queued;
+
+	static uint32 getListKey(int baseline, int field) {
+		return ((uint32) baseline << 16) | (uint32) field;
+	}
+
+	static int countBits(uint32 bits) {
+		int count = 0;
+
+		for (; bits != 0; bits &= bits - 1)
+			++count;
+
+		return count;
+	}
+
+public:
+	DirtyDeltaFields() : listElements(1, 1), queued(false) {
+		listElements.setNoDuplicateInsertPlan();
+
+		clear();
+	}
+
+	void setField(int baseline, int field) {
+		fields[baseline] |= 1u << field;
+	}
+
+	void setListElement(int baseline, int field, int element) {
+		setField(baseline, field);
+
+		uint32 key = getListKey(baseline, field);
+		int index = listElements.find(key);
+
+		if (index == -1)
+			listElements.put(key, 1u << element);
+		else
+			listElements.elementAt(index).getValue() |= 1u << element;
+	}
+
+	bool isFieldDirty(int baseline, int field) const {
+		return fields[baseline] & (1u << field);
+	}
+
+	bool isBaselineDirty(int baseline) const {
+		return fields[baseline] != 0;
+	}
+
+	uint32 getListElements(int baseline, int field) const {
+		int index = listElements.find(getListKey(baseline, field));
+
+		if (index == -1)
+			return 0;
+
+		return listElements.elementAt(index).getValue();
+	}
+
+	/**
+	 * Writes one list update with every changed element of the list, the
+	 * update counter moves by the number of elements as if they were sent
+	 * one by one
+	 */
+	template<class E> void writeListUpdate(DeltaMessage* message, int baseline, int field, DeltaVector<E>& list) const {
+		uint32 elements = getListElements(baseline, field);
+
+		if (elements == 0)
+			return;
+
+		message->startUpdate(field);
+
+		int updates = countBits(elements);
+
+		for (int i = 0; i < list.size() && elements != 0; ++i) {
+			if (!(elements & (1u << i)))
+				continue;
+
+			elements &= ~(1u << i);
+
+			E value = list.get(i);
+			list.set(i, value, message, updates);
+
+			updates = 0;
+		}
+	}
+
+	void clear() {
+		for (int i = 0; i <= MAXBASELINE; ++i)
+			fields[i] = 0;
+
+		listElements.removeAll();
+	}
+
+	bool isEmpty() const {
+		for (int i = 0; i <= MAXBASELINE; ++i) {
+			if (fields[i] != 0)
+				return false;
+		}
+
+		return true;
+	}
+
+	bool isQueued() const {
+		return queued;
+	}
+
+	void setQueued(bool val) {
+		queued = val;
+	}
+};
+
+}
+}
+}
+}
+}
+
+using namespace server::zone::objects::scene::variables;
+
+#endif /* DIRTYDELTAFIELDS_H_ */
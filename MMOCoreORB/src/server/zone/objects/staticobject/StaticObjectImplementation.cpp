@@ -8,12 +8,16 @@
 #include "server/zone/objects/staticobject/StaticObject.h"
 #include "server/zone/packets/static/StaticObjectMessage3.h"
 #include "server/zone/packets/static/StaticObjectMessage6.h"
+#include "server/zone/objects/scene/BaselineCache.h"
 
 void StaticObjectImplementation::sendBaselinesTo(SceneObject* player) {
-	BaseMessage* stao3 = new StaticObjectMessage3(_this.getReferenceUnsafeStaticCast());
+	StaticObject* staticObject = _this.getReferenceUnsafeStaticCast();
+	BaselineCache* baselineCache = BaselineCache::instance();
+
+	BasePacket* stao3 = baselineCache->get(asSceneObject(), 3, [staticObject] () { return new StaticObjectMessage3(staticObject); });
 	player->sendMessage(stao3);
 
-	BaseMessage* stao6 = new StaticObjectMessage6(_this.getReferenceUnsafeStaticCast());
+	BasePacket* stao6 = baselineCache->get(asSceneObject(), 6, [staticObject] () { return new StaticObjectMessage6(staticObject); });
 	player->sendMessage(stao6);
 }
 
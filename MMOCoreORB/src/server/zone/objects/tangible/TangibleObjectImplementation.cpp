@@ -23,6 +23,7 @@
 #include "server/zone/objects/factorycrate/FactoryCrate.h"
 #include "server/zone/objects/tangible/threat/ThreatMap.h"
 #include "server/zone/Zone.h"
+#include "server/zone/DeltaFlushQueue.h"
 #include "tasks/ClearDefenderListsTask.h"
 #include "server/zone/objects/manufactureschematic/craftingvalues/CraftingValues.h"
 #include "templates/tangible/tool/RepairToolTemplate.h"
@@ -35,6 +36,7 @@
 #include "server/zone/managers/gcw/GCWManager.h"
 #include "templates/faction/Factions.h"
 #include "server/zone/objects/player/FactionStatus.h"
+#include "server/zone/objects/scene/BaselineCache.h"
 
 void TangibleObjectImplementation::initializeTransientMembers() {
 	SceneObjectImplementation::initializeTransientMembers();
@@ -144,10 +146,12 @@ void TangibleObjectImplementation::sendBaselinesTo(SceneObject* player) {
 
 	TangibleObject* thisPointer = asTangibleObject();
 
-	BaseMessage* tano3 = new TangibleObjectMessage3(thisPointer);
+	BaselineCache* baselineCache = BaselineCache::instance();
+
+	BasePacket* tano3 = baselineCache->get(asSceneObject(), 3, [thisPointer] () { return new TangibleObjectMessage3(thisPointer); });
 	player->sendMessage(tano3);
 
-	BaseMessage* tano6 = new TangibleObjectMessage6(thisPointer);
+	BasePacket* tano6 = baselineCache->get(asSceneObject(), 6, [thisPointer] () { return new TangibleObjectMessage6(thisPointer); });
 	player->sendMessage(tano6);
 
 	if (player->isPlayerCreature())
@@ -382,6 +386,8 @@ void TangibleObjectImplementation::addVisibleComponent(int value, bool notifyCli
 	} else {
 		visibleComponents.add(value);
 	}
+
+	incrementBaselineVersion();
 }
 
 void TangibleObjectImplementation::removeAllVisibleComponents(bool notifyClient) {
@@ -397,6 +403,8 @@ void TangibleObjectImplementation::removeAllVisibleComponents(bool notifyClient)
 	} else {
 		visibleComponents.removeAll();
 	}
+
+	incrementBaselineVersion();
 }
 
 void TangibleObjectImplementation::removeVisibleComponent(int value, bool notifyClient) {
@@ -415,6 +423,8 @@ void TangibleObjectImplementation::removeVisibleComponent(int value, bool notify
 	} else {
 		visibleComponents.drop(value);
 	}
+
+	incrementBaselineVersion();
 }
 
 void TangibleObjectImplementation::setDefender(SceneObject* defender) {
@@ -537,6 +547,13 @@ void TangibleObjectImplementation::removeDefender(SceneObject* defender) {
 	debug("finished removing defender");
 }
 
+int TangibleObjectImplementation::getAttributeListViewerKey(CreatureObject* object) {
+	if (attributeListComponent == nullptr || !attributeListComponent->isCacheable())
+		return -1;
+
+	return 0;
+}
+
 void TangibleObjectImplementation::fillAttributeList(AttributeListMessage* alm, CreatureObject* object) {
 	SceneObjectImplementation::fillAttributeList(alm, object);
 
@@ -587,6 +604,8 @@ void TangibleObjectImplementation::fillAttributeList(AttributeListMessage* alm,
 void TangibleObjectImplementation::setCustomizationVariable(byte type, int16 value, bool notifyClient) {
 	customizationVariables.setVariable(type, value);
 
+	incrementBaselineVersion();
+
 	if (!notifyClient)
 		return;
 
@@ -600,6 +619,8 @@ void TangibleObjectImplementation::setCustomizationVariable(byte type, int16 val
 void TangibleObjectImplementation::setCustomizationVariable(const String& type, int16 value, bool notifyClient) {
 	customizationVariables.setVariable(type, value);
 
+	incrementBaselineVersion();
+
 	if(!notifyClient)
 		return;
 
@@ -617,6 +638,8 @@ void TangibleObjectImplementation::setCountdownTimer(unsigned int newUseCount, b
 
 	useCount = newUseCount;
 
+	incrementBaselineVersion();
+
 	if (!notifyClient)
 		return;
 
@@ -652,6 +675,9 @@ void TangibleObjectImplementation::setMaxCondition(int maxCond, bool notifyClien
 
 	maxCondition = maxCond;
 
+	incrementBaselineVersion();
+	incrementAttributeListVersion();
+
 	if (!notifyClient)
 		return;
 
@@ -668,7 +694,10 @@ void TangibleObjectImplementation::setConditionDamage(float condDamage, bool not
 
 	conditionDamage = condDamage;
 
-	if (!notifyClient)
+	incrementBaselineVersion();
+	incrementAttributeListVersion();
+
+	if (!notifyClient || deferDeltaField(3, 8))
 		return;
 
 	TangibleObjectDeltaMessage3* dtano3 = new TangibleObjectDeltaMessage3(asTangibleObject());
@@ -678,6 +707,47 @@ void TangibleObjectImplementation::setConditionDamage(float condDamage, bool not
 	broadcastMessage(dtano3, true);
 }
 
+bool TangibleObjectImplementation::deferDeltaField(int baseline, int field, int listElement) {
+	if (!DeltaFlushQueue::isEnabled())
+		return false;
+
+	Zone* zone = getZone();
+
+	if (zone == nullptr)
+		return false;
+
+	if (listElement >= 0)
+		dirtyDeltaFields.setListElement(baseline, field, listElement);
+	else
+		dirtyDeltaFields.setField(baseline, field);
+
+	DeltaFlushQueue::deferredFields.increment();
+
+	if (!dirtyDeltaFields.isQueued()) {
+		dirtyDeltaFields.setQueued(true);
+
+		zone->queueDeltaFlush(asTangibleObject());
+	}
+
+	return true;
+}
+
+void TangibleObjectImplementation::flushDirtyDeltas() {
+	dirtyDeltaFields.setQueued(false);
+
+	if (dirtyDeltaFields.isFieldDirty(3, 8)) {
+		TangibleObjectDeltaMessage3* dtano3 = new TangibleObjectDeltaMessage3(asTangibleObject());
+		dtano3->updateConditionDamage();
+		dtano3->close();
+
+		broadcastMessage(dtano3, true);
+
+		DeltaFlushQueue::flushedMessages.increment();
+	}
+
+	dirtyDeltaFields.clear();
+}
+
 int TangibleObjectImplementation::inflictDamage(TangibleObject* attacker, int damageType, float damage, bool destroy, bool notifyClient, bool isCombatAction) {
 	if (hasAntiDecayKit())
 		return 0;
@@ -789,6 +859,8 @@ int TangibleObjectImplementation::healDamage(TangibleObject* healer, int damageT
 void TangibleObjectImplementation::setObjectName(const StringId& stringID, bool notifyClient) {
 	objectName = stringID;
 
+	incrementBaselineVersion();
+
 	if (!notifyClient)
 		return;
 
@@ -802,6 +874,8 @@ void TangibleObjectImplementation::setObjectName(const StringId& stringID, bool
 void TangibleObjectImplementation::setCustomObjectName(const UnicodeString& name, bool notifyClient) {
 	customName = name;
 
+	incrementBaselineVersion();
+
 	if (isClientObject())
 		setForceSend(true);
 
@@ -821,6 +895,8 @@ void TangibleObjectImplementation::setOptionsBitmask(uint32 bitmask, bool notify
 
 	optionsBitmask = bitmask;
 
+	incrementBaselineVersion();
+
 	if (!notifyClient)
 		return;
 
@@ -274,6 +274,20 @@ float LightsaberCrystalComponentImplementation::getRandomizedStat(float min, flo
 	return result;
 }
 
+int LightsaberCrystalComponentImplementation::getAttributeListViewerKey(CreatureObject* object) {
+	int key = TangibleObjectImplementation::getAttributeListViewerKey(object);
+
+	PlayerObject* player = object->getPlayerObject();
+
+	if (key < 0 || player == nullptr)
+		return -1;
+
+	if (player->isPrivileged())
+		return 2;
+
+	return object->hasSkill("force_title_jedi_rank_01") ? 1 : 0;
+}
+
 void LightsaberCrystalComponentImplementation::fillAttributeList(AttributeListMessage* alm, CreatureObject* object) {
 	TangibleObjectImplementation::fillAttributeList(alm, object);
 
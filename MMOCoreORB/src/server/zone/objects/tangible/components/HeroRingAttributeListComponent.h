@@ -10,6 +10,11 @@
 class HeroRingAttributeListComponent: public AttributeListComponent {
 public:
 
+	// the cooldown of the viewer is listed
+	bool isCacheable() const {
+		return false;
+	}
+
 	/**
 	 * Fills the Attributes
 	 * @pre { this object is locked }
@@ -210,6 +210,15 @@ String WeaponObjectImplementation::getWeaponType() const {
 	return weaponType;
 }
 
+int WeaponObjectImplementation::getAttributeListViewerKey(CreatureObject* object) {
+	int key = TangibleObjectImplementation::getAttributeListViewerKey(object);
+
+	if (key < 0)
+		return key;
+
+	return isCertifiedFor(object) ? 1 : 0;
+}
+
 void WeaponObjectImplementation::fillAttributeList(AttributeListMessage* alm, CreatureObject* object) {
 	TangibleObjectImplementation::fillAttributeList(alm, object);
 
@@ -667,6 +676,8 @@ void WeaponObjectImplementation::decreasePowerupUses(CreatureObject* player) {
 	if (hasPowerup()) {
 		powerupObject->decreaseUses();
 
+		incrementAttributeListVersion();
+
 		if (powerupObject->getUses() < 1) {
 			Locker locker(_this.getReferenceUnsafeStaticCast());
 			StringIdChatParameter message("powerup", "prose_pup_expire"); //The powerup on your %TT has expired.
@@ -803,6 +814,8 @@ bool WeaponObjectImplementation::applyPowerup(CreatureObject* player, PowerupObj
 
 	powerupObject = pup;
 
+	incrementAttributeListVersion();
+
 	if (pup->getParent() != nullptr) {
 		Locker clocker(pup, player);
 		pup->destroyObjectFromWorld(true);
@@ -820,6 +833,8 @@ Reference<PowerupObject*> WeaponObjectImplementation::removePowerup() {
 	auto pup = powerupObject;
 	powerupObject = nullptr;
 
+	incrementAttributeListVersion();
+
 	removeMagicBit(true);
 
 	return pup;
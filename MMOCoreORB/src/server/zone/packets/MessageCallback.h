@@ -23,6 +23,8 @@ namespace packets {
 
 		ManagedReference<ZoneProcessServer*> server;
 
+		Time receivedTime;
+
 	public:
 		MessageCallback(ZoneClientSession* client, ZoneProcessServer* server) {
 			MessageCallback::client = client;
@@ -60,6 +62,10 @@ namespace packets {
 			return server;
 		}
 
+		inline const Time& getReceivedTime() const {
+			return receivedTime;
+		}
+
 	};
 
 }
@@ -9,6 +9,7 @@
 #include "server/chat/StringIdChatParameterVector.h"
 #include "server/chat/WaypointChatParameterVector.h"
 #include "server/chat/PersistentMessage.h"
+#include "server/chat/MailHeader.h"
 
 class ChatPersistentMessageToClient : public BaseMessage {
 	void insertParameters(PersistentMessage* mail) {
@@ -142,6 +143,29 @@ public:
 
 		setCompression(true);
 	}
+
+	// what (mail, serverName, false) sends, built from the header the recipient keeps
+	ChatPersistentMessageToClient(uint32 mailid, const MailHeader& header, const String& serverName) : BaseMessage() {
+		insertShort(0x02);
+		insertInt(0x08485E17); //ChatPersistentMessageToClient
+
+		insertAscii(header.getSenderName());
+		insertAscii("SWG"); // Game Name
+		insertAscii(serverName.toCharArray()); //Galaxy Name
+		insertInt(mailid);
+
+		insertByte(1);
+		insertInt(0);
+
+		insertUnicode(header.getSubject());
+
+		insertInt(0);
+
+		insertByte(header.getStatus());
+		insertInt(header.getTimeStamp());
+
+		setCompression(true);
+	}
 };
 
 #endif /*CHATPERSISTENTMESSAGETOCLIENT_H_*/
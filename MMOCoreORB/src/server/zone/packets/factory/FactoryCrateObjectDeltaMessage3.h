@@ -15,6 +15,8 @@ public:
 	FactoryCrateObjectDeltaMessage3(FactoryCrate* ta, uint32 objType = 0x46435954)
 			: DeltaMessage(ta->getObjectID(), objType, 3) {
 		tano = ta;
+
+		ta->incrementBaselineVersion();
 	}
 
 	void setQuantity(int quantity) {
@@ -15,6 +15,8 @@ public:
 	HarvesterObjectDeltaMessage3(HarvesterObject* ho)
 			: DeltaMessage(ho->getObjectID(), 0x4F4E5449, 3) {
 		haro = ho;
+
+		ho->incrementBaselineVersion();
 	}
 
 	void updateDamage(uint32 value) {
@@ -43,13 +43,7 @@ public:
 			insertLong(ri->getObjectID());
 			insertAscii(ri->getName());
 			insertAscii(ri->getType());
-			auto zone = hino->getZone();
-
-			if (zone != nullptr) {
-				insertByte((int) (ri->getDensityAt(zone->getZoneName(), hino->getPositionX(), hino->getPositionY()) * 100.f));
-			} else {
-				insertByte((int) 0);
-			}
+			insertByte((int) (hino->getResourceDensity(ri) * 100.f));
 		}
 
 	}
@@ -15,6 +15,8 @@ public:
 	InstallationObjectDeltaMessage6(InstallationObject* ins)
 			: DeltaMessage(ins->getObjectID(), 0x494E534F, 6) {
 		inso = ins;
+
+		ins->incrementBaselineVersion();
 	}
 
 
@@ -14,6 +14,7 @@
 #include "server/zone/managers/collision/CollisionManager.h"
 #include "server/zone/managers/collision/IntersectionResults.h"
 #include "server/zone/Zone.h"
+#include "server/zone/managers/statistics/TaskProfiler.h"
 
 class DataTransform : public ObjectControllerMessage {
 public:
@@ -102,6 +103,8 @@ public:
 	}
 
 	void run() {
+		TaskProfiler::Scope profile(this, receivedTime.miliDifference());
+
 		ManagedReference<CreatureObject*> object = client->getPlayer();
 
 		if (object == nullptr)
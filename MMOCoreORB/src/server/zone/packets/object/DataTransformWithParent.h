@@ -16,6 +16,7 @@
 #include "server/zone/objects/player/PlayerObject.h"
 #include "server/zone/objects/cell/CellObject.h"
 #include "server/zone/Zone.h"
+#include "server/zone/managers/statistics/TaskProfiler.h"
 #include "server/zone/managers/collision/CollisionManager.h"
 
 class DataTransformWithParent : public ObjectControllerMessage {
@@ -109,6 +110,8 @@ public:
 	}
 
 	void run() {
+		TaskProfiler::Scope profile(this, receivedTime.miliDifference());
+
 		Reference<CreatureObject*> object = client->getPlayer().get();
 
 		if (object == nullptr)
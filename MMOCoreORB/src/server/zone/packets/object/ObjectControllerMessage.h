@@ -9,6 +9,9 @@
 
 class ObjectControllerMessage : public BaseMessage {
 public:
+	// short + crc + header1 + header2 precede the object id
+	static const int OBJECTID_OFFSET = 14;
+
 	ObjectControllerMessage(uint64 objid, uint32 header1, uint32 header2, bool comp = true) {
 
 		insertShort(0x05);
@@ -22,6 +25,11 @@ public:
 
 	}
 
+	// retargets an already serialized (or cloned) controller message
+	static void setObjectID(Packet* message, uint64 objid) {
+		message->insertLong(OBJECTID_OFFSET, objid);
+	}
+
 };
 
 
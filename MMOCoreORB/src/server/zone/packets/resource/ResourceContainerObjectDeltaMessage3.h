@@ -16,6 +16,8 @@ public:
 	ResourceContainerObjectDeltaMessage3(ResourceContainer* rcno)
 			: DeltaMessage(rcno->getObjectID(), 0x52434E4F, 3) {
 		container = rcno;
+
+		rcno->incrementBaselineVersion();
 	}
 	/*
 	 * Need More Research.
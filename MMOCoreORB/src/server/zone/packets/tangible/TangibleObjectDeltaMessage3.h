@@ -18,6 +18,9 @@ public:
 	TangibleObjectDeltaMessage3(TangibleObject* ta, uint32 objType = 0x54414E4F)
 	: DeltaMessage(ta->getObjectID(), objType, 3) {
 		tano = ta;
+
+		// deltas sent only to the owner never pass through broadcastMessage
+		ta->incrementBaselineVersion();
 	}
 
 	void updateCustomizationString() {
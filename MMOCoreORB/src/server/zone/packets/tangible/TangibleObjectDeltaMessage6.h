@@ -16,6 +16,8 @@ public:
 	TangibleObjectDeltaMessage6(TangibleObject* ta, uint32 objType = 0x54414E4F)
 		: DeltaMessage(ta->getObjectID(), objType, 6) {
 		tano = ta;
+
+		ta->incrementBaselineVersion();
 	}
 
 };
@@ -12,6 +12,7 @@
 #include "server/zone/packets/MessageCallback.h"
 #include "server/db/ServerDatabase.h"
 #include "server/login/packets/ErrorMessage.h"
+#include "server/zone/managers/player/LoginQueue.h"
 #include "server/login/account/Account.h"
 #include "server/login/objects/CharacterList.h"
 #include "server/login/account/AccountManager.h"
@@ -29,7 +30,7 @@ public:
 	ClientIDMessageCallback(ZoneClientSession* client, ZoneProcessServer* server) :
 		MessageCallback(client, server), dataLen(0), accountID(0) {
 
-		setCustomTaskQueue("slowQueue");
+		setCustomTaskQueue(LoginQueue::AUTH_QUEUE);
 	}
 
 	void parse(Message* message) {
@@ -18,6 +18,7 @@
 #include "server/zone/objects/player/PlayerObject.h"
 #include "server/chat/ChatManager.h"
 #include "server/zone/objects/player/events/DisconnectClientEvent.h"
+#include "server/zone/managers/player/LoginQueue.h"
 #ifdef WITH_SESSION_API
 #include "server/login/SessionAPIClient.h"
 #endif // WITH_SESSION_API
@@ -28,7 +29,7 @@ public:
 	SelectCharacterCallback(ZoneClientSession* client, ZoneProcessServer* server) :
 		MessageCallback(client, server), characterID(0) {
 
-		setCustomTaskQueue("slowQueue");
+		setCustomTaskQueue(LoginQueue::PREFETCH_QUEUE);
 	}
 
 	void parse(Message* message) {
@@ -241,44 +242,64 @@ public:
 
 		//Logger::console.info("selected char id: 0x" + String::hexvalueOf((int64)characterID), true);
 
+		// loads the character graph here on the prefetch queue, zone insertion waits for admission
 		ManagedReference<SceneObject*> obj = zoneServer->getObject(characterID, true);
 
-		if (obj != nullptr && obj->isPlayerCreature()) {
-			CreatureObject* player = obj->asCreatureObject();
+		if (obj == nullptr || !obj->isPlayerCreature()) {
+			if (obj != nullptr)
+				client->error("could get from zone server character id " + String::valueOf(characterID) + " but is not a player creature");
+			else
+				client->error("could not get from zone server character id " + String::valueOf(characterID));
 
-			Locker _locker(player);
+			return;
+		}
 
-			ManagedReference<ZoneClientSession*> oldClient = player->getClient();
+		PlayerObject* ghost = obj->asCreatureObject()->getPlayerObject();
+		bool priority = ghost != nullptr && ghost->getAdminLevel() > 0;
 
-			if (oldClient != nullptr && client != oldClient) {
-				_locker.release();
+		auto characterID = this->characterID;
+		auto client = this->client;
 
-				oldClient->disconnect();
+		Reference<Task*> admission = new LambdaTask([obj, characterID, client, zoneServer] () {
+			admitPlayer(obj, characterID, client, zoneServer);
+		}, "LoginAdmissionLambda");
 
-				Reference<DisconnectClientEvent*> task = new DisconnectClientEvent(player, oldClient, DisconnectClientEvent::DISCONNECT);
-				player->executeOrderedTask(task);
+		LoginQueue::instance()->enqueue(client, admission, priority);
+	}
 
-				static const String lambdaName = "ConnectPlayerLambda";
+	static void admitPlayer(SceneObject* obj, uint64 characterID, ZoneClientSession* client, ZoneServer* zoneServer) {
+		if (zoneServer->isServerShuttingDown())
+			return;
 
-				auto characterID = this->characterID;
-				auto client = this->client;
+		CreatureObject* player = obj->asCreatureObject();
 
-				player->executeOrderedTask([obj, characterID, player, client, zoneServer] () {
-					Locker locker(obj);
+		Locker _locker(player);
 
-					connectPlayer(obj, characterID, player, client, zoneServer);
-				}, lambdaName);
+		ManagedReference<ZoneClientSession*> oldClient = player->getClient();
 
-				return;
-			}
+		if (oldClient != nullptr && client != oldClient) {
+			_locker.release();
 
-			connectPlayer(obj, characterID, player, client, zoneServer);
-		} else {
-			if (obj != nullptr)
-				client->error("could get from zone server character id " + String::valueOf(characterID) + " but is not a player creature");
-			else
-				client->error("could not get from zone server character id " + String::valueOf(characterID));
+			oldClient->disconnect();
+
+			Reference<DisconnectClientEvent*> task = new DisconnectClientEvent(player, oldClient, DisconnectClientEvent::DISCONNECT);
+			player->executeOrderedTask(task);
+
+			static const String lambdaName = "ConnectPlayerLambda";
+
+			ManagedReference<SceneObject*> strongObj = obj;
+			Reference<ZoneClientSession*> strongClient = client;
+
+			player->executeOrderedTask([strongObj, characterID, player, strongClient, zoneServer] () {
+				Locker locker(strongObj);
+
+				connectPlayer(strongObj, characterID, player, strongClient, zoneServer);
+			}, lambdaName);
+
+			return;
 		}
+
+		connectPlayer(obj, characterID, player, client, zoneServer);
 	}
 };
 
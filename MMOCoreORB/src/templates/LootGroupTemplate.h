@@ -10,12 +10,24 @@
 
 #include "system/lang.h"
 #include "engine/lua/LuaObject.h"
+#include "server/utils/WeightedSampler.h"
 
 class LootGroupTemplate : public Object {
 	String templateName;
 
 	VectorMap<String, int> entryMap;
 
+	WeightedSampler sampler;
+
+	void buildSampler() {
+		Vector<int> weights(entryMap.size(), 1);
+
+		for (int i = 0; i < entryMap.size(); ++i)
+			weights.add(entryMap.elementAt(i).getValue());
+
+		sampler.build(weights);
+	}
+
 public:
 	LootGroupTemplate(const String& name) {
 		templateName = name;
@@ -31,6 +43,7 @@ public:
 		entryMap.setNullValue(0);
 
 		entryMap = lgt.entryMap;
+		sampler = lgt.sampler;
 	}
 
 	LootGroupTemplate& operator=(const LootGroupTemplate& lgt) {
@@ -39,41 +52,26 @@ public:
 
 		templateName = lgt.templateName;
 		entryMap = lgt.entryMap;
+		sampler = lgt.sampler;
 
 		return *this;
 	}
 
 	String getLootGroupEntryForRoll(int roll) const {
-		int totalChance = 0;
-
-		for (int i = 0; i < entryMap.size(); ++i) {
-			VectorMapEntry<String, int>* entry = &entryMap.elementAt(i);
-			int weight = entry->getValue();
-
-			totalChance += weight;
-
-			if (totalChance >= roll && weight > 0)
-				return entry->getKey();
-		}
+		int index = getLootGroupIntEntryForRoll(roll);
 
 		//Should never get here unless the scripts didn't add up to 10000000.
-		return "";
+		if (index == -1)
+			return "";
+
+		return entryMap.elementAt(index).getKey();
 	}
 
+	/**
+	 * First entry with a weight whose running total reaches roll
+	 */
 	int getLootGroupIntEntryForRoll(int roll) const {
-		int totalChance = 0;
-
-		for (int i = 0; i < entryMap.size(); ++i) {
-			VectorMapEntry<String, int>* entry = &entryMap.elementAt(i);
-			int weight = entry->getValue();
-			totalChance += weight;
-
-			if (totalChance >= roll && weight > 0 )
-				return i;
-		}
-
-		//Should never get here unless the scripts didn't add up to 10000000.
-		return -1;
+		return sampler.findAtLeast(roll, true);
 	}
 
 	int size() const {
@@ -116,6 +114,8 @@ public:
 		}
 
 		lootItems.pop();
+
+		buildSampler();
 	}
 
 	const String& getTemplateName() const {
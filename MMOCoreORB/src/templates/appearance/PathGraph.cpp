@@ -84,6 +84,30 @@ void PathGraph::readObject(IffStream* iffStream) {
 	connectNodes(pathEdges);
 }
 
+const PathRouteTable* PathGraph::getRouteTable() const {
+	if (routeTableBuilt.get())
+		return &routeTable;
+
+	Locker locker(&routeTableMutex);
+
+	if (!routeTableBuilt.get()) {
+		Vector<const PathNode*> nodes(pathNodes.size() + 1, 16);
+
+		for (int i = 0; i < pathNodes.size(); ++i)
+			nodes.add(pathNodes.getUnsafe(i));
+
+		routeTable.build(nodes);
+
+		routeTableBuilt.set(true);
+	}
+
+	return &routeTable;
+}
+
+Vector<const PathNode*>* PathGraph::getPath(const PathNode* source, const PathNode* target) const {
+	return getRouteTable()->getPath(source, target);
+}
+
 const PathNode* PathGraph::getNode(int globalNumberID) const {
 	for (int i = 0; i < pathNodes.size(); ++i) {
 		const PathNode* pathNode = pathNodes.getUnsafe(i);
@@ -9,6 +9,7 @@
 #define PATHGRAPH_H_
 
 #include "templates/appearance/PathNode.h"
+#include "templates/appearance/PathRouteTable.h"
 #include "templates/IffTemplate.h"
 
 class FloorMesh;
@@ -34,6 +35,11 @@ class PathGraph : public IffTemplate {
 
 	FloorMesh* floorMesh;
 
+	// built on the first route lookup, most cell graphs are never routed through
+	mutable PathRouteTable routeTable;
+	mutable AtomicBoolean routeTableBuilt;
+	mutable Mutex routeTableMutex;
+
 protected:
 	void connectNodes(Vector<PathEdge>& pathEdges);
 
@@ -58,6 +64,16 @@ public:
 
 	const PathNode* getNode(int globalNumberID) const;
 
+	/**
+	 * Route inside this graph from the route table, nullptr when there is none
+	 */
+	Vector<const PathNode*>* getPath(const PathNode* source, const PathNode* target) const;
+
+	/**
+	 * Builds the route table on first use
+	 */
+	const PathRouteTable* getRouteTable() const;
+
 	inline const PathNode* findNearestNode(float x, float z, float y) const {
 		return findNearestNode(Vector3(x, y, z));
 	}
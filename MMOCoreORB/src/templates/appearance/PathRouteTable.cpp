@@ -0,0 +1,159 @@
+/*
+ * PathRouteTable.cpp
+ */
+
+#include "PathRouteTable.h"
+#include "templates/appearance/PathGraph.h"
+
+#include <queue>
+#include <functional>
+
+bool PathRouteTable::build(const Vector<const PathNode*>& graphNodes) {
+	nodes.removeAll();
+	indexes.removeAll();
+	nextHops.removeAll();
+	previousHops.removeAll();
+	distances.removeAll();
+
+	int count = graphNodes.size();
+
+	if (count == 0 || count > MAX_NODES)
+		return false;
+
+	for (int i = 0; i < count; ++i) {
+		const PathNode* node = graphNodes.getUnsafe(i);
+
+		nodes.add(node);
+		indexes.put(node, i);
+	}
+
+	nextHops.removeAll(count * count, 16);
+	previousHops.removeAll(count * count, 16);
+	distances.removeAll(count * count, 16);
+
+	for (int i = 0; i < count * count; ++i) {
+		nextHops.add(NO_ROUTE);
+		previousHops.add(NO_ROUTE);
+		distances.add(-1.f);
+	}
+
+	for (int i = 0; i < count; ++i)
+		buildFrom(i);
+
+	return true;
+}
+
+void PathRouteTable::buildFrom(int source) {
+	typedef std::pair<float, int> QueueEntry;
+
+	int count = nodes.size();
+	int row = source * count;
+
+	Vector<bool> settled(count, 16);
+
+	for (int i = 0; i < count; ++i)
+		settled.add(false);
+
+	std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry> > queue;
+
+	distances.set(row + source, 0.f);
+	nextHops.set(row + source, source);
+	previousHops.set(row + source, source);
+	queue.push(QueueEntry(0.f, source));
+
+	while (!queue.empty()) {
+		QueueEntry top = queue.top();
+		queue.pop();
+
+		int current = top.second;
+
+		if (settled.getUnsafe(current))
+			continue;
+
+		settled.set(current, true);
+
+		// nodes are settled after the node before them, so its next hop is known
+		int prev = previousHops.getUnsafe(row + current);
+
+		if (prev == source)
+			nextHops.set(row + current, current);
+		else if (current != source)
+			nextHops.set(row + current, nextHops.getUnsafe(row + prev));
+
+		const PathNode* node = nodes.getUnsafe(current);
+		const Vector<PathNode*>* neighbors = node->getNeighbors();
+
+		for (int i = 0; i < neighbors->size(); ++i) {
+			const PathNode* neighbor = neighbors->getUnsafe(i);
+
+			int index = getIndex(neighbor);
+
+			if (index == -1 || settled.getUnsafe(index))
+				continue;
+
+			float distance = top.first + PathGraph::calculateManhattanDistance(node, neighbor);
+			float known = distances.getUnsafe(row + index);
+
+			if (known < 0 || distance < known) {
+				distances.set(row + index, distance);
+				previousHops.set(row + index, current);
+
+				queue.push(QueueEntry(distance, index));
+			}
+		}
+	}
+}
+
+Vector<const PathNode*>* PathRouteTable::getPath(const PathNode* source, const PathNode* target) const {
+	int from = getIndex(source);
+	int to = getIndex(target);
+
+	if (from == -1 || to == -1)
+		return nullptr;
+
+	int count = nodes.size();
+
+	int row = from * count;
+
+	if (previousHops.getUnsafe(row + to) == NO_ROUTE)
+		return nullptr;
+
+	// walked back along the tree of the source, the rows of the nodes on the way may break ties differently
+	Vector<const PathNode*> reversed(8, 8);
+
+	for (int current = to; current != from; current = previousHops.getUnsafe(row + current))
+		reversed.add(nodes.getUnsafe(current));
+
+	Vector<const PathNode*>* path = new Vector<const PathNode*>(reversed.size() + 1, 8);
+	path->add(source);
+
+	for (int i = reversed.size() - 1; i >= 0; --i)
+		path->add(reversed.getUnsafe(i));
+
+	return path;
+}
+
+float PathRouteTable::getDistance(const PathNode* source, const PathNode* target) const {
+	int from = getIndex(source);
+	int to = getIndex(target);
+
+	if (from == -1 || to == -1)
+		return -1.f;
+
+	return distances.getUnsafe(from * nodes.size() + to);
+}
+
+const PathNode* PathRouteTable::getNextHop(const PathNode* source, const PathNode* target) const {
+	int from = getIndex(source);
+	int to = getIndex(target);
+
+	if (from == -1 || to == -1)
+		return nullptr;
+
+	uint16 hop = nextHops.getUnsafe(from * nodes.size() + to);
+
+	if (hop == NO_ROUTE)
+		return nullptr;
+
+	return nodes.getUnsafe(hop);
+}
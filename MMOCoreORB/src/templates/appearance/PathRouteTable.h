@@ -0,0 +1,74 @@
+/*
+ * PathRouteTable.h
+ *
+ * All pairs distances and next hops over a set of path nodes, built once per
+ * graph so routes are looked up instead of searched.
+ */
+
+#ifndef PATHROUTETABLE_H_
+#define PATHROUTETABLE_H_
+
+#include "templates/appearance/PathNode.h"
+
+class PathRouteTable {
+public:
+	// graphs above this are left to AStarAlgorithm, the tables grow with the square of the nodes
+	static const int MAX_NODES = 512;
+
+	static const uint16 NO_ROUTE = 0xFFFF;
+
+protected:
+	Vector<const PathNode*> nodes;
+	VectorMap<const PathNode*, int> indexes;
+
+	// row per source, the first node after it and the node before each target
+	Vector<uint16> nextHops;
+	Vector<uint16> previousHops;
+	Vector<float> distances;
+
+	inline int getIndex(const PathNode* node) const {
+		int pos = indexes.find(node);
+
+		return pos == -1 ? -1 : indexes.elementAt(pos).getValue();
+	}
+
+	void buildFrom(int source);
+
+public:
+	PathRouteTable() {
+		indexes.setNoDuplicateInsertPlan();
+	}
+
+	/**
+	 * Edges leading out of the node set are ignored, the edge costs are the
+	 * PathGraph::calculateManhattanDistance AStarAlgorithm uses
+	 */
+	bool build(const Vector<const PathNode*>& graphNodes);
+
+	inline bool isBuilt() const {
+		return !nodes.isEmpty();
+	}
+
+	inline bool contains(const PathNode* node) const {
+		return indexes.find(node) != -1;
+	}
+
+	inline int getNodeCount() const {
+		return nodes.size();
+	}
+
+	/**
+	 * Nodes from source to target both included like AStarAlgorithm, nullptr when either
+	 * node is not in the table or target can not be reached
+	 */
+	Vector<const PathNode*>* getPath(const PathNode* source, const PathNode* target) const;
+
+	/**
+	 * Sum of the edge costs of the route, -1 when there is none
+	 */
+	float getDistance(const PathNode* source, const PathNode* target) const;
+
+	const PathNode* getNextHop(const PathNode* source, const PathNode* target) const;
+};
+
+#endif /* PATHROUTETABLE_H_ */
@@ -294,6 +294,32 @@ void PortalLayout::connectFloorMeshGraphs() {
 			}
 		}
 	}
+
+	buildRouteTable();
+}
+
+void PortalLayout::buildRouteTable() {
+	Vector<const PathNode*> nodes;
+
+	for (int i = 0; i < cellProperties.size(); ++i) {
+		const FloorMesh* floorMesh = getFloorMesh(i);
+
+		if (floorMesh == nullptr)
+			continue;
+
+		const PathGraph* pathGraph = floorMesh->getPathGraph();
+
+		if (pathGraph == nullptr)
+			continue;
+
+		const Vector<PathNode*>* pathNodes = pathGraph->getPathNodes();
+
+		for (int j = 0; j < pathNodes->size(); ++j)
+			nodes.add(pathNodes->getUnsafe(j));
+	}
+
+	if (!routeTable.build(nodes) && nodes.size() > PathRouteTable::MAX_NODES)
+		debug() << nodes.size() << " path nodes, routes are searched";
 }
 
 int PortalLayout::getFloorMeshID(int globalNodeID, int floorMeshToExclude) const {
@@ -335,6 +361,13 @@ void PortalLayout::parseCELSForm(IffStream* iffStream, int numCells) {
 }
 
 Vector<const PathNode*>* PortalLayout::getPath(const PathNode* node1, const PathNode* node2) const {
+	if (routeTable.contains(node1) && routeTable.contains(node2))
+		return routeTable.getPath(node1, node2);
+
+	return searchPath(node1, node2);
+}
+
+Vector<const PathNode*>* PortalLayout::searchPath(const PathNode* node1, const PathNode* node2) const {
 	return AStarAlgorithm<PathGraph, PathNode>::search<uint32>(node1->getPathGraph(), node1, node2);
 }
 
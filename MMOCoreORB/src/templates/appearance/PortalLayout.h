@@ -15,6 +15,7 @@
 #include "templates/appearance/FloorMesh.h"
 #include "templates/appearance/AppearanceTemplate.h"
 #include "templates/appearance/PathGraph.h"
+#include "templates/appearance/PathRouteTable.h"
 
 class PortalGeometry : public Object {
 	Reference<MeshData*> geometry;
@@ -43,6 +44,11 @@ class PortalLayout : public IffTemplate, public Logger {
 	PathGraph* pathGraph;
 	Vector<Reference<PortalGeometry*> > portalGeometry;
 	Vector<Reference<CellProperty*> > cellProperties;
+
+	// routes between the nodes of all cells, built once the cell graphs are connected
+	PathRouteTable routeTable;
+
+	void buildRouteTable();
 public:
 	PortalLayout();
 	~PortalLayout();
@@ -68,6 +74,15 @@ public:
 
 	Vector<const PathNode*>* getPath(const PathNode* node1, const PathNode* node2) const;
 
+	/**
+	 * The search getPath used before the route table, for layouts too large for one
+	 */
+	Vector<const PathNode*>* searchPath(const PathNode* node1, const PathNode* node2) const;
+
+	inline const PathRouteTable* getRouteTable() const {
+		return &routeTable;
+	}
+
 	int getCellID(const String& cellName) const;
 
 	inline int getCellTotalNumber() const {
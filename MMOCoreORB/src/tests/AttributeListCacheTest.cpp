@@ -0,0 +1,165 @@
+/*
+ * AttributeListCacheTest.cpp
+ *
+ * Cached attribute lists have to be byte for byte what a fresh build produces
+ * for the current attribute list version, and a 999 item batch is timed with
+ * and without the cache.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/zone/objects/scene/AttributeListCache.h"
+#include "server/zone/objects/tangible/TangibleObject.h"
+#include "server/zone/packets/scene/AttributeListMessage.h"
+
+class AttributeListCacheTest : public ::testing::Test {
+protected:
+	AtomicLong nextObjectId;
+
+public:
+	static const int BATCH_SIZE = 999;
+
+	AttributeListCacheTest() {
+		nextObjectId = 0x30000000;
+	}
+
+	void SetUp() {
+		AttributeListCache::instance()->setEnabled(true);
+		AttributeListCache::instance()->clear();
+	}
+
+	Reference<TangibleObject*> createItem(const String& attributeListComponent = "AttributeListComponent") {
+		Reference<TangibleObject*> object = new TangibleObject();
+		object->setContainerComponent("ContainerComponent");
+		object->setZoneComponent("ZoneComponent");
+		object->setAttributeListComponent(attributeListComponent);
+		object->_setObjectID(nextObjectId.increment());
+		object->initializeContainerObjectsMap();
+
+		object->setCraftersName("Crafter " + String::valueOf(object->getObjectID() % 100));
+		object->setUseCount(System::random(50) + 2, false);
+
+		return object;
+	}
+
+	static bool samePayload(BasePacket* a, BasePacket* b) {
+		return a->size() == b->size() && memcmp(a->getBuffer(), b->getBuffer(), a->size()) == 0;
+	}
+
+	static void release(BasePacket* packet) {
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+		if (!packet->getReferenceCount())
+#endif
+		delete packet;
+	}
+};
+
+TEST_F(AttributeListCacheTest, CachedListMatchesFreshBuild) {
+	Reference<TangibleObject*> item = createItem();
+	AttributeListCache* cache = AttributeListCache::instance();
+
+	uint64 hits = cache->getHits();
+	uint64 misses = cache->getMisses();
+
+	BasePacket* built = cache->getAttributeList(item, nullptr);
+	BasePacket* cached = cache->getAttributeList(item, nullptr);
+
+	ASSERT_TRUE(built != nullptr);
+	ASSERT_TRUE(cached != nullptr);
+
+	EXPECT_EQ(cache->getHits(), hits + 1);
+	EXPECT_EQ(cache->getMisses(), misses + 1);
+
+	BasePacket* fresh = item->createAttributeListMessage(nullptr);
+
+	EXPECT_TRUE(samePayload(built, fresh));
+	EXPECT_TRUE(samePayload(cached, fresh));
+
+	release(built);
+	release(cached);
+	delete fresh;
+}
+
+TEST_F(AttributeListCacheTest, VersionBumpRebuildsFromCurrentState) {
+	Reference<TangibleObject*> item = createItem();
+	AttributeListCache* cache = AttributeListCache::instance();
+
+	release(cache->getAttributeList(item, nullptr));
+
+	item->setCraftersName("Someone Else");
+
+	// the old list is still served until something bumps the version
+	BasePacket* stale = cache->getAttributeList(item, nullptr);
+	BasePacket* fresh = item->createAttributeListMessage(nullptr);
+
+	EXPECT_FALSE(samePayload(stale, fresh));
+
+	item->incrementAttributeListVersion();
+
+	uint64 misses = cache->getMisses();
+
+	BasePacket* rebuilt = cache->getAttributeList(item, nullptr);
+
+	EXPECT_EQ(cache->getMisses(), misses + 1);
+	EXPECT_TRUE(samePayload(rebuilt, fresh));
+
+	release(stale);
+	release(rebuilt);
+	delete fresh;
+}
+
+TEST_F(AttributeListCacheTest, ViewerDependentListsAreNotCached) {
+	Reference<TangibleObject*> item = createItem();
+
+	// lists the cooldown of the viewer
+	Reference<TangibleObject*> ring = createItem("HeroRingAttributeListComponent");
+
+	EXPECT_EQ(item->getAttributeListViewerKey(nullptr), 0);
+	EXPECT_EQ(ring->getAttributeListViewerKey(nullptr), -1);
+}
+
+TEST_F(AttributeListCacheTest, BatchBenchmark) {
+	Vector<Reference<TangibleObject*> > items;
+
+	for (int i = 0; i < BATCH_SIZE; ++i)
+		items.add(createItem());
+
+	AttributeListCache* cache = AttributeListCache::instance();
+
+	const int batches = 100;
+
+	uint64 bytes = 0;
+
+	Time start;
+
+	for (int batch = 0; batch < batches; ++batch) {
+		for (int i = 0; i < items.size(); ++i) {
+			BasePacket* packet = items.getUnsafe(i)->createAttributeListMessage(nullptr);
+
+			bytes += packet->size();
+
+			delete packet;
+		}
+	}
+
+	uint64 buildTime = Math::max((uint64) 1, start.miliDifference());
+
+	uint64 hits = cache->getHits();
+	uint64 misses = cache->getMisses();
+
+	start.updateToCurrentTime();
+
+	for (int batch = 0; batch < batches; ++batch) {
+		for (int i = 0; i < items.size(); ++i)
+			release(cache->getAttributeList(items.getUnsafe(i), nullptr));
+	}
+
+	uint64 cacheTime = Math::max((uint64) 1, start.miliDifference());
+
+	EXPECT_EQ(cache->getMisses() - misses, (uint64) BATCH_SIZE);
+	EXPECT_EQ(cache->getHits() - hits, (uint64) BATCH_SIZE * (batches - 1));
+
+	System::out << batches << " batches of " << BATCH_SIZE << " items (" << bytes / batches << " bytes each batch): built "
+		<< buildTime << "ms, cached " << cacheTime << "ms" << endl;
+	System::out << cache->getInfo() << endl;
+}
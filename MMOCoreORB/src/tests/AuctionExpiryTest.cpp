@@ -0,0 +1,170 @@
+/*
+ * AuctionExpiryTest.cpp
+ *
+ * The expiry index has to hand out every listing once it is due and nothing
+ * else, and the periodic check through it is compared with the old sweep of
+ * every terminal list at 10k, 100k and 1M listings.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/zone/managers/auction/AuctionExpiryIndex.h"
+
+class AuctionExpiryTest : public ::testing::Test {
+public:
+	static const int LISTINGS_PER_TERMINAL = 250;
+	static const uint64 MAINT_PERIOD = 60 * 60;
+	static const uint64 LISTING_PERIOD = 30 * 24 * 60 * 60;
+
+	// stand in for the terminal lists doAuctionMaint walks
+	static void createListings(int count, uint64 now, Vector<Vector<AuctionExpiryEntry> >& terminals, AuctionExpiryIndex& index) {
+		Vector<AuctionExpiryEntry> terminal;
+
+		for (int i = 0; i < count; ++i) {
+			AuctionExpiryEntry entry(now + System::random(LISTING_PERIOD), i + 1);
+
+			terminal.add(entry);
+			index.schedule(entry.id, entry.expireTime);
+
+			if (terminal.size() == LISTINGS_PER_TERMINAL) {
+				terminals.add(terminal);
+				terminal.removeAll();
+			}
+		}
+
+		if (terminal.size() > 0)
+			terminals.add(terminal);
+	}
+
+	static int sweep(const Vector<Vector<AuctionExpiryEntry> >& terminals, uint64 now) {
+		int due = 0;
+
+		for (int i = 0; i < terminals.size(); ++i) {
+			// the maintenance copies each list before checking its items
+			Vector<AuctionExpiryEntry> list(terminals.get(i));
+
+			for (int j = 0; j < list.size(); ++j) {
+				if (list.getUnsafe(j).expireTime <= now)
+					++due;
+			}
+		}
+
+		return due;
+	}
+};
+
+TEST_F(AuctionExpiryTest, DueInExpireOrder) {
+	AuctionExpiryIndex index;
+
+	index.schedule(1, 300);
+	index.schedule(2, 100);
+	index.schedule(3, 200);
+	index.schedule(4, 500);
+
+	Vector<uint64> ids;
+
+	EXPECT_EQ(index.pollDue(50, ids), 0);
+	EXPECT_EQ(index.getNextExpireTime(), (uint64) 100);
+
+	EXPECT_EQ(index.pollDue(300, ids), 3);
+	ASSERT_EQ(ids.size(), 3);
+	EXPECT_EQ(ids.get(0), (uint64) 2);
+	EXPECT_EQ(ids.get(1), (uint64) 3);
+	EXPECT_EQ(ids.get(2), (uint64) 1);
+
+	EXPECT_EQ(index.size(), 1);
+	EXPECT_FALSE(index.contains(1));
+	EXPECT_TRUE(index.contains(4));
+}
+
+TEST_F(AuctionExpiryTest, RescheduleAndRemove) {
+	AuctionExpiryIndex index;
+
+	index.schedule(1, 100);
+	index.schedule(2, 100);
+	index.schedule(3, 100);
+
+	// relisted, withdrawn, and expired into its pickup period
+	index.schedule(1, 1000);
+	index.remove(2);
+	index.schedule(3, 50);
+
+	Vector<uint64> ids;
+
+	EXPECT_EQ(index.pollDue(500, ids), 1);
+	ASSERT_EQ(ids.size(), 1);
+	EXPECT_EQ(ids.get(0), (uint64) 3);
+
+	EXPECT_EQ(index.size(), 1);
+	EXPECT_EQ(index.getNextExpireTime(), (uint64) 1000);
+
+	ids.removeAll();
+
+	EXPECT_EQ(index.pollDue(1000, ids), 1);
+	EXPECT_EQ(ids.get(0), (uint64) 1);
+	EXPECT_EQ(index.getNextExpireTime(), (uint64) 0);
+}
+
+TEST_F(AuctionExpiryTest, StaleEntriesAreCompacted) {
+	AuctionExpiryIndex index;
+
+	const int count = 5000;
+
+	for (int round = 0; round < 10; ++round) {
+		for (int i = 0; i < count; ++i)
+			index.schedule(i, round * 1000 + i);
+	}
+
+	EXPECT_EQ(index.size(), count);
+	EXPECT_LE(index.getHeapSize(), count * 2);
+
+	Vector<uint64> ids;
+
+	EXPECT_EQ(index.pollDue(100000, ids), count);
+	EXPECT_EQ(index.size(), 0);
+}
+
+TEST_F(AuctionExpiryTest, MaintenanceBenchmark) {
+	const int sizes[] = { 10000, 100000, 1000000 };
+
+	for (int size : sizes) {
+		uint64 now = time(0);
+
+		Vector<Vector<AuctionExpiryEntry> > terminals;
+		AuctionExpiryIndex index;
+
+		createListings(size, now, terminals, index);
+
+		const int runs = 24;
+
+		uint64 sweepTime = 0;
+		uint64 indexTime = 0;
+		int sweepDue = 0;
+		int indexDue = 0;
+
+		for (int run = 1; run <= runs; ++run) {
+			uint64 runTime = now + run * MAINT_PERIOD;
+
+			Time start;
+
+			sweepDue = sweep(terminals, runTime);
+
+			sweepTime += start.miliDifference();
+
+			start.updateToCurrentTime();
+
+			Vector<uint64> ids;
+			index.pollDue(runTime, ids);
+
+			indexDue += ids.size();
+
+			indexTime += start.miliDifference();
+		}
+
+		// the sweep sees everything due so far, the index each listing once
+		EXPECT_EQ(sweepDue, indexDue);
+
+		System::out << size << " listings, " << runs << " hourly checks: full sweep " << sweepTime << "ms, expiry index "
+			<< indexTime << "ms, " << indexDue << " listings due" << endl;
+	}
+}
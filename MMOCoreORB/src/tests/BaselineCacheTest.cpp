@@ -0,0 +1,148 @@
+/*
+ * BaselineCacheTest.cpp
+ *
+ * Cached baselines have to be byte for byte what a fresh build produces.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/zone/objects/scene/BaselineCache.h"
+#include "server/zone/objects/tangible/terminal/Terminal.h"
+#include "server/zone/packets/tangible/TangibleObjectMessage3.h"
+#include "server/zone/packets/tangible/TangibleObjectMessage6.h"
+
+class BaselineCacheTest : public ::testing::Test {
+protected:
+	AtomicLong nextObjectId;
+
+public:
+	BaselineCacheTest() {
+		nextObjectId = 0x20000000;
+	}
+
+	void SetUp() {
+		BaselineCache::instance()->setEnabled(true);
+		BaselineCache::instance()->clear();
+	}
+
+	template<class T>
+	Reference<T*> createObject() {
+		Reference<T*> object = new T();
+		object->setContainerComponent("ContainerComponent");
+		object->setZoneComponent("ZoneComponent");
+		object->_setObjectID(nextObjectId.increment());
+		object->initializeContainerObjectsMap();
+
+		return object;
+	}
+
+	static bool samePayload(BasePacket* a, BasePacket* b) {
+		return a->size() == b->size() && memcmp(a->getBuffer(), b->getBuffer(), a->size()) == 0;
+	}
+
+	static void release(BasePacket* packet) {
+#ifdef LOCKFREE_BCLIENT_BUFFERS
+		if (!packet->getReferenceCount())
+#endif
+		delete packet;
+	}
+};
+
+TEST_F(BaselineCacheTest, CachedBaselineMatchesFreshBuild) {
+	Reference<Terminal*> terminal = createObject<Terminal>();
+	terminal->setCustomObjectName("Coronet Starport Terminal", false);
+
+	Terminal* tano = terminal;
+	BaselineCache* cache = BaselineCache::instance();
+
+	uint64 hits = cache->getHits();
+
+	BasePacket* built = cache->get(terminal, 3, [tano] () { return new TangibleObjectMessage3(tano); });
+	BasePacket* cached = cache->get(terminal, 3, [tano] () { return new TangibleObjectMessage3(tano); });
+	BasePacket* cached6 = cache->get(terminal, 6, [tano] () { return new TangibleObjectMessage6(tano); });
+	BasePacket* cached6Again = cache->get(terminal, 6, [tano] () { return new TangibleObjectMessage6(tano); });
+
+	EXPECT_EQ(cache->getHits(), hits + 2);
+
+	TangibleObjectMessage3 fresh3(tano);
+	TangibleObjectMessage6 fresh6(tano);
+
+	EXPECT_TRUE(samePayload(built, &fresh3));
+	EXPECT_TRUE(samePayload(cached, &fresh3));
+	EXPECT_TRUE(samePayload(cached6, &fresh6));
+	EXPECT_TRUE(samePayload(cached6Again, &fresh6));
+
+	release(built);
+	release(cached);
+	release(cached6);
+	release(cached6Again);
+}
+
+TEST_F(BaselineCacheTest, ChangeWithoutBroadcastRebuilds) {
+	Reference<Terminal*> terminal = createObject<Terminal>();
+	terminal->setCustomObjectName("before", false);
+
+	Terminal* tano = terminal;
+	BaselineCache* cache = BaselineCache::instance();
+
+	release(cache->get(terminal, 3, [tano] () { return new TangibleObjectMessage3(tano); }));
+
+	// no delta is sent, the setter alone has to bump the version
+	terminal->setCustomObjectName("after", false);
+	terminal->setOptionsBitmask(terminal->getOptionsBitmask() | 0x100, false);
+
+	BasePacket* rebuilt = cache->get(terminal, 3, [tano] () { return new TangibleObjectMessage3(tano); });
+
+	TangibleObjectMessage3 fresh(tano);
+
+	EXPECT_TRUE(samePayload(rebuilt, &fresh));
+
+	release(rebuilt);
+}
+
+TEST_F(BaselineCacheTest, StaleBuildIsNotStored) {
+	Reference<Terminal*> terminal = createObject<Terminal>();
+	terminal->setCustomObjectName("before", false);
+
+	Terminal* tano = terminal;
+	BaselineCache* cache = BaselineCache::instance();
+
+	// the name changes while the first baseline is being built
+	release(cache->get(terminal, 3, [tano] () {
+		BasePacket* packet = new TangibleObjectMessage3(tano);
+		tano->setCustomObjectName("after", false);
+
+		return packet;
+	}));
+
+	uint64 hits = cache->getHits();
+
+	BasePacket* current = cache->get(terminal, 3, [tano] () { return new TangibleObjectMessage3(tano); });
+	BasePacket* cached = cache->get(terminal, 3, [tano] () { return new TangibleObjectMessage3(tano); });
+
+	EXPECT_EQ(cache->getHits(), hits + 1);
+
+	TangibleObjectMessage3 fresh(tano);
+
+	EXPECT_TRUE(samePayload(current, &fresh));
+	EXPECT_TRUE(samePayload(cached, &fresh));
+
+	release(current);
+	release(cached);
+}
+
+TEST_F(BaselineCacheTest, UncacheableObjectsAlwaysBuild) {
+	Reference<TangibleObject*> object = createObject<TangibleObject>();
+
+	TangibleObject* tano = object;
+	int builds = 0;
+
+	for (int i = 0; i < 3; ++i) {
+		release(BaselineCache::instance()->get(object, 3, [tano, &builds] () {
+			++builds;
+			return new TangibleObjectMessage3(tano);
+		}));
+	}
+
+	EXPECT_EQ(builds, 3);
+}
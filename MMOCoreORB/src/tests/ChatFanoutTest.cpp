@@ -0,0 +1,187 @@
+/*
+ * ChatFanoutTest.cpp
+ *
+ * Compares spatial and room chat delivery with one serialized payload per
+ * message against building a packet per receiver.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/chat/ChatFanout.h"
+#include "server/zone/packets/object/SpatialChat.h"
+#include "server/zone/packets/chat/ChatRoomMessage.h"
+#include "server/chat/room/ChatRoom.h"
+#include "server/db/ServerDatabase.h"
+#include "server/zone/ZoneServer.h"
+#include "server/zone/objects/creature/CreatureObject.h"
+#include "server/zone/objects/player/PlayerObject.h"
+
+class FanoutReceiver {
+	uint64 objectID;
+
+public:
+	Vector<BasePacket*> received;
+
+	FanoutReceiver(uint64 oid) : objectID(oid) {
+	}
+
+	~FanoutReceiver() {
+		for (int i = 0; i < received.size(); ++i)
+			delete received.get(i);
+	}
+
+	uint64 getObjectID() const {
+		return objectID;
+	}
+
+	void sendMessage(BasePacket* packet) {
+		received.add(packet);
+	}
+};
+
+class ChatFanoutTest : public ::testing::Test {
+protected:
+	UnicodeString message;
+	Vector<FanoutReceiver*> receivers;
+
+public:
+	ChatFanoutTest() : message("a busy cantina line with a few words in it so the body is not trivially small") {
+	}
+
+	void addReceivers(int count) {
+		for (int i = 0; i < count; ++i)
+			receivers.add(new FanoutReceiver(0x10000000ULL + i));
+	}
+
+	void TearDown() {
+		for (int i = 0; i < receivers.size(); ++i)
+			delete receivers.get(i);
+
+		receivers.removeAll();
+	}
+
+	static bool samePayload(Packet* a, Packet* b) {
+		return a->size() == b->size() && memcmp(a->getBuffer(), b->getBuffer(), a->size()) == 0;
+	}
+};
+
+TEST_F(ChatFanoutTest, PatchedPayloadMatchesPerReceiverPacket) {
+	addReceivers(8);
+
+	uint64 sourceID = 0x10000000ULL;
+
+	ChatFanout::send(new SpatialChat(sourceID, sourceID, 0, message, 32, 1, 0, 0, 1), receivers);
+
+	for (int i = 0; i < receivers.size(); ++i) {
+		FanoutReceiver* receiver = receivers.get(i);
+
+		ASSERT_EQ(receiver->received.size(), 1);
+
+		SpatialChat expected(sourceID, receiver->getObjectID(), 0, message, 32, 1, 0, 0, 1);
+
+		EXPECT_TRUE(samePayload(receiver->received.get(0), &expected)) << "receiver " << i;
+	}
+}
+
+TEST_F(ChatFanoutTest, GroupFilterMatchesLegacyRules) {
+	// receiver is source or chat target
+	EXPECT_TRUE(ChatFanout::isGroupRecipient(1, 0, 1, 2, 0, 0));
+	EXPECT_TRUE(ChatFanout::isGroupRecipient(2, 0, 1, 2, 0, 0));
+
+	// ungrouped receivers never match an ungrouped target or source
+	EXPECT_FALSE(ChatFanout::isGroupRecipient(3, 0, 1, 2, 0, 0));
+
+	EXPECT_TRUE(ChatFanout::isGroupRecipient(3, 7, 1, 2, 7, 0));
+	EXPECT_TRUE(ChatFanout::isGroupRecipient(3, 9, 1, 2, 7, 9));
+	EXPECT_FALSE(ChatFanout::isGroupRecipient(3, 8, 1, 2, 7, 9));
+}
+
+TEST_F(ChatFanoutTest, CantinaBenchmark) {
+	const int players = 300;
+	const int lines = 50;
+
+	addReceivers(players);
+
+	uint64 sourceID = 0x10000000ULL;
+
+	Time start;
+
+	for (int l = 0; l < lines; ++l) {
+		for (int i = 0; i < players; ++i) {
+			FanoutReceiver* receiver = receivers.getUnsafe(i);
+			receiver->sendMessage(new SpatialChat(sourceID, receiver->getObjectID(), 0, message, 32, 1, 0, 0, 1));
+		}
+	}
+
+	uint64 perReceiver = start.miliDifference();
+
+	TearDown();
+	addReceivers(players);
+
+	start.updateToCurrentTime();
+
+	for (int l = 0; l < lines; ++l)
+		ChatFanout::send(new SpatialChat(sourceID, sourceID, 0, message, 32, 1, 0, 0, 1), receivers);
+
+	uint64 shared = start.miliDifference();
+
+	System::out << "cantina " << players << " players x " << lines << " lines: per receiver " << perReceiver
+		<< "ms, shared payload " << shared << "ms" << endl;
+
+	EXPECT_EQ(receivers.get(players - 1)->received.size(), lines);
+}
+
+TEST_F(ChatFanoutTest, ChannelBenchmark) {
+	const int members = 5000;
+	const int lines = 10;
+
+	ConfigManager::instance()->loadConfigData();
+	ConfigManager::instance()->setProgressMonitors(false);
+
+	ServerDatabase database(ConfigManager::instance());
+	Reference<ZoneServer*> zoneServer = new ZoneServer(ConfigManager::instance());
+
+	Reference<ChatRoom*> room = new ChatRoom();
+	room->_setObjectID(0x20000000ULL);
+	room->init(zoneServer, nullptr, "channel");
+
+	Vector<Reference<CreatureObject*> > players(members, 10);
+
+	for (int i = 0; i < members; ++i) {
+		Reference<CreatureObject*> player = new CreatureObject();
+		player->_setObjectID(0x10000000ULL + i);
+		player->setCustomObjectName(UnicodeString("member" + String::valueOf(i)), false);
+
+		// rooms only need the ghost to record the room id
+		Reference<PlayerObject*> ghost = new PlayerObject();
+		ghost->_setObjectID(0x18000000ULL + i);
+		player->getSlottedObjects()->put("ghost", ghost.get());
+
+		room->addPlayer(player);
+		players.add(player);
+	}
+
+	ASSERT_EQ(room->getPlayerSize(), members);
+
+	Time start;
+
+	for (int l = 0; l < lines; ++l) {
+		for (int i = 0; i < members; ++i)
+			players.getUnsafe(i)->sendMessage(new ChatRoomMessage("sender", "Core3", message, room->getRoomID()));
+	}
+
+	uint64 perReceiver = start.miliDifference();
+
+	start.updateToCurrentTime();
+
+	for (int l = 0; l < lines; ++l)
+		room->broadcastMessage(new ChatRoomMessage("sender", "Core3", message, room->getRoomID()));
+
+	uint64 shared = start.miliDifference();
+
+	System::out << "channel " << members << " members x " << lines << " lines: per member " << perReceiver
+		<< "ms, room broadcast " << shared << "ms" << endl;
+
+	Locker locker(room);
+	room->removeAllPlayers();
+}
@@ -220,3 +220,39 @@ TEST_F(ConfigManagerTest, JSONTest) {
 TEST_F(ConfigManagerTest, DumpConfig) {
 	configManager->dumpConfig(false);
 }
+
+TEST_F(ConfigManagerTest, HandleFollowsUpdates) {
+	static ConfigHandle<int> intHandle("Core3.TestHandleInt", 42);
+	static ConfigHandle<String> stringHandle("Core3.TestHandleString", "default");
+
+	ASSERT_EQ(intHandle.get(), 42);
+	ASSERT_EQ(stringHandle.get(), "default");
+
+	int calls = 0;
+
+	int listener = configManager->addChangeListener("Core3.TestHandle", [&calls]() {
+		++calls;
+	});
+
+	ASSERT_TRUE(configManager->setInt("Core3.TestHandleInt", 7));
+	ASSERT_TRUE(configManager->setString("Core3.TestHandleString", "updated"));
+
+	ASSERT_EQ(intHandle.get(), 7);
+	ASSERT_EQ(stringHandle.get(), "updated");
+
+	// one call per listener no matter how many of its keys changed
+	configManager->dispatchChangeNotifications();
+	ASSERT_EQ(calls, 1);
+
+	configManager->dispatchChangeNotifications();
+	ASSERT_EQ(calls, 1);
+
+	configManager->removeChangeListener(listener);
+
+	// keys that are not in config.lua are gone after a reload
+	ASSERT_TRUE(configManager->reloadConfigData() > 0);
+
+	ASSERT_EQ(intHandle.get(), 42);
+	ASSERT_EQ(stringHandle.get(), "default");
+	ASSERT_EQ(calls, 1);
+}
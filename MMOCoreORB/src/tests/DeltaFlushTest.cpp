@@ -0,0 +1,229 @@
+/*
+ * DeltaFlushTest.cpp
+ *
+ * Drives a creature's ham, wound and state setters through the zone's
+ * DeltaFlushQueue and CreatureObject::flushDirtyDeltas, and times combat
+ * rounds with a delta per setter call against one flush per round.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/db/ServerDatabase.h"
+#include "server/zone/Zone.h"
+#include "server/zone/ZoneProcessServer.h"
+#include "server/zone/DeltaFlushQueue.h"
+#include "server/zone/objects/creature/CreatureObject.h"
+#include "templates/creature/SharedCreatureObjectTemplate.h"
+
+class DeltaFlushTest : public ::testing::Test {
+protected:
+	ServerDatabase* database = nullptr;
+	Reference<ZoneServer*> zoneServer;
+	Reference<ZoneProcessServer*> processServer;
+	Reference<Zone*> zone;
+	Reference<SharedCreatureObjectTemplate*> creatureTemplate;
+	AtomicLong nextObjectId;
+
+public:
+	DeltaFlushTest() {
+		nextObjectId = 0x10000000;
+
+		ConfigManager::instance()->loadConfigData();
+		ConfigManager::instance()->setProgressMonitors(false);
+		auto configManager = ConfigManager::instance();
+
+		database = new ServerDatabase(configManager);
+		zoneServer = new ZoneServer(configManager);
+		processServer = new ZoneProcessServer(zoneServer);
+		zone = new Zone(processServer, "test_zone");
+		zone->createContainerComponent();
+		zone->_setObjectID(1);
+
+		CreaturePosture::instance()->loadMovementData();
+
+		// the ham and wound lists are sized from the template
+		Vector<int> baseHAM;
+
+		for (int i = 0; i < 9; ++i)
+			baseHAM.add(5000);
+
+		creatureTemplate = new SharedCreatureObjectTemplate();
+		creatureTemplate->setBaseHAM(baseHAM);
+	}
+
+	~DeltaFlushTest() {
+		if (database != nullptr) {
+			delete database;
+			database = nullptr;
+		}
+
+		zone = nullptr;
+		processServer = nullptr;
+		zoneServer = nullptr;
+	}
+
+	void SetUp() {
+		DeltaFlushQueue::setEnabled(true);
+	}
+
+	void TearDown() {
+		DeltaFlushQueue::setEnabled(true);
+	}
+
+	Reference<CreatureObject*> createCreatureObject() {
+		Reference<CreatureObject*> creature = new CreatureObject();
+
+		creature->setContainerComponent("ContainerComponent");
+		creature->setZoneComponent("ZoneComponent");
+		creature->_setObjectID(nextObjectId.increment());
+		creature->initializeContainerObjectsMap();
+		creature->loadTemplateData(creatureTemplate);
+
+		// only objects in a zone defer their deltas
+		creature->setZone(zone);
+
+		return creature;
+	}
+
+	/**
+	 * One defender round: three pools hit, a dot on health, a wound and a
+	 * state that comes and goes
+	 */
+	static void playRound(CreatureObject* creature, int round) {
+		for (int pool = 0; pool < 9; pool += 3)
+			creature->setHAM(pool, 5000 - round % 40 - pool, true);
+
+		creature->setHAM(0, 4900 - round % 40, true);
+		creature->setWounds(0, round % 50, true);
+		creature->setState(CreatureState::STUNNED, true);
+		creature->clearState(CreatureState::STUNNED, true);
+	}
+};
+
+TEST_F(DeltaFlushTest, QueueHoldsEachObjectOnce) {
+	DeltaFlushQueue queue;
+
+	Reference<CreatureObject*> first = createCreatureObject();
+	Reference<CreatureObject*> second = createCreatureObject();
+
+	EXPECT_TRUE(queue.queue(first));
+	EXPECT_FALSE(queue.queue(second));
+	EXPECT_FALSE(queue.queue(first));
+
+	Vector<Reference<TangibleObject*> > objects;
+	queue.take(objects);
+
+	EXPECT_EQ(objects.size(), 2);
+
+	// empty again, the next queue call schedules a new flush
+	EXPECT_TRUE(queue.queue(first));
+}
+
+TEST_F(DeltaFlushTest, FlushMergesListElements) {
+	Reference<CreatureObject*> creature = createCreatureObject();
+
+	Locker locker(creature);
+
+	uint32 counter = creature->getHAM()->getUpdateCounter();
+	uint64 deferred = DeltaFlushQueue::deferredFields.get();
+	uint64 flushed = DeltaFlushQueue::flushedMessages.get();
+
+	creature->setHAM(0, 10, true);
+	creature->setHAM(3, 20, true);
+	creature->setHAM(0, 30, true);
+	creature->setHAM(8, 40, true);
+
+	EXPECT_EQ(DeltaFlushQueue::deferredFields.get(), deferred + 4);
+	EXPECT_EQ(creature->getHAM()->getUpdateCounter(), counter);
+	EXPECT_EQ(creature->getHAM(0), 30);
+
+	creature->flushDirtyDeltas();
+
+	// one baseline 6 delta, the counter moves once per changed element
+	EXPECT_EQ(DeltaFlushQueue::flushedMessages.get(), flushed + 1);
+	EXPECT_EQ(creature->getHAM()->getUpdateCounter(), counter + 3);
+
+	creature->flushDirtyDeltas();
+
+	EXPECT_EQ(DeltaFlushQueue::flushedMessages.get(), flushed + 1);
+}
+
+TEST_F(DeltaFlushTest, PostureIsNeverDeferred) {
+	Reference<CreatureObject*> creature = createCreatureObject();
+
+	Locker locker(creature);
+
+	uint64 deferred = DeltaFlushQueue::deferredFields.get();
+
+	creature->setPosture(CreaturePosture::KNOCKEDDOWN, false);
+	creature->setPosture(CreaturePosture::UPRIGHT, true);
+
+	EXPECT_EQ(DeltaFlushQueue::deferredFields.get(), deferred);
+}
+
+TEST_F(DeltaFlushTest, DisabledQueueSendsRightAway) {
+	DeltaFlushQueue::setEnabled(false);
+
+	Reference<CreatureObject*> creature = createCreatureObject();
+
+	Locker locker(creature);
+
+	uint32 counter = creature->getHAM()->getUpdateCounter();
+	uint64 deferred = DeltaFlushQueue::deferredFields.get();
+
+	creature->setHAM(0, 10, true);
+	creature->setHAM(0, 20, true);
+
+	EXPECT_EQ(DeltaFlushQueue::deferredFields.get(), deferred);
+	EXPECT_EQ(creature->getHAM()->getUpdateCounter(), counter + 2);
+}
+
+TEST_F(DeltaFlushTest, CombatRoundBenchmark) {
+	const int rounds = 2000;
+
+	DeltaFlushQueue::setEnabled(false);
+
+	Reference<CreatureObject*> immediate = createCreatureObject();
+
+	Time start;
+
+	{
+		Locker locker(immediate);
+
+		for (int i = 0; i < rounds; ++i)
+			playRound(immediate, i);
+	}
+
+	uint64 immediateTime = start.miliDifference();
+
+	DeltaFlushQueue::setEnabled(true);
+
+	Reference<CreatureObject*> deferred = createCreatureObject();
+
+	uint64 deferredFields = DeltaFlushQueue::deferredFields.get();
+	uint64 flushed = DeltaFlushQueue::flushedMessages.get();
+
+	start.updateToCurrentTime();
+
+	{
+		Locker locker(deferred);
+
+		for (int i = 0; i < rounds; ++i) {
+			playRound(deferred, i);
+			deferred->flushDirtyDeltas();
+		}
+	}
+
+	uint64 deferredTime = start.miliDifference();
+
+	deferredFields = DeltaFlushQueue::deferredFields.get() - deferredFields;
+	flushed = DeltaFlushQueue::flushedMessages.get() - flushed;
+
+	System::out << rounds << " combat rounds: per setter " << immediateTime << "ms, "
+		<< deferredFields << " deferred fields flushed as " << flushed << " deltas " << deferredTime << "ms" << endl;
+
+	EXPECT_EQ(deferred->getHAM(0), immediate->getHAM(0));
+	EXPECT_EQ(deferred->getWounds(0), immediate->getWounds(0));
+	EXPECT_LE(flushed, (uint64) rounds * 2);
+	EXPECT_LT(flushed, deferredFields);
+}
@@ -0,0 +1,187 @@
+/*
+ * FactoryProductionTest.cpp
+ *
+ * The closed form factory output has to match running the old per cycle
+ * manufacturing loop tick by tick.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/zone/objects/installation/factory/FactoryProductionModel.h"
+
+/**
+ * The per cycle model: every timer seconds upkeep is charged, then ingredients
+ * and output space are checked, then an item is made and the limit counted
+ * down, the order FactoryObject::createNewObject used before production was
+ * settled lazily.
+ */
+class TickFactory {
+public:
+	int timer;
+	int offset;
+	int chargeStart;
+
+	float surplusPower;
+	float powerRate;
+	float surplusMaintenance;
+	float maintenanceRate;
+
+	int runs;
+	int limit;
+	int capacity;
+
+	int produced;
+	int stopReason;
+	int stopTime;
+
+	static bool paid(int seconds, float rate, float surplus) {
+		return !((seconds / 3600.0) * rate > surplus);
+	}
+
+	void stop(int reason, int time) {
+		stopReason = reason;
+		stopTime = time;
+	}
+
+	void run(int until) {
+		produced = 0;
+		stopReason = FactoryProductionModel::RUNNING;
+		stopTime = 0;
+
+		int remainingLimit = limit;
+
+		for (int t = timer - offset; t <= until; t += timer) {
+			int charged = Math::max(0, t - chargeStart);
+
+			bool power = powerRate == 0 || paid(charged, powerRate, surplusPower);
+			bool maintenance = paid(charged, maintenanceRate, surplusMaintenance);
+
+			if (!power || !maintenance)
+				return stop(power ? FactoryProductionModel::OUT_OF_MAINTENANCE : FactoryProductionModel::OUT_OF_POWER, t);
+
+			if (produced >= runs)
+				return stop(FactoryProductionModel::OUT_OF_INGREDIENTS, t);
+
+			if (produced >= capacity)
+				return stop(FactoryProductionModel::OUTPUT_FULL, t);
+
+			++produced;
+
+			if (--remainingLimit < 1)
+				return stop(FactoryProductionModel::LIMIT_REACHED, t);
+		}
+	}
+};
+
+class FactoryProductionTest : public ::testing::Test {
+public:
+	static float randomSurplus() {
+		return System::random(200000) / 7.3f;
+	}
+
+	static TickFactory randomFactory() {
+		TickFactory factory;
+
+		factory.timer = 1 + System::random(59);
+		factory.offset = System::random(factory.timer - 1);
+		factory.chargeStart = -(int) System::random(3600);
+		factory.surplusPower = randomSurplus();
+		factory.powerRate = System::random(3) == 0 ? 0 : System::random(500) + 0.25f;
+		factory.surplusMaintenance = randomSurplus();
+		factory.maintenanceRate = System::random(60) + 0.5f;
+		factory.runs = System::random(4000);
+		factory.limit = System::random(4000);
+		factory.capacity = System::random(4000);
+
+		return factory;
+	}
+
+	static FactoryProductionModel modelFor(const TickFactory& factory, int elapsed) {
+		FactoryProductionModel model;
+		model.cycleTime = factory.timer;
+		model.cycleOffset = factory.offset;
+		model.elapsed = elapsed;
+		model.chargeStart = factory.chargeStart;
+		model.surplusPower = factory.surplusPower;
+		model.powerRate = factory.powerRate;
+		model.surplusMaintenance = factory.surplusMaintenance;
+		model.maintenanceRate = factory.maintenanceRate;
+		model.ingredientRuns = factory.runs;
+		model.manufactureLimit = factory.limit;
+		model.outputCapacity = factory.capacity;
+		model.crateSize = 1000;
+
+		model.run();
+
+		return model;
+	}
+};
+
+TEST_F(FactoryProductionTest, ClosedFormMatchesPerTickModel) {
+	for (int i = 0; i < 500; ++i) {
+		TickFactory factory = randomFactory();
+		int elapsed = System::random(150000);
+
+		factory.run(elapsed);
+
+		FactoryProductionModel model = modelFor(factory, elapsed);
+
+		ASSERT_EQ(factory.produced, model.getProduced()) << "scenario " << i;
+		ASSERT_EQ(factory.stopReason, model.getStopReason()) << "scenario " << i;
+
+		if (model.isStopped()) {
+			ASSERT_EQ(factory.stopTime, model.getStopTime()) << "scenario " << i;
+		} else {
+			// the next wake up must not skip past a stop
+			TickFactory ahead = factory;
+			ahead.run(elapsed + model.getNextEvent() - 1);
+
+			ASSERT_FALSE(ahead.stopReason != FactoryProductionModel::RUNNING) << "scenario " << i;
+			ASSERT_GT(model.getNextEvent(), 0) << "scenario " << i;
+		}
+	}
+}
+
+TEST_F(FactoryProductionTest, SplitSettlementsMatchOneSettlement) {
+	// settling whenever a hopper is opened must not change the total output
+	for (int i = 0; i < 200; ++i) {
+		TickFactory factory = randomFactory();
+		int elapsed = System::random(150000);
+
+		factory.run(elapsed);
+
+		TickFactory state = factory;
+		int now = 0;
+		int total = 0;
+		int reason = FactoryProductionModel::RUNNING;
+
+		while (now < elapsed) {
+			int step = Math::min(elapsed - now, 1 + (int) System::random(20000));
+
+			FactoryProductionModel model = modelFor(state, step);
+
+			total += model.getProduced();
+
+			if (model.isStopped()) {
+				reason = model.getStopReason();
+				break;
+			}
+
+			// what updateMaintenance and the crate bookkeeping leave behind
+			float hours = Math::max(0, step - state.chargeStart) / 3600.0;
+
+			state.surplusMaintenance -= hours * state.maintenanceRate;
+			state.surplusPower -= hours * state.powerRate;
+			state.chargeStart = 0;
+			state.offset = model.getNextOffset();
+			state.runs -= model.getProduced();
+			state.limit -= model.getProduced();
+			state.capacity -= model.getProduced();
+
+			now += step;
+		}
+
+		EXPECT_EQ(factory.produced, total) << "scenario " << i;
+		EXPECT_EQ(factory.stopReason, reason) << "scenario " << i;
+	}
+}
@@ -0,0 +1,191 @@
+/*
+ * LuaBindingTest.cpp
+ *
+ * Runs a typical screenplay event, an npc spawn, a conversation and a reward
+ * check, through the old shared flyweight wrappers and through the per object
+ * wrappers object_manager.lua defines, and checks the per binding counters.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/zone/managers/director/LuaBindingProfiler.h"
+#include "server/zone/objects/creature/LuaCreatureObject.h"
+#include "server/zone/objects/creature/CreatureObject.h"
+#include "conf/ConfigManager.h"
+
+// The shared flyweight helper object_manager.lua had before wrappers were cached
+static const char* const FLYWEIGHT =
+	"local flyweight = LuaCreatureObject(nil)\n"
+	"FlyweightCreatureObject = function(pObject)\n"
+	"  if (pObject == nil) then return nil end\n"
+	"  flyweight:_setObject(pObject)\n"
+	"  return flyweight\n"
+	"end\n";
+
+static const char* const EVENTS =
+	"function playEvents(CreatureObject, events)\n"
+	"  local sum = 0\n"
+	"  for i = 1, events do\n"
+	"    local npc = CreatureObject(pNpc)\n"
+	"    sum = sum + npc:getObjectID() + npc:getPositionX() + npc:getPositionY() + npc:getPosture()\n"
+	"    local player = CreatureObject(pPlayer)\n"
+	"    if (player:getFirstName() ~= nil and not player:hasScreenPlayState(1, \"bench\")) then\n"
+	"      sum = sum + CreatureObject(pNpc):getObjectID() + player:getScreenPlayState(\"bench\")\n"
+	"    end\n"
+	"    sum = sum + CreatureObject(pPlayer):getCashCredits() + CreatureObject(pPlayer):getHAM(0)\n"
+	"  end\n"
+	"  return sum\n"
+	"end\n";
+
+class LuaBindingTest : public ::testing::Test {
+protected:
+	AtomicLong nextObjectId;
+	Reference<CreatureObject*> player;
+	Reference<CreatureObject*> npc;
+
+public:
+	LuaBindingTest() {
+		nextObjectId = 1;
+	}
+
+	void SetUp() {
+		ConfigManager::instance()->loadConfigData();
+		ConfigManager::instance()->setProgressMonitors(false);
+
+		player = createCreatureObject();
+		npc = createCreatureObject();
+	}
+
+	void TearDown() {
+		LuaBindingProfiler::instance()->setEnabled(false);
+
+		player = nullptr;
+		npc = nullptr;
+	}
+
+	Reference<CreatureObject*> createCreatureObject() {
+		Reference<CreatureObject*> creature = new CreatureObject();
+
+		creature->setContainerComponent("ContainerComponent");
+		creature->setZoneComponent("ZoneComponent");
+		creature->_setObjectID(nextObjectId.increment());
+		creature->initializeContainerObjectsMap();
+
+		return creature;
+	}
+
+	Lua* createLua() {
+		Lua* lua = new Lua();
+		lua->init();
+
+		lua_State* L = lua->getLuaState();
+
+		LuaBindingProfiler::registerClass<LuaCreatureObject>(L);
+
+		lua_pushlightuserdata(L, player.get());
+		lua_setglobal(L, "pPlayer");
+		lua_pushlightuserdata(L, npc.get());
+		lua_setglobal(L, "pNpc");
+
+		// the wrappers screenplays get, tests run from bin/
+		EXPECT_EQ(luaL_dofile(L, "scripts/managers/object/object_manager.lua"), 0) << lua_tostring(L, -1);
+		EXPECT_EQ(luaL_dostring(L, FLYWEIGHT), 0) << lua_tostring(L, -1);
+		EXPECT_EQ(luaL_dostring(L, EVENTS), 0) << lua_tostring(L, -1);
+
+		return lua;
+	}
+
+	uint64 playEvents(Lua* lua, const char* wrapper, int events) {
+		lua_State* L = lua->getLuaState();
+
+		Time start;
+
+		lua_getglobal(L, "playEvents");
+		lua_getglobal(L, wrapper);
+		lua_pushinteger(L, events);
+
+		EXPECT_EQ(lua_pcall(L, 2, 1, 0), 0) << lua_tostring(L, -1);
+
+		lua_pop(L, 1);
+
+		return start.miliDifference();
+	}
+};
+
+TEST_F(LuaBindingTest, CachedWrapperIsPerObject) {
+	Lua* lua = createLua();
+	lua_State* L = lua->getLuaState();
+
+	ASSERT_EQ(luaL_dostring(L, "return CreatureObject(pPlayer) == CreatureObject(pPlayer), "
+			"CreatureObject(pPlayer) ~= CreatureObject(pNpc), "
+			"CreatureObject(pPlayer):getObjectID()"), 0);
+
+	EXPECT_TRUE(lua_toboolean(L, -3));
+	EXPECT_TRUE(lua_toboolean(L, -2));
+	EXPECT_EQ((uint64) lua_tointeger(L, -1), player->getObjectID());
+
+	// a flyweight handed out earlier follows whatever object was set last
+	ASSERT_EQ(luaL_dostring(L, "local first = FlyweightCreatureObject(pPlayer) FlyweightCreatureObject(pNpc) return first:getObjectID()"), 0);
+
+	EXPECT_EQ((uint64) lua_tointeger(L, -1), npc->getObjectID());
+
+	delete lua;
+}
+
+TEST_F(LuaBindingTest, ReleaseClearsCachedWrappers) {
+	Lua* lua = createLua();
+	lua_State* L = lua->getLuaState();
+
+	ASSERT_EQ(luaL_dostring(L, "kept = CreatureObject(pPlayer)"), 0);
+	ASSERT_EQ(luaL_dostring(L, "releaseObjectWrappers() "
+			"return kept:_getObject() == nil, CreatureObject(pPlayer) ~= kept, CreatureObject(pPlayer):getObjectID()"), 0) << lua_tostring(L, -1);
+
+	// the released wrapper no longer pins the player, the next call gets a new one
+	EXPECT_TRUE(lua_toboolean(L, -3));
+	EXPECT_TRUE(lua_toboolean(L, -2));
+	EXPECT_EQ((uint64) lua_tointeger(L, -1), player->getObjectID());
+
+	delete lua;
+}
+
+TEST_F(LuaBindingTest, ProfilerCountsEveryCall) {
+	const int events = 100;
+
+	LuaBindingProfiler* profiler = LuaBindingProfiler::instance();
+	profiler->setEnabled(true);
+	profiler->reset();
+
+	Lua* lua = createLua();
+
+	playEvents(lua, "CreatureObject", events);
+
+	EXPECT_EQ(profiler->getCalls("LuaCreatureObject", "getFirstName"), (uint64) events);
+	EXPECT_EQ(profiler->getCalls("LuaCreatureObject", "getObjectID"), (uint64) events * 2);
+	EXPECT_EQ(profiler->getCalls("LuaCreatureObject", "_setObject"), (uint64) 2);
+
+	delete lua;
+}
+
+TEST_F(LuaBindingTest, ScreenPlayEventBenchmark) {
+	const int events = 200000;
+
+	Lua* lua = createLua();
+
+	uint64 flyweightTime = playEvents(lua, "FlyweightCreatureObject", events);
+	uint64 cachedTime = playEvents(lua, "CreatureObject", events);
+
+	delete lua;
+
+	LuaBindingProfiler::instance()->setEnabled(true);
+
+	lua = createLua();
+
+	uint64 profiledTime = playEvents(lua, "CreatureObject", events);
+
+	delete lua;
+
+	System::out << events << " screenplay events: flyweight wrappers " << flyweightTime << "ms, cached wrappers "
+		<< cachedTime << "ms, cached with binding counters " << profiledTime << "ms" << endl;
+
+	System::out << LuaBindingProfiler::instance()->getSummary(10);
+}
@@ -0,0 +1,175 @@
+/*
+ * MailHeaderTest.cpp
+ *
+ * The mail list sent from the recipient's headers has to be what the mails
+ * themselves send, and a login with 5k mails is timed both ways.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/chat/PersistentMessage.h"
+#include "server/chat/MailHeader.h"
+#include "server/zone/packets/chat/ChatPersistentMessageToClient.h"
+
+class MailHeaderTest : public ::testing::Test {
+protected:
+	AtomicLong nextObjectId;
+
+public:
+	static const int MAILS = 5000;
+
+	MailHeaderTest() {
+		nextObjectId = 0x40000000;
+	}
+
+	Reference<PersistentMessage*> createMail(int index) {
+		Reference<PersistentMessage*> mail = new PersistentMessage();
+		mail->_setObjectID(nextObjectId.increment());
+
+		mail->setSenderName("auctioner");
+		mail->setSubject(UnicodeString("Auction Complete " + String::valueOf(index)));
+		mail->setTimeStamp(1600000000 + index * 60);
+
+		StringBuffer body;
+
+		for (int i = 0; i < 20; ++i)
+			body << "The auction of item " << index << " has completed and the credits were deposited. ";
+
+		mail->setBody(UnicodeString(body.toString()));
+
+		StringIdChatParameter param("auction", "seller_success");
+		param.setTO("A Rather Long Item Name " + String::valueOf(index));
+		param.setDI(index * 100);
+		mail->addStringIdParameter(param);
+
+		if (index % 3 == 0)
+			mail->setStatus(PersistentMessage::READ);
+
+		return mail;
+	}
+
+	static void store(PersistentMessage* mail, ObjectInputStream* record) {
+		ObjectOutputStream data(2000);
+
+		mail->writeObject(&data);
+		data.reset();
+
+		data.copy(record, 0);
+		record->reset();
+	}
+
+	static bool samePayload(BasePacket* a, BasePacket* b) {
+		return a->size() == b->size() && memcmp(a->getBuffer(), b->getBuffer(), a->size()) == 0;
+	}
+};
+
+TEST_F(MailHeaderTest, HeaderPacketMatchesMail) {
+	for (int i = 0; i < 10; ++i) {
+		Reference<PersistentMessage*> mail = createMail(i);
+		MailHeader header(mail);
+
+		ChatPersistentMessageToClient fromMail(mail, "Aftermath", false);
+		ChatPersistentMessageToClient fromHeader(mail->getMailID(), header, "Aftermath");
+
+		EXPECT_TRUE(samePayload(&fromMail, &fromHeader)) << i;
+	}
+}
+
+TEST_F(MailHeaderTest, HeadersSerialize) {
+	VectorMap<uint64, MailHeader> headers;
+	headers.setNoDuplicateInsertPlan();
+
+	for (int i = 0; i < 10; ++i) {
+		Reference<PersistentMessage*> mail = createMail(i);
+		MailHeader header(mail);
+
+		headers.put(mail->getObjectID(), header);
+	}
+
+	ObjectOutputStream data;
+	headers.toBinaryStream(&data);
+
+	ObjectInputStream input;
+	data.reset();
+	data.copy(&input, 0);
+	input.reset();
+
+	VectorMap<uint64, MailHeader> loaded;
+	loaded.parseFromBinaryStream(&input);
+
+	ASSERT_EQ(loaded.size(), headers.size());
+
+	for (int i = 0; i < headers.size(); ++i) {
+		const MailHeader& header = headers.elementAt(i).getValue();
+		const MailHeader& loadedHeader = loaded.elementAt(i).getValue();
+
+		EXPECT_EQ(loaded.elementAt(i).getKey(), headers.elementAt(i).getKey());
+		EXPECT_EQ(loadedHeader.getSenderName(), header.getSenderName());
+		EXPECT_EQ(loadedHeader.getSubject().toString(), header.getSubject().toString());
+		EXPECT_EQ(loadedHeader.getTimeStamp(), header.getTimeStamp());
+		EXPECT_EQ(loadedHeader.getStatus(), header.getStatus());
+	}
+}
+
+TEST_F(MailHeaderTest, LoginBenchmark) {
+	// the mail database records loadMail used to read, and the headers the player object carries
+	Vector<ObjectInputStream*> records(MAILS, 1024);
+	VectorMap<uint64, MailHeader> headers(MAILS, 1024);
+	headers.setNoDuplicateInsertPlan();
+
+	uint64 recordBytes = 0;
+
+	for (int i = 0; i < MAILS; ++i) {
+		Reference<PersistentMessage*> mail = createMail(i);
+
+		ObjectInputStream* record = new ObjectInputStream();
+		store(mail, record);
+
+		recordBytes += record->size();
+		records.add(record);
+
+		MailHeader header(mail);
+		headers.put(mail->getObjectID(), header);
+	}
+
+	ObjectOutputStream headerData;
+	headers.toBinaryStream(&headerData);
+
+	uint64 sentBytes = 0;
+
+	Time start;
+
+	for (int i = 0; i < records.size(); ++i) {
+		ObjectInputStream* record = records.getUnsafe(i);
+		record->reset();
+
+		Reference<PersistentMessage*> mail = new PersistentMessage();
+		mail->readObject(record);
+
+		ChatPersistentMessageToClient packet(mail, "Aftermath", false);
+		sentBytes += packet.size();
+	}
+
+	uint64 mailTime = start.miliDifference();
+
+	uint64 headerBytes = 0;
+
+	start.updateToCurrentTime();
+
+	for (int i = 0; i < headers.size(); ++i) {
+		const auto& entry = headers.elementAt(i);
+
+		ChatPersistentMessageToClient packet(Long::hashCode(entry.getKey()), entry.getValue(), "Aftermath");
+		headerBytes += packet.size();
+	}
+
+	uint64 headerTime = start.miliDifference();
+
+	EXPECT_EQ(sentBytes, headerBytes);
+
+	System::out << MAILS << " mails at login: loading the mails " << mailTime << "ms (" << recordBytes / 1024
+		<< "KB read), from the headers " << headerTime << "ms (" << headerData.size() / 1024 << "KB in the player object)" << endl;
+
+	for (int i = 0; i < records.size(); ++i)
+		delete records.getUnsafe(i);
+}
@@ -0,0 +1,185 @@
+/*
+ * PortalRouteTest.cpp
+ *
+ * Compares the routes of the portal layout route tables with the A* search
+ * they replace on cantinas, theaters and bunkers, and how many routes per
+ * second each gives.
+ */
+
+#include "gtest/gtest.h"
+
+#include "conf/ConfigManager.h"
+#include "templates/manager/DataArchiveStore.h"
+#include "templates/manager/TemplateManager.h"
+#include "templates/appearance/PortalLayout.h"
+
+static const char* const LAYOUTS[] = {
+	"appearance/ply_tato_cantina_s01.pob",
+	"appearance/ply_corl_cantina_s01.pob",
+	"appearance/ply_nboo_theater_s01.pob",
+	"appearance/mun_tato_guild_theater_s01.pob",
+	"appearance/poi_all_impl_bunker_s01.pob",
+};
+
+class PortalRouteTest : public ::testing::Test {
+public:
+	PortalRouteTest() {
+		ConfigManager::instance()->loadConfigData();
+		DataArchiveStore::instance()->loadTres(ConfigManager::instance()->getTrePath(), ConfigManager::instance()->getTreFiles());
+	}
+
+	static Vector<const PathNode*> getNodes(const PortalLayout* layout) {
+		Vector<const PathNode*> nodes;
+
+		for (int i = 0; i < layout->getFloorMeshNumber(); ++i) {
+			const FloorMesh* floorMesh = layout->getFloorMesh(i);
+
+			if (floorMesh == nullptr || floorMesh->getPathGraph() == nullptr)
+				continue;
+
+			const Vector<PathNode*>* pathNodes = floorMesh->getPathGraph()->getPathNodes();
+
+			for (int j = 0; j < pathNodes->size(); ++j)
+				nodes.add(pathNodes->get(j));
+		}
+
+		return nodes;
+	}
+
+	static float getCost(const Vector<const PathNode*>* path) {
+		float cost = 0;
+
+		for (int i = 1; i < path->size(); ++i)
+			cost += PathGraph::calculateManhattanDistance(path->get(i - 1), path->get(i));
+
+		return cost;
+	}
+
+	static bool isSameRoute(const Vector<const PathNode*>* path1, const Vector<const PathNode*>* path2) {
+		if (path1->size() != path2->size())
+			return false;
+
+		for (int i = 0; i < path1->size(); ++i) {
+			if (path1->get(i) != path2->get(i))
+				return false;
+		}
+
+		return true;
+	}
+};
+
+TEST_F(PortalRouteTest, RoutesMatchSearch) {
+	for (const char* fileName : LAYOUTS) {
+		PortalLayout* layout = TemplateManager::instance()->getPortalLayout(fileName);
+
+		ASSERT_TRUE(layout != nullptr) << fileName;
+		ASSERT_TRUE(layout->getRouteTable()->isBuilt()) << fileName;
+
+		Vector<const PathNode*> nodes = getNodes(layout);
+
+		int routes = 0;
+		int identical = 0;
+
+		for (int i = 0; i < nodes.size(); ++i) {
+			for (int j = 0; j < nodes.size(); ++j) {
+				const PathNode* source = nodes.get(i);
+				const PathNode* target = nodes.get(j);
+
+				Vector<const PathNode*>* searched = layout->searchPath(source, target);
+				Vector<const PathNode*>* looked = layout->getPath(source, target);
+
+				ASSERT_EQ(searched == nullptr, looked == nullptr) << fileName << " " << i << " to " << j;
+
+				if (searched != nullptr) {
+					++routes;
+
+					EXPECT_EQ(looked->get(0), source);
+					EXPECT_EQ(looked->get(looked->size() - 1), target);
+
+					if (isSameRoute(searched, looked)) {
+						++identical;
+					} else {
+						// the search heuristic is not admissible, where it differs the table route is never longer
+						float searchedCost = getCost(searched);
+
+						EXPECT_LE(getCost(looked), searchedCost + searchedCost * 0.0001f) << fileName << " " << i << " to " << j;
+					}
+				}
+
+				delete searched;
+				delete looked;
+			}
+		}
+
+		System::out << fileName << ": " << nodes.size() << " nodes, " << routes << " routes, " << identical << " identical to the search" << endl;
+	}
+}
+
+TEST_F(PortalRouteTest, CellGraphRoutes) {
+	PortalLayout* layout = TemplateManager::instance()->getPortalLayout(LAYOUTS[0]);
+
+	ASSERT_TRUE(layout != nullptr);
+
+	for (int i = 0; i < layout->getFloorMeshNumber(); ++i) {
+		const FloorMesh* floorMesh = layout->getFloorMesh(i);
+
+		if (floorMesh == nullptr || floorMesh->getPathGraph() == nullptr)
+			continue;
+
+		const PathGraph* pathGraph = floorMesh->getPathGraph();
+		const Vector<PathNode*>* pathNodes = pathGraph->getPathNodes();
+
+		EXPECT_EQ(pathGraph->getRouteTable()->getNodeCount(), pathNodes->size());
+
+		for (int j = 0; j < pathNodes->size(); ++j) {
+			Vector<const PathNode*>* path = pathGraph->getPath(pathNodes->get(j), pathNodes->get(0));
+
+			if (path == nullptr)
+				continue;
+
+			// routes stay inside the cell
+			for (int k = 0; k < path->size(); ++k)
+				EXPECT_EQ(path->get(k)->getPathGraph(), pathGraph);
+
+			delete path;
+		}
+	}
+}
+
+TEST_F(PortalRouteTest, RouteBenchmark) {
+	const int calls = 200000;
+
+	for (const char* fileName : LAYOUTS) {
+		PortalLayout* layout = TemplateManager::instance()->getPortalLayout(fileName);
+
+		ASSERT_TRUE(layout != nullptr) << fileName;
+
+		Vector<const PathNode*> nodes = getNodes(layout);
+
+		ASSERT_TRUE(nodes.size() > 1) << fileName;
+
+		Vector<int> pairs;
+
+		for (int i = 0; i < calls; ++i) {
+			pairs.add(System::random(nodes.size() - 1));
+			pairs.add(System::random(nodes.size() - 1));
+		}
+
+		Time start;
+
+		for (int i = 0; i < calls; ++i)
+			delete layout->searchPath(nodes.get(pairs.get(i * 2)), nodes.get(pairs.get(i * 2 + 1)));
+
+		uint64 searchTime = Math::max((uint64) 1, start.miliDifference());
+
+		start.updateToCurrentTime();
+
+		for (int i = 0; i < calls; ++i)
+			delete layout->getPath(nodes.get(pairs.get(i * 2)), nodes.get(pairs.get(i * 2 + 1)));
+
+		uint64 tableTime = Math::max((uint64) 1, start.miliDifference());
+
+		System::out << fileName << ": A* " << calls * 1000 / searchTime << " routes/s, route table "
+			<< calls * 1000 / tableTime << " routes/s" << endl;
+	}
+}
@@ -0,0 +1,295 @@
+/*
+ * RESTRouterTest.cpp
+ *
+ * The route trie has to pick the endpoint the linear regex scan picked, and
+ * pulling objects one request at a time is timed against streamed pages of
+ * the bulk endpoint on a local listener.
+ */
+
+#ifdef WITH_REST_API
+
+#include "gtest/gtest.h"
+
+#include "server/web/RESTRouteTrie.h"
+#include "server/web/APIRequest.h"
+
+#include <cpprest/http_client.h>
+
+using namespace server::web3;
+using namespace web::http::client;
+using namespace web::http::experimental::listener;
+
+class RESTRouterTest : public ::testing::Test {
+protected:
+	Logger logger;
+	ArrayList<RESTEndpoint, ArrayListNoReallocTrait::value> endpoints;
+
+public:
+	static const int OBJECTS = 2000;
+
+	RESTRouterTest() : logger("RESTRouterTest") {
+		logger.setLogLevel(Logger::ERROR);
+	}
+
+	void addEndpoints(RESTRouteTrie& trie, Function<void(APIRequest& apiRequest)> handler) {
+		// As registered by RESTServer::registerEndpoints()
+		const char* patterns[] = {
+			"GET:/v1/version/",
+			"(?:GET|DELETE):/v1/object/(?:(\\d*)/|)",
+			"(?:GET|POST):/v1/bulk/object/",
+			"(?:PUT):/v1/object/(\\d+)/(\\w+)/(\\w+)/",
+			"(?:GET|POST|PUT):/v1/admin/config/(?:(.*)/|)",
+			"GET:/v1/admin/taskprofiler/(?:(top)/|)",
+			"POST:/v1/admin/console/(\\w+)/",
+			"POST:/v1/admin/account/(\\d+)/galaxy/(\\d+)/character/(\\d+)/",
+			"POST:/v1/admin/account/(\\d+)/",
+			"GET:/v1/(find|lookup)/character/",
+			"GET:/v1/(find|lookup)/guild/",
+			"POST:/v1/chat/(mail|message|galaxy)/",
+		};
+
+		const ArrayList<String> fieldNames[] = {
+			{}, {"oid"}, {}, {"oid", "class", "property"}, {"key"}, {"view"}, {"command"},
+			{"accountID", "galaxyID", "characterID"}, {"accountID"}, {"mode"}, {"mode"}, {"msgType"},
+		};
+
+		for (int i = 0; i < 12; ++i) {
+			RESTEndpoint endpoint(patterns[i], fieldNames[i], handler);
+
+			trie.add(endpoint);
+			endpoints.add(endpoint);
+		}
+	}
+
+	// The lookup RESTServer::routeRequest did before the trie
+	const RESTEndpoint* scan(const String& endpointKey) {
+		const RESTEndpoint* hit = nullptr;
+
+		for (int i = 0; i < endpoints.size(); ++i) {
+			const RESTEndpoint& endpoint = endpoints.get(i);
+
+			if (endpoint.isMatch(endpointKey) && (hit == nullptr || endpoint.getWeight() > hit->getWeight()))
+				hit = &endpoint;
+		}
+
+		return hit;
+	}
+
+	static Vector<String> getKeys() {
+		Vector<String> keys;
+
+		keys.add("GET:/v1/version/");
+		keys.add("GET:/v1/object/281474993487877/");
+		keys.add("DELETE:/v1/object/");
+		keys.add("GET:/v1/bulk/object/");
+		keys.add("POST:/v1/bulk/object/");
+		keys.add("PUT:/v1/object/281474993487877/SceneObject/forceNoTrade/");
+		keys.add("GET:/v1/admin/config/Core3/MOTD/");
+		keys.add("PUT:/v1/admin/config/");
+		keys.add("GET:/v1/admin/taskprofiler/top/");
+		keys.add("GET:/v1/admin/taskprofiler/");
+		keys.add("POST:/v1/admin/console/shutdown/");
+		keys.add("POST:/v1/admin/account/12/galaxy/2/character/281474993487877/");
+		keys.add("POST:/v1/admin/account/12/");
+		keys.add("GET:/v1/lookup/character/");
+		keys.add("GET:/v1/find/guild/");
+		keys.add("POST:/v1/chat/mail/");
+		keys.add("GET:/v1/chat/mail/");
+		keys.add("GET:/v2/version/");
+		keys.add("PATCH:/v1/object/1/");
+		keys.add("GET:/");
+
+		return keys;
+	}
+
+	static JSONSerializationType createObjectJSON(uint64 oid) {
+		JSONSerializationType object;
+
+		object["_oid"] = oid;
+		object["_className"] = "TangibleObject";
+		object["_depth"] = 0;
+		object["_oidPath"] = JSONSerializationType::array();
+		object["_oidPath"].push_back(oid);
+
+		for (int i = 0; i < 40; ++i)
+			object["field" + std::to_string(i)] = "value of field " + std::to_string(i) + " for " + std::to_string(oid);
+
+		return object;
+	}
+};
+
+TEST_F(RESTRouterTest, TrieMatchesLinearScan) {
+	RESTRouteTrie trie;
+	addEndpoints(trie, [] (APIRequest& apiRequest) -> void {});
+
+	auto keys = getKeys();
+
+	for (const auto& key : keys) {
+		const RESTEndpoint* expected = scan(key);
+		const RESTEndpoint* hit = trie.find(key);
+
+		ASSERT_EQ(expected == nullptr, hit == nullptr) << key.toCharArray();
+
+		if (expected != nullptr)
+			EXPECT_EQ(hit->toString(), expected->toString()) << key.toCharArray();
+	}
+}
+
+TEST_F(RESTRouterTest, RoutingBenchmark) {
+	RESTRouteTrie trie;
+	addEndpoints(trie, [] (APIRequest& apiRequest) -> void {});
+
+	auto keys = getKeys();
+	const int rounds = 2000;
+	int scanned = 0, found = 0;
+
+	Time start;
+
+	for (int i = 0; i < rounds; ++i) {
+		for (const auto& key : keys)
+			scanned += scan(key) != nullptr;
+	}
+
+	uint64 scanTime = Math::max((uint64) 1, start.miliDifference());
+
+	start.updateToCurrentTime();
+
+	for (int i = 0; i < rounds; ++i) {
+		for (const auto& key : keys)
+			found += trie.find(key) != nullptr;
+	}
+
+	uint64 trieTime = Math::max((uint64) 1, start.miliDifference());
+
+	EXPECT_EQ(scanned, found);
+
+	System::out << rounds * keys.size() << " routed over " << trie.size() << " endpoints (" << trie.getNodeCount()
+		<< " nodes): linear scan " << scanTime << "ms, trie " << trieTime << "ms" << endl;
+}
+
+TEST_F(RESTRouterTest, LocalListenerBenchmark) {
+	Vector<uint64> oids;
+
+	for (int i = 0; i < OBJECTS; ++i)
+		oids.add(0x50000000 + i * 3);
+
+	RESTRouteTrie trie;
+
+	trie.add(RESTEndpoint("GET:/v1/object/(\\d+)/", {"oid"}, [&] (APIRequest& apiRequest) -> void {
+		auto oid = apiRequest.getPathFieldUnsignedLong("oid");
+
+		JSONSerializationType objects;
+		objects[String::valueOf(oid)] = createObjectJSON(oid);
+
+		JSONSerializationType result;
+		result["objects"] = objects;
+
+		apiRequest.success(result);
+	}));
+
+	// The paging of APIProxyObjectManager::handleBulk over a fixed set of oids
+	trie.add(RESTEndpoint("GET:/v1/bulk/object/", {}, [&] (APIRequest& apiRequest) -> void {
+		auto cursor = apiRequest.getQueryFieldUnsignedLong("cursor", false, 0);
+		auto limit = apiRequest.getQueryFieldUnsignedLong("limit", false, 500);
+
+		int first = 0;
+
+		while (first < oids.size() && oids.get(first) <= cursor)
+			++first;
+
+		int stop = Math::min(oids.size(), (int)(first + limit));
+		uint64 lastOid = cursor;
+
+		apiRequest.streamBegin("objects");
+
+		for (int i = first; i < stop; ++i) {
+			lastOid = oids.get(i);
+			apiRequest.streamEntry(String::valueOf(lastOid), createObjectJSON(lastOid));
+		}
+
+		JSONSerializationType metadata;
+		metadata["total"] = oids.size();
+		metadata["next_cursor"] = stop < oids.size() ? lastOid : 0;
+
+		JSONSerializationType result;
+		result["metadata"] = metadata;
+
+		apiRequest.streamEnd(result);
+	}));
+
+	int port = 45000 + System::random(1000);
+	StringBuffer url;
+	url << "http://127.0.0.1:" << port;
+
+	http_listener listener(utility::conversions::to_string_t(url.toString().toCharArray()));
+
+	listener.support([&] (http_request request) {
+		String endpointKey = request.method() + ":" + uri::decode(request.relative_uri().path());
+
+		if (!endpointKey.endsWith("/"))
+			endpointKey += "/";
+
+		auto hit = trie.find(endpointKey);
+
+		if (hit == nullptr) {
+			request.reply(status_codes::NotFound);
+			return;
+		}
+
+		APIRequest apiRequest(request, endpointKey, logger);
+		hit->handle(apiRequest);
+	});
+
+	listener.open().wait();
+
+	http_client client(utility::conversions::to_string_t(url.toString().toCharArray()));
+
+	int single = 0;
+
+	Time start;
+
+	for (int i = 0; i < oids.size(); ++i) {
+		StringBuffer path;
+		path << "/v1/object/" << oids.get(i) << "/";
+
+		auto response = client.request(methods::GET, utility::conversions::to_string_t(path.toString().toCharArray())).get();
+		auto body = JSONSerializationType::parse(response.extract_utf8string(true).get());
+
+		single += body["objects"].size();
+	}
+
+	uint64 singleTime = Math::max((uint64) 1, start.miliDifference());
+
+	int streamed = 0, pages = 0;
+	uint64 cursor = 0;
+
+	start.updateToCurrentTime();
+
+	do {
+		StringBuffer path;
+		path << "/v1/bulk/object/?limit=500&cursor=" << cursor;
+
+		auto response = client.request(methods::GET, utility::conversions::to_string_t(path.toString().toCharArray())).get();
+		auto body = JSONSerializationType::parse(response.extract_utf8string(true).get());
+
+		ASSERT_EQ(body["status"], "OK");
+
+		streamed += body["objects"].size();
+		cursor = body["metadata"]["next_cursor"].get<uint64>();
+		pages++;
+	} while (cursor != 0);
+
+	uint64 streamTime = Math::max((uint64) 1, start.miliDifference());
+
+	listener.close().wait();
+
+	EXPECT_EQ(single, OBJECTS);
+	EXPECT_EQ(streamed, OBJECTS);
+	EXPECT_EQ(pages, OBJECTS / 500);
+
+	System::out << OBJECTS << " objects from a local listener: one request each " << singleTime << "ms ("
+		<< OBJECTS * 1000 / singleTime << " objects/s), " << pages << " streamed pages " << streamTime << "ms ("
+		<< OBJECTS * 1000 / streamTime << " objects/s)" << endl;
+}
+
+#endif // WITH_REST_API
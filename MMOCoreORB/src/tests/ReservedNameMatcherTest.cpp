@@ -0,0 +1,123 @@
+/*
+ * ReservedNameMatcherTest.cpp
+ *
+ * The compiled matcher has to give the reason the per pattern regex loop
+ * NameManager used to run gave, for literals, regex patterns and mixes of both.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/zone/managers/name/ReservedNameMatcher.h"
+#include "server/zone/managers/name/NameManager.h"
+
+class ReservedNameMatcherTest : public ::testing::Test {
+protected:
+	Reference<ReservedNameMatcher*> matcher;
+	Vector<String> patterns;
+	Vector<int> reasons;
+
+public:
+	void SetUp() {
+		matcher = new ReservedNameMatcher();
+
+		add("anal", NameManagerResult::DECLINED_PROFANE);
+		add("ass", NameManagerResult::DECLINED_PROFANE);
+		add("sha", NameManagerResult::DECLINED_FICT_RESERVED);
+		add("^lord", NameManagerResult::DECLINED_RESERVED);
+		add("d[a4]rth", NameManagerResult::DECLINED_FICT_RESERVED);
+		add("gm.*admin", NameManagerResult::DECLINED_DEVELOPER);
+		add("hassle", NameManagerResult::DECLINED_RESERVED);
+		add("Vader", NameManagerResult::DECLINED_FICT_RESERVED);
+
+		matcher->compile();
+	}
+
+	void add(const String& pattern, int reason) {
+		matcher->add(pattern, reason);
+		patterns.add(pattern);
+		reasons.add(reason);
+	}
+
+	// What NameManager::validateReservedNames did before the matcher
+	int scan(const String& name, int resultType) {
+		for (int i = 0; i < patterns.size(); ++i) {
+			if (resultType > 0 && resultType != reasons.get(i))
+				continue;
+
+			std::regex regexCheck(patterns.get(i).toCharArray());
+
+			if (std::regex_search(name.toCharArray(), regexCheck))
+				return reasons.get(i);
+		}
+
+		return NameManagerResult::ACCEPTED;
+	}
+
+	int match(const String& name, int resultType = 0) {
+		return matcher->match(name, resultType, NameManagerResult::ACCEPTED);
+	}
+};
+
+TEST_F(ReservedNameMatcherTest, CompilesLiteralsAndRegexes) {
+	EXPECT_EQ(matcher->size(), 8);
+	EXPECT_EQ(matcher->getLiteralCount(), 5);
+}
+
+TEST_F(ReservedNameMatcherTest, Literals) {
+	EXPECT_EQ(match("canalis"), (int) NameManagerResult::DECLINED_PROFANE);
+	EXPECT_EQ(match("bass"), (int) NameManagerResult::DECLINED_PROFANE);
+	EXPECT_EQ(match("Luke"), (int) NameManagerResult::ACCEPTED);
+
+	// "hass" only reaches "ass" through a failure link
+	EXPECT_EQ(match("shass"), (int) NameManagerResult::DECLINED_PROFANE);
+}
+
+TEST_F(ReservedNameMatcherTest, Wildcards) {
+	EXPECT_EQ(match("lordvek"), (int) NameManagerResult::DECLINED_RESERVED);
+	EXPECT_EQ(match("overlord"), (int) NameManagerResult::ACCEPTED);
+
+	EXPECT_EQ(match("d4rthmaul"), (int) NameManagerResult::DECLINED_FICT_RESERVED);
+	EXPECT_EQ(match("gmsuperadmin"), (int) NameManagerResult::DECLINED_DEVELOPER);
+	EXPECT_EQ(match("admingm"), (int) NameManagerResult::ACCEPTED);
+}
+
+TEST_F(ReservedNameMatcherTest, CaseSensitiveLikeRegex) {
+	EXPECT_EQ(match("Anal"), (int) NameManagerResult::ACCEPTED);
+	EXPECT_EQ(match("LORDvek"), (int) NameManagerResult::ACCEPTED);
+	EXPECT_EQ(match("DarthVader"), (int) NameManagerResult::DECLINED_FICT_RESERVED);
+	EXPECT_EQ(match("darthvader"), (int) NameManagerResult::DECLINED_FICT_RESERVED);
+	EXPECT_EQ(match("vader"), (int) NameManagerResult::ACCEPTED);
+}
+
+TEST_F(ReservedNameMatcherTest, FirstAddedPatternWins) {
+	// "sha", "ass" and "hassle" all match, "ass" was added first
+	EXPECT_EQ(match("shassle"), (int) NameManagerResult::DECLINED_PROFANE);
+
+	// a regex added before the first literal hit takes precedence
+	EXPECT_EQ(match("lordVader"), (int) NameManagerResult::DECLINED_RESERVED);
+	EXPECT_EQ(match("lordass"), (int) NameManagerResult::DECLINED_PROFANE);
+}
+
+TEST_F(ReservedNameMatcherTest, ResultTypeRestrictsReasons) {
+	EXPECT_EQ(match("shassle", NameManagerResult::DECLINED_RESERVED), (int) NameManagerResult::DECLINED_RESERVED);
+	EXPECT_EQ(match("shassle", NameManagerResult::DECLINED_FICT_RESERVED), (int) NameManagerResult::DECLINED_FICT_RESERVED);
+	EXPECT_EQ(match("shassle", NameManagerResult::DECLINED_DEVELOPER), (int) NameManagerResult::ACCEPTED);
+	EXPECT_EQ(match("lordass", NameManagerResult::DECLINED_PROFANE), (int) NameManagerResult::DECLINED_PROFANE);
+}
+
+TEST_F(ReservedNameMatcherTest, MatchesRegexLoop) {
+	const char* names[] = {
+		"", "a", "as", "ass", "Ass", "classic", "shadow", "lord", "Lord", "warlord", "darth", "dArth",
+		"d4rth", "gmadmin", "gm", "admin", "hassled", "shasslevader", "Vaderlord", "lordVader", "anarchy"
+	};
+
+	const int types[] = {
+		0, NameManagerResult::DECLINED_DEVELOPER, NameManagerResult::DECLINED_FICT_RESERVED,
+		NameManagerResult::DECLINED_PROFANE, NameManagerResult::DECLINED_RESERVED
+	};
+
+	for (const char* name : names) {
+		for (int type : types)
+			EXPECT_EQ(match(name, type), scan(name, type)) << name << " type " << type;
+	}
+}
@@ -0,0 +1,161 @@
+/*
+ * WeightedSamplerTest.cpp
+ *
+ * The sampler has to pick entries with exactly the odds the linear
+ * accumulation loops it replaces had.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/utils/WeightedSampler.h"
+
+class WeightedSamplerTest : public ::testing::Test {
+public:
+	static Vector<int> randomWeights(int count, int maxWeight, int zeroEvery) {
+		Vector<int> weights;
+
+		for (int i = 0; i < count; ++i) {
+			if (zeroEvery > 0 && System::random(zeroEvery - 1) == 0)
+				weights.add(0);
+			else
+				weights.add(System::random(maxWeight - 1) + 1);
+		}
+
+		return weights;
+	}
+
+	// SpawnAreaImplementation::tryToSpawn before the sampler
+	static int linearChoice(const Vector<int>& weights, int choice) {
+		int counter = 0;
+
+		for (int i = 0; i < weights.size(); ++i) {
+			counter += weights.get(i);
+
+			if (choice < counter)
+				return i;
+		}
+
+		return -1;
+	}
+
+	// LootGroupTemplate::getLootGroupIntEntryForRoll before the sampler
+	static int linearRoll(const Vector<int>& weights, int roll) {
+		int totalChance = 0;
+
+		for (int i = 0; i < weights.size(); ++i) {
+			int weight = weights.get(i);
+			totalChance += weight;
+
+			if (totalChance >= roll && weight > 0)
+				return i;
+		}
+
+		return -1;
+	}
+};
+
+TEST_F(WeightedSamplerTest, PrefixLookupsMatchLinearScan) {
+	for (int set = 0; set < 20; ++set) {
+		Vector<int> weights = randomWeights(1 + System::random(40), 50, 4);
+
+		WeightedSampler sampler;
+		sampler.build(weights);
+
+		int64 total = sampler.getTotalWeight();
+
+		for (int roll = -1; roll <= total + 1; ++roll) {
+			ASSERT_EQ(linearRoll(weights, roll), sampler.findAtLeast(roll, true)) << "roll " << roll;
+
+			if (roll >= 0)
+				ASSERT_EQ(linearChoice(weights, roll), sampler.findAbove(roll)) << "choice " << roll;
+		}
+	}
+}
+
+TEST_F(WeightedSamplerTest, AliasTableIsExact) {
+	// every (column, draw) pair is one equally likely outcome, so an entry has to
+	// own exactly weight * columns of them for the odds to be weight / total
+	for (int set = 0; set < 20; ++set) {
+		Vector<int> weights = randomWeights(1 + System::random(12), 30, 5);
+
+		WeightedSampler sampler;
+		sampler.build(weights);
+
+		int64 total = sampler.getTotalWeight();
+
+		if (total == 0) {
+			EXPECT_EQ(-1, sampler.sample());
+			continue;
+		}
+
+		Vector<int64> owned;
+
+		for (int i = 0; i < weights.size(); ++i)
+			owned.add(0);
+
+		for (int column = 0; column < weights.size(); ++column) {
+			for (int64 draw = 0; draw < total; ++draw) {
+				int index = sampler.select(column, draw);
+
+				ASSERT_GE(index, 0);
+				ASSERT_LT(index, weights.size());
+
+				owned.set(index, owned.get(index) + 1);
+			}
+		}
+
+		for (int i = 0; i < weights.size(); ++i)
+			EXPECT_EQ((int64) weights.get(i) * weights.size(), owned.get(i)) << "entry " << i;
+	}
+}
+
+TEST_F(WeightedSamplerTest, SampledDistributionMatchesLinearScan) {
+	Vector<int> weights;
+	weights.add(1);
+	weights.add(0);
+	weights.add(5);
+	weights.add(20);
+	weights.add(3);
+	weights.add(71);
+
+	WeightedSampler sampler;
+	sampler.build(weights);
+
+	const int draws = 200000;
+	int total = sampler.getTotalWeight();
+
+	Vector<int> aliasCounts;
+	Vector<int> linearCounts;
+
+	for (int i = 0; i < weights.size(); ++i) {
+		aliasCounts.add(0);
+		linearCounts.add(0);
+	}
+
+	for (int i = 0; i < draws; ++i) {
+		int alias = sampler.sample();
+		int linear = linearChoice(weights, System::random(total - 1));
+
+		aliasCounts.set(alias, aliasCounts.get(alias) + 1);
+		linearCounts.set(linear, linearCounts.get(linear) + 1);
+	}
+
+	// Pearson chi-square against the expected counts, 4 degrees of freedom for the
+	// non empty entries, 18.5 is the 0.001 critical value
+	double aliasChi = 0, linearChi = 0;
+
+	for (int i = 0; i < weights.size(); ++i) {
+		if (weights.get(i) == 0) {
+			EXPECT_EQ(0, aliasCounts.get(i));
+			continue;
+		}
+
+		double expected = (double) draws * weights.get(i) / total;
+
+		aliasChi += (aliasCounts.get(i) - expected) * (aliasCounts.get(i) - expected) / expected;
+		linearChi += (linearCounts.get(i) - expected) * (linearCounts.get(i) - expected) / expected;
+	}
+
+	EXPECT_LT(aliasChi, 18.5);
+	EXPECT_LT(linearChi, 18.5);
+}
@@ -0,0 +1,264 @@
+/*
+ * ZoneSectorScalingTest.cpp
+ *
+ * Moves synthetic objects around a planet from 1 to 32 threads, once through
+ * a single quad tree behind one lock like the old zone lock and once through
+ * the sectored zone tree.
+ */
+
+#include "gtest/gtest.h"
+
+#include "server/zone/SectoredQuadTree.h"
+#include "server/zone/objects/scene/SceneObject.h"
+#include "conf/ConfigManager.h"
+
+class MoverIndex {
+public:
+	virtual ~MoverIndex() {
+	}
+
+	virtual void insert(QuadTreeEntry* entry) = 0;
+	virtual void update(QuadTreeEntry* entry) = 0;
+	virtual int inRange(float x, float y, float range, SortedVector<QuadTreeEntry*>& objects) = 0;
+};
+
+class ZoneLockedIndex : public MoverIndex {
+	Reference<QuadTree*> tree;
+	ReadWriteLock zoneLock;
+
+public:
+	ZoneLockedIndex() {
+		tree = new QuadTree(-8192, -8192, 8192, 8192);
+	}
+
+	void insert(QuadTreeEntry* entry) {
+		Locker locker(&zoneLock);
+
+		tree->insert(entry);
+	}
+
+	void update(QuadTreeEntry* entry) {
+		Locker locker(&zoneLock);
+
+		tree->update(entry);
+	}
+
+	int inRange(float x, float y, float range, SortedVector<QuadTreeEntry*>& objects) {
+		ReadLocker locker(&zoneLock);
+
+		return tree->inRange(x, y, range, objects);
+	}
+};
+
+class SectoredIndex : public MoverIndex {
+public:
+	Reference<SectoredQuadTree*> tree;
+
+	SectoredIndex() {
+		tree = new SectoredQuadTree(-8192, -8192, 8192, 8192);
+	}
+
+	void insert(QuadTreeEntry* entry) {
+		tree->insert(entry);
+	}
+
+	void update(QuadTreeEntry* entry) {
+		tree->update(entry);
+	}
+
+	int inRange(float x, float y, float range, SortedVector<QuadTreeEntry*>& objects) {
+		return tree->inRange(x, y, range, objects);
+	}
+};
+
+class SectorMoverThread : public Thread {
+	MoverIndex* index;
+	Vector<Reference<SceneObject*> > movers;
+	int operations;
+	uint32 seed;
+
+	float nextStep() {
+		seed ^= seed << 13;
+		seed ^= seed >> 17;
+		seed ^= seed << 5;
+
+		return (float) (seed % 64) - 32.f;
+	}
+
+public:
+	SectorMoverThread(MoverIndex* index, int operations, uint32 seed) : index(index), operations(operations), seed(seed) {
+	}
+
+	void addMover(SceneObject* object) {
+		movers.add(object);
+	}
+
+	void run() {
+		SortedVector<QuadTreeEntry*> found(100, 50);
+
+		for (int i = 0; i < operations; ++i) {
+			SceneObject* object = movers.getUnsafe(i % movers.size());
+
+			Locker locker(object);
+
+			float x = Math::max(-8000.f, Math::min(8000.f, object->getPositionX() + nextStep()));
+			float y = Math::max(-8000.f, Math::min(8000.f, object->getPositionY() + nextStep()));
+
+			object->setPosition(x, 0, y);
+			index->update(object);
+
+			found.removeAll(100, 50);
+			index->inRange(x, y, 128, found);
+		}
+	}
+};
+
+class ZoneSectorScalingTest : public ::testing::Test {
+protected:
+	AtomicLong nextObjectId;
+	Vector<Reference<SceneObject*> > movers;
+
+public:
+	ZoneSectorScalingTest() {
+		nextObjectId = 1;
+	}
+
+	void SetUp() {
+		ConfigManager::instance()->loadConfigData();
+		ConfigManager::instance()->setProgressMonitors(false);
+	}
+
+	void TearDown() {
+		movers.removeAll();
+	}
+
+	Reference<SceneObject*> createMover(float x, float y) {
+		Reference<SceneObject*> object = new SceneObject();
+		object->_setObjectID(nextObjectId.increment());
+		object->initializeContainerObjectsMap();
+
+		Locker locker(object);
+
+		object->initializePosition(x, 0, y);
+
+		return object;
+	}
+
+	void populate(MoverIndex* index, int count) {
+		movers.removeAll();
+
+		for (int i = 0; i < count; ++i) {
+			// spread over the planet on a loose grid so every sector sees traffic
+			float x = -7900.f + (i * 397 % 15800);
+			float y = -7900.f + (i * 211 % 15800);
+
+			Reference<SceneObject*> object = createMover(x, y);
+
+			index->insert(object);
+			movers.add(object);
+		}
+	}
+
+	uint64 runMovers(MoverIndex* index, int threads, int operations) {
+		Vector<SectorMoverThread*> workers;
+
+		for (int i = 0; i < threads; ++i)
+			workers.add(new SectorMoverThread(index, operations, 0x9E3779B9 + i * 7919));
+
+		for (int i = 0; i < movers.size(); ++i)
+			workers.getUnsafe(i % threads)->addMover(movers.getUnsafe(i));
+
+		Time start;
+
+		for (int i = 0; i < threads; ++i)
+			workers.getUnsafe(i)->start();
+
+		for (int i = 0; i < threads; ++i)
+			workers.getUnsafe(i)->join();
+
+		uint64 elapsed = start.miliDifference();
+
+		for (int i = 0; i < threads; ++i)
+			delete workers.getUnsafe(i);
+
+		return elapsed;
+	}
+
+	void assertAllFound(MoverIndex* index) {
+		for (int i = 0; i < movers.size(); ++i) {
+			SceneObject* object = movers.getUnsafe(i);
+
+			ASSERT_TRUE(object->getNode() != nullptr) << "mover " << i;
+
+			SortedVector<QuadTreeEntry*> found;
+			index->inRange(object->getPositionX(), object->getPositionY(), 1, found);
+
+			ASSERT_TRUE(found.contains(object)) << "mover " << i;
+		}
+	}
+};
+
+TEST_F(ZoneSectorScalingTest, CrossSectorMoveHandsOff) {
+	SectoredIndex index;
+
+	Reference<SceneObject*> object = createMover(SectoredQuadTree::SECTORSIZE - 8192 - 2, 0);
+	Reference<SceneObject*> neighbour = createMover(SectoredQuadTree::SECTORSIZE - 8192 + 20, 0);
+
+	index.insert(object);
+	index.insert(neighbour);
+
+	Locker locker(object);
+
+	object->setPosition(SectoredQuadTree::SECTORSIZE - 8192 + 2, 0, 0);
+	index.update(object);
+
+	EXPECT_EQ(index.tree->getSectorHandoffs(), (uint64) 1);
+
+	SortedVector<QuadTreeEntry*> found;
+	index.inRange(SectoredQuadTree::SECTORSIZE - 8192, 0, 32, found);
+
+	EXPECT_TRUE(found.contains(object.get()));
+	EXPECT_TRUE(found.contains(neighbour.get()));
+
+	// queries that straddle the border see both sides
+	index.tree->safeInRange(object, 32);
+
+	EXPECT_TRUE(object->containsInRangeObject(neighbour));
+
+	object->setPosition(9000, 0, 0);
+
+	EXPECT_FALSE(index.tree->update(object));
+	EXPECT_TRUE(object->getNode() == nullptr);
+}
+
+TEST_F(ZoneSectorScalingTest, ScalingBenchmark) {
+	const int moverCount = 4096;
+	const int operations = 20000;
+
+	const int threadCounts[] = { 1, 2, 4, 8, 16, 32 };
+
+	for (int threads : threadCounts) {
+		ZoneLockedIndex zoneLocked;
+
+		populate(&zoneLocked, moverCount);
+
+		uint64 lockedTime = runMovers(&zoneLocked, threads, operations);
+
+		assertAllFound(&zoneLocked);
+
+		SectoredIndex sectored;
+
+		populate(&sectored, moverCount);
+
+		uint64 sectoredTime = runMovers(&sectored, threads, operations);
+
+		assertAllFound(&sectored);
+
+		uint64 total = (uint64) threads * operations;
+
+		System::out << threads << " threads, " << total << " moves: zone lock " << lockedTime << "ms ("
+			<< total / Math::max((uint64) 1, lockedTime) << "/ms), sectored " << sectoredTime << "ms ("
+			<< total / Math::max((uint64) 1, sectoredTime) << "/ms), " << sectored.tree->getSectorHandoffs()
+			<< " handoffs" << endl;
+	}
+}